@@ -110,7 +110,17 @@ class StDocMeshNode : public StDocNode {
     /**
      * Empty constructor.
      */
-    StDocMeshNode() : StDocNode(StDocNodeType_Mesh) {}
+    StDocMeshNode() : StDocNode(StDocNodeType_Mesh), myNbOccurrences(0) {}
+
+    /**
+     * Return number of occurrences of this mesh within the whole document (0 if unknown).
+     */
+    int nbOccurrences() const { return myNbOccurrences; }
+
+    /**
+     * Assign number of occurrences of this mesh within the whole document.
+     */
+    void setNbOccurrences(const int theNb) { myNbOccurrences = theNb; }
 
     /**
      * Access primitive arrays.
@@ -124,7 +134,8 @@ class StDocMeshNode : public StDocNode {
 
         protected:
 
-    NCollection_Sequence<Handle(StPrimArray)> myPrimArrays; //!< primitive arrays
+    NCollection_Sequence<Handle(StPrimArray)> myPrimArrays;    //!< primitive arrays
+    int                                       myNbOccurrences; //!< number of occurrences within the document
 
 };
 
@@ -153,48 +153,53 @@ class StGltfBinTexture : public StAssetTexture {
      * Image getter.
      */
     virtual Handle(Image_PixMap) GetImage() const Standard_OVERRIDE {
-        Handle(Image_PixMap) anImage;
-        if(!myBuffer.IsNull()) {
-            Handle(StImageOcct) anStImage = new StImageOcct();
-            if(anStImage->Load(myImageUri, StMIME(myMime, StString(), StString()), myBuffer->ChangeData(), (int )myBuffer->Size())) {
-                anImage = anStImage;
-            }
-        } else {
-            std::ifstream aFile;
-            OSD_OpenStream(aFile, myImageUri.toCString(), std::ios::in | std::ios::binary);
-            if(!aFile.is_open() || !aFile.good()) {
-                ST_ERROR_LOG(StString() + "Texture points to non existing file '" + myImageUri.toCString() + "'");
-                return false;
-            }
+        StString aMime;
+        Handle(NCollection_Buffer) aData = readEmbeddedData(aMime);
+        if(aData.IsNull()) {
+            return Handle(Image_PixMap)();
+        }
 
-            aFile.seekg(myStart, std::ios_base::beg);
-            if(!aFile.good()) {
-                aFile.close();
-                ST_ERROR_LOG(StString() + "Texture refers to non-existing location");
-                return false;
-            }
+        Handle(StImageOcct) anStImage = new StImageOcct();
+        if(!anStImage->Load(myImageUri, StMIME(aMime, StString(), StString()), aData->ChangeData(), (int )aData->Size())) {
+            return Handle(Image_PixMap)();
+        }
+        return anStImage;
+    }
 
-            Handle(NCollection_Buffer) aData = new NCollection_Buffer(NCollection_BaseAllocator::CommonBaseAllocator());
-            if(!aData->Allocate(myLen)) {
-                ST_ERROR_LOG("Fail to allocate memory.");
-                return false;
-            }
+    /**
+     * Read image data from the buffer or from the range within binary file.
+     */
+    virtual Handle(NCollection_Buffer) readEmbeddedData(StString& theMime) const Standard_OVERRIDE {
+        theMime = myMime;
+        if(!myBuffer.IsNull()) {
+            return myBuffer;
+        }
 
-            if(!aFile.read((char* )aData->ChangeData(), myLen)) {
-                ST_ERROR_LOG(StString() + "Texture refers to non-existing location");
-                return false;
-            }
+        std::ifstream aFile;
+        OSD_OpenStream(aFile, myImageUri.toCString(), std::ios::in | std::ios::binary);
+        if(!aFile.is_open() || !aFile.good()) {
+            ST_ERROR_LOG(StString() + "Texture points to non existing file '" + myImageUri.toCString() + "'");
+            return Handle(NCollection_Buffer)();
+        }
 
-            Handle(StImageOcct) anStImage = new StImageOcct();
-            if(anStImage->Load(myImageUri, StMIME(myMime, StString(), StString()), aData->ChangeData(), myLen)) {
-                anImage = anStImage;
-            }
+        aFile.seekg(myStart, std::ios_base::beg);
+        if(!aFile.good()) {
+            aFile.close();
+            ST_ERROR_LOG(StString() + "Texture refers to non-existing location");
+            return Handle(NCollection_Buffer)();
         }
 
-        if(anImage.IsNull()) {
-            return Handle(Image_PixMap)();
+        Handle(NCollection_Buffer) aData = new NCollection_Buffer(NCollection_BaseAllocator::CommonBaseAllocator());
+        if(!aData->Allocate(myLen)) {
+            ST_ERROR_LOG("Fail to allocate memory.");
+            return Handle(NCollection_Buffer)();
         }
-        return anImage;
+
+        if(!aFile.read((char* )aData->ChangeData(), myLen)) {
+            ST_ERROR_LOG(StString() + "Texture refers to non-existing location");
+            return Handle(NCollection_Buffer)();
+        }
+        return aData;
     }
 
     /**
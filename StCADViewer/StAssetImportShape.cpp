@@ -5,10 +5,13 @@
  */
 
 #include "StAssetImportShape.h"
+#include "StAssetMeshCache.h"
+#include "StAssetNodeIterator.h"
 
 #include <StStrings/StLogger.h>
 
 #include <BRep_Builder.hxx>
+#include <BRepBndLib.hxx>
 #include <BRepLProp_SLProps.hxx>
 #include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepTools.hxx>
@@ -37,6 +40,33 @@
 #include <XSControl_TransferReader.hxx>
 #include <XSControl_WorkSession.hxx>
 
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+    /**
+     * Part of the document to be meshed and published separately.
+     */
+    struct StShapePart {
+        Handle(StDocNode) Parent;     //!< parent node within the document
+        gp_Trsf           ParentTrsf; //!< location of the parent node
+        TDF_Label         Label;      //!< part label
+        TopLoc_Location   Trsf;       //!< part location relative to parent
+        XCAFPrs_Style     Style;      //!< inherited style
+        TopoDS_Shape      Shape;      //!< located shape
+        double            Size;       //!< square extent of bounding box
+
+        StShapePart() : Size(0.0) {}
+
+        /**
+         * Sort larger parts first.
+         */
+        bool operator<(const StShapePart& theOther) const { return Size > theOther.Size; }
+    };
+
+}
+
 namespace {
     static StString formatError(const StString& theFilePath,
                                 const StString& theLibDescr) {
@@ -169,6 +199,30 @@ void StAssetImportShape::clearSession(const Handle(XSControl_WorkSession)& theWo
 bool StAssetImportShape::load(const Handle(StDocNode)& theParentNode,
                               const StString& theFile,
                               const FileFormat theFormat) {
+    // drop translated shapes left by previous load interrupted by exception
+    myMeshMap.Clear();
+    myNbOccurrences.Clear();
+
+    // meshing parameters are defined by default drawer,
+    // so that the cache key is known before reading the file
+    Handle(Prs3d_Drawer) aDrawer = new Prs3d_Drawer();
+    const StAssetMeshCache aCache(myCacheFolder);
+    StString aCacheKey;
+    if(!myCacheFolder.isEmpty()
+    && (theFormat == FileFormat_STEP
+     || theFormat == FileFormat_IGES)) {
+        aCacheKey = StAssetMeshCache::computeKey(theFile, aDrawer->DeviationCoefficient(), aDrawer->HLRAngle());
+        if(!aCacheKey.isEmpty()
+         && aCache.load(aCacheKey, theParentNode)) {
+            ST_DEBUG_LOG("StAssetImportShape, triangulation of \"" + theFile + "\" has been read from cache");
+            countMeshOccurrences(theParentNode);
+            for(NCollection_Sequence<Handle(StDocNode)>::Iterator aChildIter(theParentNode->Children()); aChildIter.More(); aChildIter.Next()) {
+                signals.onSubtreeLoaded(aChildIter.Value(), gp_Trsf());
+            }
+            return true;
+        }
+    }
+
     switch(theFormat) {
         case FileFormat_STEP: {
             if(!loadSTEP(theFile)) {
@@ -226,7 +280,7 @@ bool StAssetImportShape::load(const Handle(StDocNode)& theParentNode,
         return false;
     }
 
-    // perform meshing explicitly
+    // deflection is defined by dimensions of the whole model
     TopoDS_Compound aCompound;
     BRep_Builder    aBuildTool;
     aBuildTool.MakeCompound(aCompound);
@@ -238,33 +292,157 @@ bool StAssetImportShape::load(const Handle(StDocNode)& theParentNode,
         }
     }
 
-    Handle(Prs3d_Drawer) aDrawer = new Prs3d_Drawer();
-    Standard_Real aDeflection = Prs3d::GetDeflection(aCompound, aDrawer);
-    if(!BRepTools::Triangulation(aCompound, aDeflection)) {
-        BRepMesh_IncrementalMesh anAlgo;
-        anAlgo.ChangeParameters().Deflection = aDeflection;
-        anAlgo.ChangeParameters().Angle      = aDrawer->HLRAngle();
-        anAlgo.ChangeParameters().InParallel = true;
-        anAlgo.SetShape(aCompound);
-        anAlgo.Perform();
+    const Standard_Real aDeflection = Prs3d::GetDeflection(aCompound, aDrawer);
+
+    // count repeated parts within the whole document before publishing any subtree
+    for(TDF_LabelSequence::Iterator aLabIter(aLabels); aLabIter.More(); aLabIter.Next()) {
+        countOccurrences(aLabIter.Value());
     }
 
+    // split the document into parts (free shapes and components of top-level assemblies)
+    // to mesh and publish them one by one, starting from the largest ones
     XCAFPrs_Style aDefStyle;
     aDefStyle.SetColorSurf(Quantity_NOC_GRAY65);
     aDefStyle.SetColorCurv(Quantity_NOC_GRAY65);
+    std::vector<StShapePart> aParts;
     for(TDF_LabelSequence::Iterator aLabIter(aLabels); aLabIter.More(); aLabIter.Next()) {
-        const TDF_Label& aLabel = aLabIter.Value();
-        TopLoc_Location aTrsf = XCAFDoc_ShapeTool::GetLocation(aLabel);
-        addNodeRecursive(theParentNode, *aColorTool, aLabel, aTrsf, aDefStyle);
+        StShapePart aPart;
+        aPart.Parent = theParentNode;
+        aPart.Label  = aLabIter.Value();
+        aPart.Trsf   = XCAFDoc_ShapeTool::GetLocation(aPart.Label);
+        aPart.Style  = aDefStyle;
+
+        TDF_Label aRefLabel = aPart.Label;
+        if(XCAFDoc_ShapeTool::IsReference(aPart.Label)) {
+            XCAFDoc_ShapeTool::GetReferredShape(aPart.Label, aRefLabel);
+        }
+        if(!XCAFDoc_ShapeTool::IsAssembly(aRefLabel)) {
+            aParts.push_back(aPart);
+            continue;
+        }
+
+        XCAFPrs_Style anAssemblyStyle;
+        const Handle(StDocNode) anAssembly = addObjectNode(theParentNode, *aColorTool, aPart.Label, aPart.Trsf, aDefStyle,
+                                                           aRefLabel, anAssemblyStyle);
+        for(TDF_ChildIterator aChildIter(aRefLabel); aChildIter.More(); aChildIter.Next()) {
+            const TDF_Label aChildLabel = aChildIter.Value();
+            if(!aChildLabel.IsNull()
+            && (aChildLabel.HasAttribute() || aChildLabel.HasChild())) {
+                StShapePart aChildPart;
+                aChildPart.Parent     = anAssembly;
+                aChildPart.ParentTrsf = aPart.Trsf.Transformation();
+                aChildPart.Label      = aChildLabel;
+                aChildPart.Trsf       = XCAFDoc_ShapeTool::GetLocation(aChildLabel);
+                aChildPart.Style      = anAssemblyStyle;
+                aParts.push_back(aChildPart);
+            }
+        }
+    }
+
+    for(std::vector<StShapePart>::iterator aPartIter = aParts.begin(); aPartIter != aParts.end(); ++aPartIter) {
+        Bnd_Box aBox;
+        if(XCAFDoc_ShapeTool::GetShape(aPartIter->Label, aPartIter->Shape)
+        && !aPartIter->Shape.IsNull()) {
+            BRepBndLib::Add(aPartIter->Shape, aBox);
+        }
+        aPartIter->Size = aBox.IsVoid() ? 0.0 : aBox.SquareExtent();
+    }
+    std::stable_sort(aParts.begin(), aParts.end());
+
+    for(std::vector<StShapePart>::const_iterator aPartIter = aParts.begin(); aPartIter != aParts.end(); ++aPartIter) {
+        // perform meshing explicitly
+        if(!aPartIter->Shape.IsNull()
+        && !BRepTools::Triangulation(aPartIter->Shape, aDeflection)) {
+            BRepMesh_IncrementalMesh anAlgo;
+            anAlgo.ChangeParameters().Deflection = aDeflection;
+            anAlgo.ChangeParameters().Angle      = aDrawer->HLRAngle();
+            anAlgo.ChangeParameters().InParallel = true;
+            anAlgo.SetShape(aPartIter->Shape);
+            anAlgo.Perform();
+        }
+
+        addNodeRecursive(aPartIter->Parent, *aColorTool, aPartIter->Label, aPartIter->Trsf, aPartIter->Style);
+        signals.onSubtreeLoaded(aPartIter->Parent->Children().Last(), aPartIter->ParentTrsf);
+    }
+    myMeshMap.Clear();
+    myNbOccurrences.Clear();
+
+    if(!aCacheKey.isEmpty()
+    && !aCache.save(aCacheKey, theParentNode)) {
+        ST_DEBUG_LOG("StAssetImportShape, unable to write triangulation cache for \"" + theFile + "\"");
     }
     return true;
 }
 
+void StAssetImportShape::countOccurrences(const TDF_Label& theLabel) {
+    TDF_Label aRefLabel = theLabel;
+    if(XCAFDoc_ShapeTool::IsReference(theLabel)) {
+        XCAFDoc_ShapeTool::GetReferredShape(theLabel, aRefLabel);
+    }
+    if(!XCAFDoc_ShapeTool::IsAssembly(aRefLabel)) {
+        if(int* aNbOccurrences = myNbOccurrences.ChangeSeek(aRefLabel)) {
+            ++(*aNbOccurrences);
+        } else {
+            myNbOccurrences.Bind(aRefLabel, 1);
+        }
+        return;
+    }
+
+    for(TDF_ChildIterator aChildIter(aRefLabel); aChildIter.More(); aChildIter.Next()) {
+        const TDF_Label aLabel = aChildIter.Value();
+        if(!aLabel.IsNull()
+        && (aLabel.HasAttribute() || aLabel.HasChild())) {
+            countOccurrences(aLabel);
+        }
+    }
+}
+
+void StAssetImportShape::countMeshOccurrences(const Handle(StDocNode)& theRoot) {
+    NCollection_DataMap<Handle(Standard_Transient), int> aCounters;
+    for(StAssetNodeIterator aMeshNodeIter(theRoot, StDocNodeType_Mesh); aMeshNodeIter.more(); aMeshNodeIter.next()) {
+        if(int* aNbOccurrences = aCounters.ChangeSeek(aMeshNodeIter.value())) {
+            ++(*aNbOccurrences);
+        } else {
+            aCounters.Bind(aMeshNodeIter.value(), 1);
+        }
+    }
+    for(NCollection_DataMap<Handle(Standard_Transient), int>::Iterator aCountIter(aCounters); aCountIter.More(); aCountIter.Next()) {
+        Handle(StDocMeshNode) aMeshNode = Handle(StDocMeshNode)::DownCast(aCountIter.Key());
+        aMeshNode->setNbOccurrences(aCountIter.Value());
+    }
+}
+
 void StAssetImportShape::addNodeRecursive(const Handle(StDocNode)& theParentTreeItem,
                                           XCAFDoc_ColorTool&       theColorTool,
                                           const TDF_Label&         theLabel,
                                           const TopLoc_Location&   theParentTrsf,
                                           const XCAFPrs_Style&     theParentStyle) {
+    TDF_Label     aRefLabel;
+    XCAFPrs_Style aDefStyle;
+    const Handle(StDocNode) aChildTreeItem = addObjectNode(theParentTreeItem, theColorTool, theLabel, theParentTrsf, theParentStyle,
+                                                           aRefLabel, aDefStyle);
+    if(!XCAFDoc_ShapeTool::IsAssembly(aRefLabel)) {
+        addMeshNode(aChildTreeItem, aRefLabel, aDefStyle);
+        return;
+    }
+
+    for(TDF_ChildIterator aChildIter(aRefLabel); aChildIter.More(); aChildIter.Next()) {
+        TDF_Label aLabel = aChildIter.Value();
+        if(!aLabel.IsNull()
+        && (aLabel.HasAttribute() || aLabel.HasChild())) {
+            const TopLoc_Location aTrsf = XCAFDoc_ShapeTool::GetLocation(aLabel);
+            addNodeRecursive(aChildTreeItem, theColorTool, aLabel, aTrsf, aDefStyle);
+        }
+    }
+}
+
+Handle(StDocNode) StAssetImportShape::addObjectNode(const Handle(StDocNode)& theParentTreeItem,
+                                                    XCAFDoc_ColorTool&       theColorTool,
+                                                    const TDF_Label&         theLabel,
+                                                    const TopLoc_Location&   theTrsf,
+                                                    const XCAFPrs_Style&     theParentStyle,
+                                                    TDF_Label&               theRefLabel,
+                                                    XCAFPrs_Style&           theStyle) {
     TDF_Label aRefLabel = theLabel;
     if(XCAFDoc_ShapeTool::IsReference(theLabel)) {
         XCAFDoc_ShapeTool::GetReferredShape(theLabel, aRefLabel);
@@ -291,21 +469,11 @@ void StAssetImportShape::addNodeRecursive(const Handle(StDocNode)& theParentTree
 
     Handle(StDocObjectNode) aChildTreeItem = new StDocObjectNode();
     aChildTreeItem->setNodeName(aName.ToCString());
-    aChildTreeItem->setNodeTransformation(theParentTrsf.Transformation());
+    aChildTreeItem->setNodeTransformation(theTrsf.Transformation());
     theParentTreeItem->ChangeChildren().Append(aChildTreeItem);
-    if(!XCAFDoc_ShapeTool::IsAssembly(aRefLabel)) {
-        addMeshNode(aChildTreeItem, aRefLabel, aDefStyle);
-        return;
-    }
-
-    for(TDF_ChildIterator aChildIter(aRefLabel); aChildIter.More(); aChildIter.Next()) {
-        TDF_Label aLabel = aChildIter.Value();
-        if(!aLabel.IsNull()
-        && (aLabel.HasAttribute() || aLabel.HasChild())) {
-            const TopLoc_Location aTrsf = XCAFDoc_ShapeTool::GetLocation(aLabel);
-            addNodeRecursive(aChildTreeItem, theColorTool, aLabel, aTrsf, aDefStyle);
-        }
-    }
+    theRefLabel = aRefLabel;
+    theStyle    = aDefStyle;
+    return aChildTreeItem;
 }
 
 bool StAssetImportShape::addMeshNode(const Handle(StDocNode)& theParentTreeItem,
@@ -315,6 +483,14 @@ bool StAssetImportShape::addMeshNode(const Handle(StDocNode)& theParentTreeItem,
         return false;
     }
 
+    // reuse mesh of another occurrence of the same part
+    if(const StShapeMesh* aShared = myMeshMap.Seek(theShapeLabel)) {
+        if(aShared->Style.IsEqual(theParentStyle)) {
+            theParentTreeItem->ChangeChildren().Append(aShared->Mesh);
+            return true;
+        }
+    }
+
     TopoDS_Shape aShape;
     if(!XCAFDoc_ShapeTool::GetShape(theShapeLabel, aShape)
     || aShape.IsNull()) {
@@ -344,7 +520,16 @@ bool StAssetImportShape::addMeshNode(const Handle(StDocNode)& theParentTreeItem,
 
     TopLoc_Location aFaceLoc;
     Handle(StDocMeshNode) aMeshNode = new StDocMeshNode();
+    if(const int* aNbOccurrences = myNbOccurrences.Seek(theShapeLabel)) {
+        aMeshNode->setNbOccurrences(*aNbOccurrences);
+    }
     theParentTreeItem->ChangeChildren().Append(aMeshNode);
+    {
+        StShapeMesh aShapeMesh;
+        aShapeMesh.Mesh  = aMeshNode;
+        aShapeMesh.Style = theParentStyle;
+        myMeshMap.Bind(theShapeLabel, aShapeMesh);
+    }
     BRepLProp_SLProps anSLProps(1, 1e-12);
     BRepAdaptor_Surface aFaceAdaptor;
     for(int aTypeIter = 0; aTypeIter < 2; ++aTypeIter) {
@@ -450,7 +635,7 @@ bool StAssetImportShape::addMeshNode(const Handle(StDocNode)& theParentTreeItem,
                 }
             } else {
                 // reconstruct missing normals
-                aPrimAttribs->reconstructNormals();
+                aPrimAttribs->reconstructNormals(!myThreadPool.isNull() ? myThreadPool.access() : NULL);
             }
 
             XCAFPrs_Style aStyle = theParentStyle;
@@ -10,8 +10,12 @@
 #include <StStrings/StString.h>
 #include <StFile/StFileNode.h>
 #include <StSlots/StSignal.h>
+#include <StThreads/StThreadPool.h>
 
+#include <NCollection_DataMap.hxx>
 #include <Standard_Type.hxx>
+#include <TDF_LabelMapHasher.hxx>
+#include <XCAFPrs_Style.hxx>
 
 #include "StAssetDocument.h"
 
@@ -21,7 +25,6 @@ class TopLoc_Location;
 class TopoDS_Shape;
 class TDocStd_Application;
 class XCAFDoc_ColorTool;
-class XCAFPrs_Style;
 class XSControl_WorkSession;
 
 /**
@@ -68,6 +71,20 @@ class StAssetImportShape {
      */
     ST_LOCAL StAssetImportShape();
 
+    /**
+     * Set folder for caching triangulated STEP/IGES documents (empty string disables the cache).
+     */
+    ST_LOCAL void setCacheFolder(const StString& theFolder) {
+        myCacheFolder = theFolder;
+    }
+
+    /**
+     * Set thread pool for reconstructing normals of large triangulations.
+     */
+    ST_LOCAL void setThreadPool(const StHandle<StThreadPool>& thePool) {
+        myThreadPool = thePool;
+    }
+
     /**
      * Perform the import.
      */
@@ -96,13 +113,46 @@ class StAssetImportShape {
                                    const TopLoc_Location&   theParentTrsf,
                                    const XCAFPrs_Style&     theParentStyle);
 
+    /**
+     * Add the object node for the XDE label into Asset document.
+     * @param theParentTreeItem parent node
+     * @param theColorTool      color tool
+     * @param theLabel          the label (might be a reference)
+     * @param theTrsf           label location
+     * @param theParentStyle    inherited style
+     * @param theRefLabel       referred label
+     * @param theStyle          style to be inherited by children
+     * @return created node
+     */
+    ST_LOCAL Handle(StDocNode) addObjectNode(const Handle(StDocNode)& theParentTreeItem,
+                                             XCAFDoc_ColorTool&       theColorTool,
+                                             const TDF_Label&         theLabel,
+                                             const TopLoc_Location&   theTrsf,
+                                             const XCAFPrs_Style&     theParentStyle,
+                                             TDF_Label&               theRefLabel,
+                                             XCAFPrs_Style&           theStyle);
+
     /**
      * Add the BRep shape into Asset document.
+     * Mesh node is shared between all occurrences of the same shape label with the same inherited style,
+     * so that repeated assembly parts can be displayed as instances.
      */
     ST_LOCAL bool addMeshNode(const Handle(StDocNode)& theParentTreeItem,
                               const TDF_Label&         theShapeLabel,
                               const XCAFPrs_Style&     theParentStyle);
 
+    /**
+     * Count occurrences of shape labels within the XDE label (recursively).
+     * Counters are used to decide which parts should be displayed as instances
+     * before the whole document has been translated.
+     */
+    ST_LOCAL void countOccurrences(const TDF_Label& theLabel);
+
+    /**
+     * Assign numbers of occurrences to mesh nodes of already complete document.
+     */
+    ST_LOCAL static void countMeshOccurrences(const Handle(StDocNode)& theRoot);
+
     /**
      * Reset XDE document.
      */
@@ -121,12 +171,36 @@ class StAssetImportShape {
          * @param theUserData (const StString& ) - error description.
          */
         StSignal<void (const StCString& )> onError;
+
+        /**
+         * Emit callback Slot when the subtree of the document has been translated and meshed,
+         * so that it can be displayed before loading of the whole document has been completed.
+         * @param theNode       subtree root
+         * @param theParentTrsf location of the parent node
+         */
+        StSignal<void (const Handle(StDocNode)& , const gp_Trsf& )> onSubtreeLoaded;
     } signals;
 
         protected:
 
+    /**
+     * Mesh node created for the shape label.
+     */
+    struct StShapeMesh {
+        Handle(StDocMeshNode) Mesh;  //!< mesh node
+        XCAFPrs_Style         Style; //!< inherited style used to build the mesh
+    };
+
+        protected:
+
     Handle(TDocStd_Application) myXCAFApp;
     Handle(TDocStd_Document)    myXCAFDoc;
+    NCollection_DataMap<TDF_Label, StShapeMesh, TDF_LabelMapHasher>
+                                myMeshMap; //!< map of already translated shape labels
+    NCollection_DataMap<TDF_Label, int, TDF_LabelMapHasher>
+                                myNbOccurrences; //!< numbers of occurrences of shape labels within the document
+    StString                    myCacheFolder; //!< folder for caching triangulated documents
+    StHandle<StThreadPool>      myThreadPool;  //!< optional workers for reconstructing normals
 
 };
 
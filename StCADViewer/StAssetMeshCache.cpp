@@ -0,0 +1,672 @@
+/**
+ * This source is a part of sView program.
+ *
+ * Copyright © Kirill Gavrilov, 2017
+ */
+
+#include "StAssetMeshCache.h"
+#include "StImageOcct.h"
+
+#include <StFile/StFolder.h>
+#include <StFile/StMIME.h>
+#include <StFile/StRawFile.h>
+#include <StStrings/StLogger.h>
+
+#include <NCollection_IndexedMap.hxx>
+#include <OSD_OpenFile.hxx>
+#include <TColStd_MapTransientHasher.hxx>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+/**
+ * Texture restored from cache with image data stored within cache file.
+ */
+class StCachedTexture : public StAssetTexture {
+
+    DEFINE_STANDARD_RTTI_INLINE(StCachedTexture, StAssetTexture)
+
+        public:
+
+    /**
+     * Constructor.
+     */
+    StCachedTexture(const StString& theId,
+                    const StString& theUri,
+                    const StString& theMime,
+                    const Handle(NCollection_Buffer)& theData)
+    : StAssetTexture(theUri),
+      myData(theData),
+      myMime(theMime) {
+        myTexId = theId.toCString();
+    }
+
+    /**
+     * Image getter.
+     */
+    virtual Handle(Image_PixMap) GetImage() const Standard_OVERRIDE {
+        Handle(StImageOcct) anStImage = new StImageOcct();
+        if(!anStImage->Load(myImageUri, StMIME(myMime, StString(), StString()), myData->ChangeData(), (int )myData->Size())) {
+            return Handle(Image_PixMap)();
+        }
+        return anStImage;
+    }
+
+    /**
+     * Return image data.
+     */
+    virtual Handle(NCollection_Buffer) readEmbeddedData(StString& theMime) const Standard_OVERRIDE {
+        theMime = myMime;
+        return myData;
+    }
+
+    /**
+     * Compare with another texture.
+     */
+    virtual bool isEqual(const StAssetTexture& theOther) const {
+        return myTexId == theOther.GetId();
+    }
+
+        private:
+
+    Handle(NCollection_Buffer) myData;
+    StString myMime;
+
+};
+
+namespace {
+
+    /**
+     * Magic header, should be changed when file layout is modified.
+     */
+    static const char THE_CACHE_MAGIC[8] = { 'S', 't', 'M', 'e', 's', 'h', '0', '2' };
+
+    /**
+     * Size of chunks for reading the file while computing the key.
+     */
+    static const size_t THE_KEY_CHUNK_SIZE = 1024 * 1024;
+
+    /**
+     * Limit for total size of cache files.
+     */
+    static const int64_t THE_CACHE_SIZE_MAX = int64_t(512) * 1024 * 1024;
+
+    /**
+     * Special material index for undefined material.
+     */
+    static const uint32_t THE_NO_MATERIAL = uint32_t(-1);
+
+    /**
+     * Type of node record in the tree.
+     */
+    enum StCacheNodeRecord {
+        StCacheNodeRecord_Group = 0, //!< object node with child records
+        StCacheNodeRecord_Mesh  = 1  //!< leaf mesh node referring to the mesh by index
+    };
+
+    /**
+     * FNV-1a hash.
+     */
+    inline uint64_t hashBytes(uint64_t     theHash,
+                              const void*  theData,
+                              const size_t theSize) {
+        const uint8_t* aData = (const uint8_t* )theData;
+        for(size_t aByteIter = 0; aByteIter < theSize; ++aByteIter) {
+            theHash ^= aData[aByteIter];
+            theHash *= 1099511628211ULL;
+        }
+        return theHash;
+    }
+
+    /**
+     * Auxiliary buffer for writing.
+     */
+    class StCacheWriter {
+
+            public:
+
+        void append(const void*  theData,
+                    const size_t theSize) {
+            const char* aData = (const char* )theData;
+            myData.insert(myData.end(), aData, aData + theSize);
+        }
+
+        void appendInt(const uint32_t theValue) {
+            append(&theValue, sizeof(theValue));
+        }
+
+        /**
+         * Write array with 4-bytes alignment of the end.
+         */
+        void appendArray(const void*  theData,
+                         const size_t theSize) {
+            append(theData, theSize);
+            myData.resize((myData.size() + 3) & ~size_t(3), 0);
+        }
+
+        void appendString(const StString& theString) {
+            appendInt(uint32_t(theString.getSize()));
+            appendArray(theString.toCString(), theString.getSize());
+        }
+
+        void appendTrsf(const gp_Trsf& theTrsf) {
+            appendInt(theTrsf.Form() == gp_Identity ? 1 : 0);
+            double aValues[12];
+            for(int aRow = 1; aRow <= 3; ++aRow) {
+                for(int aCol = 1; aCol <= 4; ++aCol) {
+                    aValues[(aRow - 1) * 4 + aCol - 1] = theTrsf.Value(aRow, aCol);
+                }
+            }
+            append(aValues, sizeof(aValues));
+        }
+
+        const std::vector<char>& getData() const { return myData; }
+
+            private:
+
+        std::vector<char> myData;
+
+    };
+
+    /**
+     * Auxiliary cursor for reading.
+     */
+    class StCacheReader {
+
+            public:
+
+        StCacheReader(const stUByte_t* theData,
+                      const size_t     theSize)
+        : myData(theData), mySize(theSize), myPos(0) {}
+
+        bool read(void*        theData,
+                  const size_t theSize) {
+            if(mySize - myPos < theSize) {
+                return false;
+            }
+            stMemCpy(theData, myData + myPos, theSize);
+            myPos += theSize;
+            return true;
+        }
+
+        bool hasBytes(const size_t theSize) const {
+            return mySize - myPos >= theSize;
+        }
+
+        bool readInt(uint32_t& theValue) {
+            return read(&theValue, sizeof(theValue));
+        }
+
+        bool readArray(void*        theData,
+                       const size_t theSize) {
+            if(!read(theData, theSize)) {
+                return false;
+            }
+            myPos = stMin((myPos + 3) & ~size_t(3), mySize);
+            return true;
+        }
+
+        template<typename T>
+        bool readVector(std::vector<T>& theVec) {
+            uint32_t aNbElems = 0;
+            if(!readInt(aNbElems)
+            || size_t(aNbElems) > (mySize - myPos) / sizeof(T)) {
+                return false;
+            }
+            theVec.resize(aNbElems);
+            return aNbElems == 0
+                || readArray(&theVec[0], sizeof(T) * aNbElems);
+        }
+
+        bool readString(StString& theString) {
+            uint32_t aLen = 0;
+            if(!readInt(aLen)
+            || size_t(aLen) > mySize - myPos) {
+                return false;
+            }
+            theString = StString((const char* )myData + myPos, aLen);
+            return skip(aLen);
+        }
+
+        bool readTrsf(gp_Trsf& theTrsf) {
+            uint32_t isIdentity = 0;
+            double aVal[12];
+            if(!readInt(isIdentity)
+            || !read(aVal, sizeof(aVal))) {
+                return false;
+            }
+            if(isIdentity == 0) {
+                theTrsf.SetValues(aVal[0], aVal[1], aVal[2],  aVal[3],
+                                  aVal[4], aVal[5], aVal[6],  aVal[7],
+                                  aVal[8], aVal[9], aVal[10], aVal[11]);
+            }
+            return true;
+        }
+
+            private:
+
+        bool skip(const size_t theSize) {
+            if(mySize - myPos < theSize) {
+                return false;
+            }
+            myPos = stMin((myPos + theSize + 3) & ~size_t(3), mySize);
+            return true;
+        }
+
+            private:
+
+        const stUByte_t* myData;
+        size_t           mySize;
+        size_t           myPos;
+
+    };
+
+    /**
+     * Write texture source: texture id, image URI and image data for textures embedded into another file.
+     * @return false if texture can not be restored from this information
+     */
+    static bool writeTexture(StCacheWriter& theWriter,
+                             const Handle(StAssetTexture)& theTexture) {
+        if(theTexture.IsNull()) {
+            theWriter.appendInt(0);
+            return true;
+        }
+
+        StString aMime;
+        Handle(NCollection_Buffer) aData = theTexture->readEmbeddedData(aMime);
+        if(aData.IsNull()
+        && theTexture->DynamicType() != STANDARD_TYPE(StAssetTexture)) {
+            // unknown texture source
+            return false;
+        }
+
+        theWriter.appendInt(1);
+        theWriter.appendString(theTexture->GetId().ToCString());
+        theWriter.appendString(theTexture->getImageUri());
+        theWriter.appendString(aMime);
+        theWriter.appendInt(!aData.IsNull() ? uint32_t(aData->Size()) : 0);
+        if(!aData.IsNull()) {
+            theWriter.appendArray(aData->Data(), aData->Size());
+        }
+        return true;
+    }
+
+    /**
+     * Read texture written by writeTexture().
+     */
+    static bool readTexture(StCacheReader& theReader,
+                            Handle(StAssetTexture)& theTexture) {
+        uint32_t hasTexture = 0;
+        if(!theReader.readInt(hasTexture)) {
+            return false;
+        } else if(hasTexture == 0) {
+            return true;
+        }
+
+        StString anId, anUri, aMime;
+        uint32_t aDataSize = 0;
+        if(!theReader.readString(anId)
+        || !theReader.readString(anUri)
+        || !theReader.readString(aMime)
+        || !theReader.readInt(aDataSize)) {
+            return false;
+        }
+        if(aDataSize == 0) {
+            theTexture = new StAssetTexture(anUri);
+            return true;
+        }
+
+        Handle(NCollection_Buffer) aData = new NCollection_Buffer(NCollection_BaseAllocator::CommonBaseAllocator());
+        if(!theReader.hasBytes(aDataSize)
+        || !aData->Allocate(aDataSize)
+        || !theReader.readArray(aData->ChangeData(), aDataSize)) {
+            return false;
+        }
+        theTexture = new StCachedTexture(anId, anUri, aMime, aData);
+        return true;
+    }
+
+    /**
+     * Collect materials and meshes of the tree.
+     */
+    static void collectNodes(const Handle(StDocNode)& theNode,
+                             NCollection_IndexedMap<Handle(Standard_Transient), TColStd_MapTransientHasher>& theMaterials,
+                             NCollection_IndexedMap<Handle(Standard_Transient), TColStd_MapTransientHasher>& theMeshes) {
+        for(NCollection_Sequence<Handle(StDocNode)>::Iterator aChildIter(theNode->Children()); aChildIter.More(); aChildIter.Next()) {
+            const Handle(StDocNode)& aChild = aChildIter.Value();
+            if(aChild->nodeType() == StDocNodeType_Mesh) {
+                Handle(StDocMeshNode) aMesh = Handle(StDocMeshNode)::DownCast(aChild);
+                const int aNbMeshes = theMeshes.Extent();
+                if(theMeshes.Add(aMesh) > aNbMeshes) {
+                    for(NCollection_Sequence<Handle(StPrimArray)>::Iterator aPrimIter(aMesh->PrimitiveArrays()); aPrimIter.More(); aPrimIter.Next()) {
+                        if(!aPrimIter.Value()->Material.IsNull()) {
+                            theMaterials.Add(aPrimIter.Value()->Material);
+                        }
+                    }
+                }
+            }
+            collectNodes(aChild, theMaterials, theMeshes);
+        }
+    }
+
+    /**
+     * Write the tree.
+     */
+    static void writeNodes(StCacheWriter& theWriter,
+                           const Handle(StDocNode)& theNode,
+                           const NCollection_IndexedMap<Handle(Standard_Transient), TColStd_MapTransientHasher>& theMeshes) {
+        theWriter.appendInt(uint32_t(theNode->Children().Size()));
+        for(NCollection_Sequence<Handle(StDocNode)>::Iterator aChildIter(theNode->Children()); aChildIter.More(); aChildIter.Next()) {
+            const Handle(StDocNode)& aChild = aChildIter.Value();
+            const bool isMesh = aChild->nodeType() == StDocNodeType_Mesh;
+            theWriter.appendInt(isMesh ? StCacheNodeRecord_Mesh : StCacheNodeRecord_Group);
+            theWriter.appendInt(isMesh ? uint32_t(theMeshes.FindIndex(aChild) - 1) : 0);
+            theWriter.appendTrsf(aChild->nodeTransformation());
+            theWriter.appendString(aChild->nodeName());
+            if(!isMesh) {
+                // mesh node is shared by its occurrences and holds only primitive arrays
+                writeNodes(theWriter, aChild, theMeshes);
+            }
+        }
+    }
+
+    /**
+     * Read the tree.
+     */
+    static bool readNodes(StCacheReader& theReader,
+                          const Handle(StDocNode)& theNode,
+                          const NCollection_Sequence<Handle(StDocMeshNode)>& theMeshes,
+                          const int theDepth) {
+        uint32_t aNbChildren = 0;
+        if(theDepth > 1024
+        || !theReader.readInt(aNbChildren)) {
+            return false;
+        }
+
+        for(uint32_t aChildIter = 0; aChildIter < aNbChildren; ++aChildIter) {
+            uint32_t aType = 0, aMeshIndex = 0;
+            gp_Trsf  aTrsf;
+            StString aName;
+            if(!theReader.readInt(aType)
+            || !theReader.readInt(aMeshIndex)
+            || !theReader.readTrsf(aTrsf)
+            || !theReader.readString(aName)) {
+                return false;
+            }
+
+            Handle(StDocNode) aChild;
+            if(aType == StCacheNodeRecord_Mesh) {
+                if(aMeshIndex >= uint32_t(theMeshes.Size())) {
+                    return false;
+                }
+                // mesh node is shared by all its occurrences, thus name and location are the same
+                aChild = theMeshes.Value(int(aMeshIndex) + 1);
+            } else if(aType == StCacheNodeRecord_Group) {
+                aChild = new StDocObjectNode();
+            } else {
+                return false;
+            }
+            aChild->setNodeName(aName);
+            aChild->setNodeTransformation(aTrsf);
+            theNode->ChangeChildren().Append(aChild);
+            if(aType == StCacheNodeRecord_Group
+            && !readNodes(theReader, aChild, theMeshes, theDepth + 1)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+}
+
+StAssetMeshCache::StAssetMeshCache(const StString& theFolder)
+: myFolder(theFolder) {
+    //
+}
+
+StString StAssetMeshCache::getFilePath(const StString& theKey) const {
+    return myFolder + "mesh_" + theKey + ".stmesh";
+}
+
+StString StAssetMeshCache::computeKey(const StString& theFile,
+                                      const double    theDeflection,
+                                      const double    theAngle) {
+    int64_t aSize = 0, aModifTime = 0;
+    if(!StFileNode::getFileStat(theFile, aSize, aModifTime)) {
+        return StString();
+    }
+
+    std::ifstream aFile;
+    OSD_OpenStream(aFile, theFile.toCString(), std::ios::in | std::ios::binary);
+    if(!aFile.is_open()) {
+        return StString();
+    }
+
+    uint64_t aHash = 14695981039346656037ULL;
+    aHash = hashBytes(aHash, &aSize,         sizeof(aSize));
+    aHash = hashBytes(aHash, &theDeflection, sizeof(theDeflection));
+    aHash = hashBytes(aHash, &theAngle,      sizeof(theAngle));
+
+    // hash the whole file content, so that the key does not depend on file location and modification time
+    std::vector<char> aChunk(THE_KEY_CHUNK_SIZE);
+    int64_t aNbRead = 0;
+    while(aFile.good()) {
+        aFile.read(&aChunk[0], std::streamsize(aChunk.size()));
+        const size_t aChunkSize = size_t(aFile.gcount());
+        aHash = hashBytes(aHash, &aChunk[0], aChunkSize);
+        aNbRead += int64_t(aChunkSize);
+    }
+    if(aFile.bad()
+    || aNbRead != aSize) {
+        return StString();
+    }
+
+    char aKey[32];
+    stsprintf(aKey, sizeof(aKey), "%016llx", (unsigned long long )aHash);
+    return StString(aKey);
+}
+
+bool StAssetMeshCache::load(const StString&          theKey,
+                            const Handle(StDocNode)& theParentNode) const {
+    const StString aPath = getFilePath(theKey);
+    StRawFile aRawFile;
+    if(theKey.isEmpty()
+    || myFolder.isEmpty()
+    || !StFileNode::isFileExists(aPath)
+    || !aRawFile.readFile(aPath)) {
+        return false;
+    }
+
+    StCacheReader aReader(aRawFile.getBuffer(), aRawFile.getSize());
+    char aMagic[8];
+    uint32_t aNbMaterials = 0, aNbMeshes = 0;
+    if(!aReader.read(aMagic, sizeof(aMagic))
+    || !stAreEqual(aMagic, THE_CACHE_MAGIC, sizeof(aMagic))
+    || !aReader.readInt(aNbMaterials)
+    || !aReader.readInt(aNbMeshes)) {
+        ST_DEBUG_LOG("StAssetMeshCache, outdated cache file \"" + aPath + "\" is ignored");
+        return false;
+    }
+
+    NCollection_Sequence<Handle(StGLMaterial)> aMaterials;
+    for(uint32_t aMatIter = 0; aMatIter < aNbMaterials; ++aMatIter) {
+        Handle(StGLMaterial) aMat = new StGLMaterial();
+        StGLVec4 aVecs[5];
+        if(!aReader.read(aVecs, sizeof(aVecs))
+        || !aReader.readString(aMat->Name)
+        || !readTexture(aReader, aMat->Texture)) {
+            ST_DEBUG_LOG("StAssetMeshCache, corrupted cache file \"" + aPath + "\" is ignored");
+            return false;
+        }
+        aMat->DiffuseColor  = aVecs[0];
+        aMat->AmbientColor  = aVecs[1];
+        aMat->SpecularColor = aVecs[2];
+        aMat->EmissiveColor = aVecs[3];
+        aMat->Params        = aVecs[4];
+        aMaterials.Append(aMat);
+    }
+
+    NCollection_Sequence<Handle(StDocMeshNode)> aMeshes;
+    for(uint32_t aMeshIter = 0; aMeshIter < aNbMeshes; ++aMeshIter) {
+        Handle(StDocMeshNode) aMesh = new StDocMeshNode();
+        uint32_t aNbOccurrences = 0, aNbPrims = 0;
+        if(!aReader.readInt(aNbOccurrences)
+        || !aReader.readInt(aNbPrims)) {
+            return false;
+        }
+        aMesh->setNbOccurrences(int(aNbOccurrences));
+        for(uint32_t aPrimIter = 0; aPrimIter < aNbPrims; ++aPrimIter) {
+            Handle(StPrimArray) aPrims = new StPrimArray();
+            uint32_t aMatIndex = THE_NO_MATERIAL;
+            if(!aReader.readInt(aMatIndex)
+            || !aReader.readTrsf(aPrims->Trsf)
+            || !aReader.readVector(aPrims->Positions)
+            || !aReader.readVector(aPrims->Normals)
+            || !aReader.readVector(aPrims->TexCoords0)
+            || !aReader.readVector(aPrims->Indices)
+            || (aMatIndex != THE_NO_MATERIAL && aMatIndex >= aNbMaterials)
+            || (!aPrims->Normals.empty()    && aPrims->Normals.size()    != aPrims->Positions.size())
+            || (!aPrims->TexCoords0.empty() && aPrims->TexCoords0.size() != aPrims->Positions.size())) {
+                ST_DEBUG_LOG("StAssetMeshCache, corrupted cache file \"" + aPath + "\" is ignored");
+                return false;
+            }
+
+            // indices are used for rendering as is, thus out of range values should never pass
+            const GLuint aNbNodes = GLuint(aPrims->Positions.size());
+            for(std::vector<GLuint>::const_iterator anIndexIter = aPrims->Indices.begin(); anIndexIter != aPrims->Indices.end(); ++anIndexIter) {
+                if(*anIndexIter >= aNbNodes) {
+                    ST_DEBUG_LOG("StAssetMeshCache, corrupted cache file \"" + aPath + "\" is ignored");
+                    return false;
+                }
+            }
+            if(aMatIndex != THE_NO_MATERIAL) {
+                aPrims->Material = aMaterials.Value(int(aMatIndex) + 1);
+            }
+            aMesh->ChangePrimitiveArrays().Append(aPrims);
+        }
+        aMeshes.Append(aMesh);
+    }
+
+    // read into temporary node to avoid partially filled document on failure
+    Handle(StDocNode) aRoot = new StDocObjectNode();
+    if(!readNodes(aReader, aRoot, aMeshes, 0)) {
+        ST_DEBUG_LOG("StAssetMeshCache, corrupted cache file \"" + aPath + "\" is ignored");
+        return false;
+    }
+    theParentNode->ChangeChildren().Append(aRoot->ChangeChildren());
+
+    // mark entry as recently used
+    StFileNode::touchFile(aPath);
+    return true;
+}
+
+void StAssetMeshCache::trim(const StString& theKeepPath) const {
+    StString aFolderPath = myFolder;
+    if(aFolderPath.isEndsWith(SYS_FS_SPLITTER)) {
+        aFolderPath = aFolderPath.subString(0, aFolderPath.getLength() - 1);
+    }
+
+    StArrayList<StString> anExtensions(1);
+    anExtensions.add(StString("stmesh"));
+    StFolder aFolder(aFolderPath);
+    aFolder.init(anExtensions, 1);
+
+    // entries to remove, starting from the least recently used
+    std::vector< std::pair<int64_t, std::pair<int64_t, StString> > > anEntries;
+    int64_t aTotalSize = 0;
+    for(size_t anItemIter = 0; anItemIter < aFolder.size(); ++anItemIter) {
+        const StString aPath = aFolder.getValue(anItemIter)->getPath();
+        int64_t aSize = 0, aModifTime = 0;
+        if(!StFileNode::getFileStat(aPath, aSize, aModifTime)) {
+            continue;
+        }
+        aTotalSize += aSize;
+        if(aPath != theKeepPath) {
+            anEntries.push_back(std::make_pair(aModifTime, std::make_pair(aSize, aPath)));
+        }
+    }
+    if(aTotalSize <= THE_CACHE_SIZE_MAX) {
+        return;
+    }
+
+    std::sort(anEntries.begin(), anEntries.end());
+    for(size_t anEntryIter = 0; anEntryIter < anEntries.size() && aTotalSize > THE_CACHE_SIZE_MAX; ++anEntryIter) {
+        const StString& aPath = anEntries[anEntryIter].second.second;
+        if(StFileNode::removeFile(aPath)) {
+            ST_DEBUG_LOG("StAssetMeshCache, outdated cache file \"" + aPath + "\" is removed");
+            aTotalSize -= anEntries[anEntryIter].second.first;
+        }
+    }
+}
+
+bool StAssetMeshCache::save(const StString&          theKey,
+                            const Handle(StDocNode)& theParentNode) const {
+    if(theKey.isEmpty()
+    || myFolder.isEmpty()) {
+        return false;
+    }
+
+    NCollection_IndexedMap<Handle(Standard_Transient), TColStd_MapTransientHasher> aMaterials, aMeshes;
+    collectNodes(theParentNode, aMaterials, aMeshes);
+
+    StCacheWriter aWriter;
+    aWriter.append(THE_CACHE_MAGIC, sizeof(THE_CACHE_MAGIC));
+    aWriter.appendInt(uint32_t(aMaterials.Extent()));
+    aWriter.appendInt(uint32_t(aMeshes.Extent()));
+    for(int aMatIter = 1; aMatIter <= aMaterials.Extent(); ++aMatIter) {
+        const Handle(StGLMaterial) aMat = Handle(StGLMaterial)::DownCast(aMaterials.FindKey(aMatIter));
+        const StGLVec4 aVecs[5] = { aMat->DiffuseColor, aMat->AmbientColor, aMat->SpecularColor, aMat->EmissiveColor, aMat->Params };
+        aWriter.append(aVecs, sizeof(aVecs));
+        aWriter.appendString(aMat->Name);
+        if(!writeTexture(aWriter, aMat->Texture)) {
+            ST_DEBUG_LOG("StAssetMeshCache, document with unsupported texture is not cached");
+            return false;
+        }
+    }
+
+    for(int aMeshIter = 1; aMeshIter <= aMeshes.Extent(); ++aMeshIter) {
+        const Handle(StDocMeshNode) aMesh = Handle(StDocMeshNode)::DownCast(aMeshes.FindKey(aMeshIter));
+        aWriter.appendInt(uint32_t(aMesh->nbOccurrences()));
+        aWriter.appendInt(uint32_t(aMesh->PrimitiveArrays().Size()));
+        for(NCollection_Sequence<Handle(StPrimArray)>::Iterator aPrimIter(aMesh->PrimitiveArrays()); aPrimIter.More(); aPrimIter.Next()) {
+            const Handle(StPrimArray)& aPrims = aPrimIter.Value();
+            aWriter.appendInt(!aPrims->Material.IsNull()
+                             ? uint32_t(aMaterials.FindIndex(aPrims->Material) - 1)
+                             : THE_NO_MATERIAL);
+            aWriter.appendTrsf(aPrims->Trsf);
+            aWriter.appendInt(uint32_t(aPrims->Positions.size()));
+            aWriter.appendArray(aPrims->Positions.empty() ? NULL : &aPrims->Positions[0], aPrims->Positions.size() * sizeof(StGLVec3));
+            aWriter.appendInt(uint32_t(aPrims->Normals.size()));
+            aWriter.appendArray(aPrims->Normals.empty() ? NULL : &aPrims->Normals[0], aPrims->Normals.size() * sizeof(StGLVec3));
+            aWriter.appendInt(uint32_t(aPrims->TexCoords0.size()));
+            aWriter.appendArray(aPrims->TexCoords0.empty() ? NULL : &aPrims->TexCoords0[0], aPrims->TexCoords0.size() * sizeof(StGLVec2));
+            aWriter.appendInt(uint32_t(aPrims->Indices.size()));
+            aWriter.appendArray(aPrims->Indices.empty() ? NULL : &aPrims->Indices[0], aPrims->Indices.size() * sizeof(GLuint));
+        }
+    }
+
+    writeNodes(aWriter, theParentNode, aMeshes);
+
+    // write into temporary file first to avoid broken entries on failure
+    const StString aPath    = getFilePath(theKey);
+    const StString aPathTmp = aPath + ".tmp";
+    StRawFile aRawFile;
+    if(!aRawFile.openFile(StRawFile::WRITE, aPathTmp)) {
+        return false;
+    }
+    const std::vector<char>& aData = aWriter.getData();
+    const bool isWritten = aRawFile.write(&aData[0], aData.size()) == aData.size();
+    aRawFile.closeFile();
+    if(!isWritten) {
+        StFileNode::removeFile(aPathTmp);
+        return false;
+    }
+    StFileNode::removeFile(aPath);
+    if(!StFileNode::moveFile(aPathTmp, aPath)) {
+        return false;
+    }
+
+    trim(aPath);
+    return true;
+}
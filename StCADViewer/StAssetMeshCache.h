@@ -0,0 +1,87 @@
+/**
+ * This source is a part of sView program.
+ *
+ * Copyright © Kirill Gavrilov, 2017
+ */
+
+#ifndef __StAssetMeshCache_h_
+#define __StAssetMeshCache_h_
+
+#include "StAssetDocument.h"
+
+/**
+ * Persistent cache of triangulated documents.
+ * The document tree (object and mesh nodes), primitive arrays and materials are stored in binary file
+ * within cache folder, so that reopening the same model does not require reading and meshing it again.
+ *
+ * File is read at once and all blocks are aligned to 4 bytes,
+ * so that vertex arrays are copied from file content into primitive arrays without conversion:
+ * - header:    magic, number of materials, number of meshes;
+ * - materials: 5 colors/parameters vectors, name and texture (URI and image data for textures embedded into another file);
+ * - meshes:    number of occurrences and list of primitive arrays
+ *              (material index, transformation, positions, normals, texture coordinates, indices);
+ * - nodes:     depth-first tree of group records (object nodes) and leaf mesh records referring to meshes by index.
+ * Meshes shared by several nodes (instances) are stored once.
+ */
+class StAssetMeshCache {
+
+        public:
+
+    /**
+     * Main constructor.
+     * @param theFolder cache folder
+     */
+    ST_LOCAL StAssetMeshCache(const StString& theFolder);
+
+    /**
+     * Compute the key identifying the file content and meshing parameters.
+     * The key combines file size and hash of the whole file content.
+     * @param theFile       model file path
+     * @param theDeflection relative deflection used for meshing
+     * @param theAngle      angular deflection used for meshing
+     * @return empty string if file is not accessible
+     */
+    ST_LOCAL static StString computeKey(const StString& theFile,
+                                        const double    theDeflection,
+                                        const double    theAngle);
+
+    /**
+     * Read the cached document.
+     * @param theKey        the key computed by computeKey()
+     * @param theParentNode node to append read nodes
+     * @return false if cache entry does not exist or it is corrupted
+     */
+    ST_LOCAL bool load(const StString&          theKey,
+                       const Handle(StDocNode)& theParentNode) const;
+
+    /**
+     * Write children of specified node into the cache.
+     * Least recently used entries are removed when the cache exceeds the size limit.
+     * Document is not cached if it refers to texture which can not be restored from URI or image data.
+     * @param theKey        the key computed by computeKey()
+     * @param theParentNode node with children to save
+     */
+    ST_LOCAL bool save(const StString&          theKey,
+                       const Handle(StDocNode)& theParentNode) const;
+
+        private:
+
+    /**
+     * @return path to the cache file for specified key
+     */
+    ST_LOCAL StString getFilePath(const StString& theKey) const;
+
+    /**
+     * Remove least recently used entries (by modification time, updated on reading)
+     * to keep the total size of the cache within the limit.
+     * @param theKeepPath the entry which should not be removed
+     */
+    ST_LOCAL void trim(const StString& theKeepPath) const;
+
+        private:
+
+    StString myFolder; //!< cache folder
+
+};
+
+#endif // __StAssetMeshCache_h_
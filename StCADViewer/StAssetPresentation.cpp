@@ -8,6 +8,12 @@
 
 #include <Graphic3d_ArrayOfTriangles.hxx>
 #include <NCollection_IndexedDataMap.hxx>
+#include <NCollection_Vector.hxx>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+    #include <xmmintrin.h>
+    #define ST_HAVE_SSE_TRSF
+#endif
 
 /**
  * Auxiliary structure for grouping primitive arrays by common material.
@@ -33,6 +39,167 @@ struct StPrsPart {
     StPrsPart() : NbNodes(0), NbTris(0), HasTexCoord0(false) {}
 };
 
+namespace {
+
+    /**
+     * Parts with smaller number of nodes are filled within single thread.
+     */
+    static const size_t THE_PARALLEL_TRSF_MIN_NODES = 65536;
+
+    /**
+     * Primitive array with transformation converted to single precision matrices.
+     */
+    struct StTrsfPrimArray {
+        Handle(StPrimArray) PrimArray;
+        float  PosCols[4][4];  //!< columns of 3x4 matrix transforming positions (including scale factor)
+        float  NormCols[4][4]; //!< columns of 3x3 matrix transforming normals (rotation and mirroring)
+        size_t FirstNode;      //!< index of the first node within merged array
+        bool   IsIdentity;     //!< transformation is identity
+
+        StTrsfPrimArray() : FirstNode(0), IsIdentity(true) {}
+
+        StTrsfPrimArray(const Handle(StPrimArray)& thePrimArray,
+                        const gp_Trsf& theTrsf,
+                        const size_t   theFirstNode)
+        : PrimArray(thePrimArray),
+          FirstNode(theFirstNode),
+          IsIdentity(theTrsf.Form() == gp_Identity) {
+            // gp_Dir::Transform() ignores scale factor except its sign
+            const gp_Mat& aRotMat    = theTrsf.HVectorialPart();
+            const double  aNormScale = theTrsf.ScaleFactor() < 0.0 ? -1.0 : 1.0;
+            for(int aCol = 0; aCol < 4; ++aCol) {
+                for(int aRow = 0; aRow < 4; ++aRow) {
+                    PosCols [aCol][aRow] = aRow < 3 ? float(theTrsf.Value(aRow + 1, aCol + 1)) : 0.0f;
+                    NormCols[aCol][aRow] = aRow < 3 && aCol < 3 ? float(aNormScale * aRotMat.Value(aRow + 1, aCol + 1)) : 0.0f;
+                }
+            }
+        }
+    };
+
+    /**
+     * Job filling vertex attributes of merged triangulation.
+     * Nodes are split into ranges, each written by single thread, so that result is independent from number of threads.
+     */
+    class StTransformJob : public StThreadPool::Job {
+
+            public:
+
+        StTransformJob(const Handle(Graphic3d_Buffer)&           theAttribs,
+                       const NCollection_Vector<StTrsfPrimArray>& theArrays,
+                       const size_t                               theNbNodes,
+                       const bool                                 theHasTexCoord0)
+        : myData(theAttribs->ChangeData()),
+          myStride(theAttribs->Stride),
+          myNormOffset(theAttribs->AttributeOffset(1)),
+          myTexCoordOffset(theHasTexCoord0 ? theAttribs->AttributeOffset(2) : 0),
+          myArrays(theArrays),
+          myNbNodes(theNbNodes),
+          myHasTexCoord0(theHasTexCoord0) {}
+
+        virtual void perform(const size_t theChunk,
+                             const size_t theNbChunks) ST_ATTR_OVERRIDE {
+            const size_t aNodeFrom = myNbNodes *  theChunk      / theNbChunks;
+            const size_t aNodeTo   = myNbNodes * (theChunk + 1) / theNbChunks;
+            for(NCollection_Vector<StTrsfPrimArray>::Iterator anArrayIter(myArrays); anArrayIter.More(); anArrayIter.Next()) {
+                const StTrsfPrimArray& anArray = anArrayIter.Value();
+                const size_t aNbPrimNodes = anArray.PrimArray->Positions.size();
+                const size_t aFrom = stMax(aNodeFrom, anArray.FirstNode);
+                const size_t aTo   = stMin(aNodeTo,   anArray.FirstNode + aNbPrimNodes);
+                if(aFrom < aTo) {
+                    fillNodes(anArray, aFrom - anArray.FirstNode, aTo - anArray.FirstNode);
+                }
+            }
+        }
+
+            private:
+
+        /**
+         * Fill the range of nodes of specified primitive array.
+         */
+        void fillNodes(const StTrsfPrimArray& theArray,
+                       const size_t theFrom,
+                       const size_t theTo) {
+            const StPrimArray& aPrims = *theArray.PrimArray;
+            Standard_Byte* aNodeData = myData + myStride * (theArray.FirstNode + theFrom);
+            if(theArray.IsIdentity) {
+                for(size_t aNodeIter = theFrom; aNodeIter < theTo; ++aNodeIter, aNodeData += myStride) {
+                    *(StGLVec3* )aNodeData                  = aPrims.Positions[aNodeIter];
+                    *(StGLVec3* )(aNodeData + myNormOffset) = aPrims.Normals  [aNodeIter];
+                }
+            } else {
+            #if defined(ST_HAVE_SSE_TRSF)
+                const __m128 aPosCols[4] = {
+                    _mm_loadu_ps(theArray.PosCols[0]), _mm_loadu_ps(theArray.PosCols[1]),
+                    _mm_loadu_ps(theArray.PosCols[2]), _mm_loadu_ps(theArray.PosCols[3])
+                };
+                const __m128 aNormCols[3] = {
+                    _mm_loadu_ps(theArray.NormCols[0]), _mm_loadu_ps(theArray.NormCols[1]), _mm_loadu_ps(theArray.NormCols[2])
+                };
+            #endif
+                for(size_t aNodeIter = theFrom; aNodeIter < theTo; ++aNodeIter, aNodeData += myStride) {
+                    const StGLVec3& aPos  = aPrims.Positions[aNodeIter];
+                    const StGLVec3& aNorm = aPrims.Normals  [aNodeIter];
+                    StGLVec3& aPosTrsf  = *(StGLVec3* )aNodeData;
+                    StGLVec3& aNormTrsf = *(StGLVec3* )(aNodeData + myNormOffset);
+                #if defined(ST_HAVE_SSE_TRSF)
+                    const __m128 aPosRes = _mm_add_ps(_mm_add_ps(_mm_mul_ps(aPosCols[0], _mm_set1_ps(aPos.x())),
+                                                                 _mm_mul_ps(aPosCols[1], _mm_set1_ps(aPos.y()))),
+                                                      _mm_add_ps(_mm_mul_ps(aPosCols[2], _mm_set1_ps(aPos.z())),
+                                                                 aPosCols[3]));
+                    const __m128 aNormRes = _mm_add_ps(_mm_add_ps(_mm_mul_ps(aNormCols[0], _mm_set1_ps(aNorm.x())),
+                                                                  _mm_mul_ps(aNormCols[1], _mm_set1_ps(aNorm.y()))),
+                                                                  _mm_mul_ps(aNormCols[2], _mm_set1_ps(aNorm.z())));
+                    GLfloat* aPosOut  = aPosTrsf;
+                    GLfloat* aNormOut = aNormTrsf;
+                    _mm_storel_pi((__m64* )aPosOut,  aPosRes);
+                    _mm_store_ss (aPosOut + 2,       _mm_movehl_ps(aPosRes, aPosRes));
+                    _mm_storel_pi((__m64* )aNormOut, aNormRes);
+                    _mm_store_ss (aNormOut + 2,      _mm_movehl_ps(aNormRes, aNormRes));
+                #else
+                    const float (*aPosCols)[4]  = theArray.PosCols;
+                    const float (*aNormCols)[4] = theArray.NormCols;
+                    for(int aRow = 0; aRow < 3; ++aRow) {
+                        aPosTrsf[aRow]  = aPosCols[0][aRow] * aPos.x()  + aPosCols[1][aRow] * aPos.y()  + aPosCols[2][aRow] * aPos.z() + aPosCols[3][aRow];
+                        aNormTrsf[aRow] = aNormCols[0][aRow] * aNorm.x() + aNormCols[1][aRow] * aNorm.y() + aNormCols[2][aRow] * aNorm.z();
+                    }
+                #endif
+                    // rotation keeps the length, but input normals might be not normalized
+                    if(aNormTrsf.modulus() != 0.0f) {
+                        aNormTrsf.normalize();
+                    }
+                }
+            }
+
+            if(!myHasTexCoord0) {
+                return;
+            }
+
+            aNodeData = myData + myStride * (theArray.FirstNode + theFrom) + myTexCoordOffset;
+            if(aPrims.TexCoords0.size() == aPrims.Positions.size()) {
+                for(size_t aNodeIter = theFrom; aNodeIter < theTo; ++aNodeIter, aNodeData += myStride) {
+                    *(StGLVec2* )aNodeData = aPrims.TexCoords0[aNodeIter];
+                }
+            } else {
+                for(size_t aNodeIter = theFrom; aNodeIter < theTo; ++aNodeIter, aNodeData += myStride) {
+                    *(StGLVec2* )aNodeData = StGLVec2(0.0f, 0.0f);
+                }
+            }
+        }
+
+            private:
+
+        Standard_Byte*                             myData;
+        size_t                                     myStride;
+        size_t                                     myNormOffset;
+        size_t                                     myTexCoordOffset;
+        const NCollection_Vector<StTrsfPrimArray>& myArrays;
+        size_t                                     myNbNodes;
+        bool                                       myHasTexCoord0;
+
+    };
+
+}
+
 void StAssetPresentation::Compute (const Handle(PrsMgr_PresentationManager3d)& thePrsMgr,
                                    const Handle(Prs3d_Presentation)& thePrs,
                                    const int theMode) {
@@ -61,48 +228,30 @@ void StAssetPresentation::Compute (const Handle(PrsMgr_PresentationManager3d)& t
     for(NCollection_IndexedDataMap<Handle(StGLMaterial), StPrsPart, StGLMaterial>::Iterator aStyleIter(aStyleMap); aStyleIter.More(); aStyleIter.Next()) {
         const StPrsPart& aPrsPart = aStyleIter.Value();
         Handle(Graphic3d_ArrayOfTriangles) aTris = new Graphic3d_ArrayOfTriangles(int(aPrsPart.NbNodes), int(aPrsPart.NbTris * 3), true, false, aPrsPart.HasTexCoord0);
+        NCollection_Vector<StTrsfPrimArray> aTrsfArrays;
+        size_t aNbNodes = 0;
         for(NCollection_Sequence<StLocatedPrimArray>::Iterator aPrimIter(aPrsPart.PrimArrays); aPrimIter.More(); aPrimIter.Next()) {
             const Handle(StPrimArray)& aPrims = aPrimIter.Value().PrimArray;
-            const gp_Trsf& aMeshTrsf = aPrimIter.Value().NodeTrsf;
-
-            const int aLowerVertex = aTris->VertexNumber() + 1;
-
-            const size_t aNbPrimNodes = aPrims->Positions.size();
-            const gp_Trsf aTrsf = aMeshTrsf * aPrims->Trsf;
-            if(aTrsf.Form() != gp_Identity) {
-                for(size_t aNodeIter = 0; aNodeIter < aNbPrimNodes; ++aNodeIter) {
-                    const StGLVec3& aPos = aPrims->Positions[aNodeIter];
-                    StGLVec3 aNorm = aPrims->Normals[aNodeIter];
-                    if(aNorm.modulus() != 0.0f) {
-                        gp_Dir aNormTrsf(aNorm.x(), aNorm.y(), aNorm.z());
-                        aNormTrsf.Transform(aTrsf);
-                        aNorm.x() = (float )aNormTrsf.X();
-                        aNorm.y() = (float )aNormTrsf.Y();
-                        aNorm.z() = (float )aNormTrsf.Z();
-                    }
-
-                    gp_Pnt aPosTrsf(aPos.x(),  aPos.y(),  aPos.z());
-                    aPosTrsf.Transform(aTrsf);
-                    aTris->AddVertex((float )aPosTrsf.X(), (float )aPosTrsf.Y(), (float )aPosTrsf.Z(),
-                                     aNorm.x(), aNorm.y(), aNorm.z());
-                }
-            } else {
-                for(size_t aNodeIter = 0; aNodeIter < aNbPrimNodes; ++aNodeIter) {
-                    const StGLVec3& aPos  = aPrims->Positions[aNodeIter];
-                    const StGLVec3& aNorm = aPrims->Normals  [aNodeIter];
-                    aTris->AddVertex(aPos.x(),  aPos.y(),  aPos.z(),
-                                     aNorm.x(), aNorm.y(), aNorm.z());
-                }
-            }
+            aTrsfArrays.Append(StTrsfPrimArray(aPrims, aPrimIter.Value().NodeTrsf * aPrims->Trsf, aNbNodes));
+            aNbNodes += aPrims->Positions.size();
+        }
 
-            if(aPrsPart.HasTexCoord0
-            && aPrims->TexCoords0.size() == aPrims->Positions.size()) {
-                for(size_t aNodeIter = 0; aNodeIter < aNbPrimNodes; ++aNodeIter) {
-                    const StGLVec2& aTexCoord = aPrims->TexCoords0[aNodeIter];
-                    aTris->SetVertexTexel(aLowerVertex + int(aNodeIter), aTexCoord.x(), aTexCoord.y());
-                }
-            }
+        // vertex attributes are written directly into the buffer, split between worker threads for large parts
+        const Handle(Graphic3d_Buffer)& anAttribs = aTris->Attributes();
+        anAttribs->NbElements = int(aNbNodes);
+        StTransformJob aJob(anAttribs, aTrsfArrays, aNbNodes, aPrsPart.HasTexCoord0);
+        const size_t aNbChunks = (!myThreadPool.isNull() && aNbNodes >= THE_PARALLEL_TRSF_MIN_NODES)
+                               ? myThreadPool->getNbThreads()
+                               : 1;
+        if(aNbChunks > 1) {
+            myThreadPool->perform(aJob, aNbChunks);
+        } else {
+            aJob.perform(0, 1);
+        }
 
+        for(NCollection_Vector<StTrsfPrimArray>::Iterator anArrayIter(aTrsfArrays); anArrayIter.More(); anArrayIter.Next()) {
+            const Handle(StPrimArray)& aPrims = anArrayIter.Value().PrimArray;
+            const int aLowerVertex = int(anArrayIter.Value().FirstNode) + 1;
             const size_t aNbPrimIndices = aPrims->Indices.size();
             for(size_t anIndexIter = 0; anIndexIter < aNbPrimIndices; ++anIndexIter) {
                 aTris->AddEdge(aLowerVertex + aPrims->Indices[anIndexIter]);
@@ -11,6 +11,8 @@
 
 #include <AIS_InteractiveObject.hxx>
 
+#include <StThreads/StThreadPool.h>
+
 /**
  * Document node with cumulative transformation (including parent nodes).
  */
@@ -31,7 +33,12 @@ class StAssetPresentation : public AIS_InteractiveObject {
 
         public:
 
-    StAssetPresentation() {
+    /**
+     * Main constructor.
+     * @param theThreadPool optional thread pool to transform vertices of large parts in parallel
+     */
+    StAssetPresentation(const StHandle<StThreadPool>& theThreadPool = StHandle<StThreadPool>())
+    : myThreadPool(theThreadPool) {
         SetDisplayMode(0);
     }
 
@@ -52,6 +59,7 @@ class StAssetPresentation : public AIS_InteractiveObject {
         protected:
 
     NCollection_Sequence<StDocLocatedMeshNode> myDocNodes;
+    StHandle<StThreadPool>                     myThreadPool; //!< workers for filling vertex attributes
 
 };
 
@@ -8,6 +8,7 @@
 #define __StAssetTexture_h_
 
 #include <Graphic3d_Texture2Dmanual.hxx>
+#include <NCollection_Buffer.hxx>
 
 #include <StStrings/StString.h>
 
@@ -36,6 +37,21 @@ class StAssetTexture : public Graphic3d_Texture2Dmanual {
      */
     ST_LOCAL virtual Handle(Image_PixMap) GetImage() const Standard_OVERRIDE;
 
+    /**
+     * Return image URI.
+     */
+    const StString& getImageUri() const { return myImageUri; }
+
+    /**
+     * Read encoded image data embedded into another file (not accessible by URI alone).
+     * @param theMime [out] image MIME type
+     * @return NULL for standalone image file referred by URI
+     */
+    virtual Handle(NCollection_Buffer) readEmbeddedData(StString& theMime) const {
+        (void )theMime;
+        return Handle(NCollection_Buffer)();
+    }
+
     /**
      * Compare with another texture.
      */
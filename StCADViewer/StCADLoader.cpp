@@ -19,20 +19,40 @@
 #include <StStrings/StLangMap.h>
 #include <StFile/StRawFile.h>
 
+#include <AIS_MultipleConnectedInteractive.hxx>
+#include <NCollection_IndexedDataMap.hxx>
+#include <Standard_Failure.hxx>
+
+namespace {
+
+    /**
+     * Minimal number of occurrences of the same mesh to display it through instances
+     * instead of merging transformed copies into common presentation.
+     * Each instance costs extra draw calls, so that only really repeated parts (like fasteners) are worth it.
+     */
+    static const int THE_MIN_INSTANCES = 4;
+
+}
+
 const StString StCADLoader::ST_CAD_MIME_STRING(ST_CAD_PLUGIN_MIME_CHAR);
 const StMIMEList StCADLoader::ST_CAD_MIME_LIST(StCADLoader::ST_CAD_MIME_STRING);
 const StArrayList<StString> StCADLoader::ST_CAD_EXTENSIONS_LIST(StCADLoader::ST_CAD_MIME_LIST.getExtensionsList());
 
 StCADLoader::StCADLoader(const StHandle<StLangMap>&  theLangMap,
                          const StHandle<StPlayList>& thePlayList,
+                         const StString&             theCacheFolder,
                          const bool                  theToStartThread)
 : myLangMap(theLangMap),
   myPlayList(thePlayList),
+  myCacheFolder(theCacheFolder),
   myEvLoadNext(false),
   myDefaultMat(Graphic3d_NOM_SILVER),
   myIsLoaded(false),
+  myIsFailed(false),
+  myToReset(false),
   myToQuit(false) {
     myPlayList->setExtensions(ST_CAD_EXTENSIONS_LIST);
+    myThreadPool = new StThreadPool();
     if(theToStartThread) {
         myThread = new StThread(threadFunction, (void* )this);
     }
@@ -60,55 +80,139 @@ bool StCADLoader::loadModel(const StHandle<StFileNode>& theSource) {
       isGltf = StAssetImportGltf::probeFormatFromHeader((const char* )aRawFile.getBuffer(), anExt);
     }
 
-    myDoc = new StAssetDocument();
+    myResultLock.lock();
+        myPrsList.Clear();
+        myDoc.Nullify();
+        myIsLoaded = false;
+        myIsFailed = false;
+        myToReset  = true;
+    myResultLock.unlock();
+    myPrototypes.Clear();
+
+    Handle(StAssetDocument) aDoc = new StAssetDocument();
     bool isRead = false;
     if(isGltf) {
         StAssetImportGltf aReader;
         aReader.signals.onError.connect(this, &StCADLoader::doOnErrorRedirect);
-        isRead = aReader.load(myDoc, aFileToLoadPath);
+        isRead = aReader.load(aDoc, aFileToLoadPath);
+        if(isRead) {
+            doSubtreeLoaded(aDoc, gp_Trsf());
+        }
     } else {
+        // presentations are published as soon as subtrees of the document are meshed
         StAssetImportShape aReader;
+        aReader.setCacheFolder(myCacheFolder);
+        aReader.setThreadPool(myThreadPool);
         aReader.signals.onError.connect(this, &StCADLoader::doOnErrorRedirect);
-        isRead = aReader.load(myDoc, aFileToLoadPath, aShapeFormat);
+        aReader.signals.onSubtreeLoaded.connect(this, &StCADLoader::doSubtreeLoaded);
+        try {
+            isRead = aReader.load(aDoc, aFileToLoadPath, aShapeFormat);
+        } catch(Standard_Failure theFailure) {
+            signals.onError(StString() + "Can not load model from file\n\"" + aFileToLoadPath + "\"\nexception raised [" + theFailure.GetMessageString() + "]");
+            isRead = false;
+        }
     }
+    myPrototypes.Clear();
 
+    // hand over the complete document;
+    // partially imported one is discarded together with already published presentations
+    myResultLock.lock();
+        if(isRead) {
+            myDoc = aDoc;
+            myIsLoaded = true;
+        } else {
+            myPrsList.Clear();
+            myIsFailed = true;
+            myToReset  = true;
+        }
+    myResultLock.unlock();
+    return isRead;
+}
+
+void StCADLoader::doSubtreeLoaded(const Handle(StDocNode)& theNode,
+                                  const gp_Trsf&           theParentTrsf) {
+    const gp_Trsf aNodeTrsf = theParentTrsf * theNode->nodeTransformation();
+
+    // collect occurrences of the same mesh within the subtree
+    const NCollection_Sequence<gp_Trsf> anEmptySeq;
+    NCollection_IndexedDataMap<Handle(Standard_Transient), NCollection_Sequence<gp_Trsf> > aMeshMap;
+    for(StAssetNodeIterator aMeshNodeIter(theNode, StDocNodeType_Mesh); aMeshNodeIter.more(); aMeshNodeIter.next()) {
+        const int anIndex = aMeshMap.Add(aMeshNodeIter.value(), anEmptySeq);
+        aMeshMap.ChangeFromIndex(anIndex).Append(aNodeTrsf * aMeshNodeIter.location());
+    }
+
+    // unique meshes are merged into single presentation,
+    // while repeated ones share the geometry computed once in local coordinate system
+    // (also with instances published by previous subtrees);
+    // the decision relies on occurrences within the whole document when they are known,
+    // so that part repeated across different subtrees is instanced in each of them
     NCollection_Sequence<Handle(AIS_InteractiveObject)> aPrsList;
-    if(isRead) {
-        Handle(StAssetPresentation) aShapePrs = new StAssetPresentation();
-        for(StAssetNodeIterator aMeshNodeIter(myDoc, StDocNodeType_Mesh); aMeshNodeIter.more(); aMeshNodeIter.next()) {
-            Handle(StDocMeshNode) aMeshNode = Handle(StDocMeshNode)::DownCast(aMeshNodeIter.value());
-            aShapePrs->AddMeshNode(aMeshNode, aMeshNodeIter.location());
+    Handle(StAssetPresentation) aShapePrs = new StAssetPresentation(myThreadPool);
+    bool hasMerged = false;
+    for(int aMeshIter = 1; aMeshIter <= aMeshMap.Extent(); ++aMeshIter) {
+        const Handle(Standard_Transient)& aMeshKey = aMeshMap.FindKey(aMeshIter);
+        Handle(StDocMeshNode) aMeshNode = Handle(StDocMeshNode)::DownCast(aMeshKey);
+        const NCollection_Sequence<gp_Trsf>& aLocations = aMeshMap.FindFromIndex(aMeshIter);
+        Handle(AIS_InteractiveObject) aPartPrs;
+        const int aNbOccurrences = aMeshNode->nbOccurrences() > aLocations.Size()
+                                 ? aMeshNode->nbOccurrences()
+                                 : aLocations.Size();
+        if(!myPrototypes.Find(aMeshKey, aPartPrs)
+        && aNbOccurrences < THE_MIN_INSTANCES) {
+            for(NCollection_Sequence<gp_Trsf>::Iterator aLocIter(aLocations); aLocIter.More(); aLocIter.Next()) {
+                aShapePrs->AddMeshNode(aMeshNode, aLocIter.Value());
+            }
+            hasMerged = true;
+            continue;
         }
-        aPrsList.Append(aShapePrs);
+
+        if(aPartPrs.IsNull()) {
+            Handle(StAssetPresentation) aNewPartPrs = new StAssetPresentation(myThreadPool);
+            aNewPartPrs->AddMeshNode(aMeshNode, gp_Trsf());
+            aPartPrs = aNewPartPrs;
+            myPrototypes.Bind(aMeshKey, aPartPrs);
+        }
+        Handle(AIS_MultipleConnectedInteractive) anInstances = new AIS_MultipleConnectedInteractive();
+        for(NCollection_Sequence<gp_Trsf>::Iterator aLocIter(aLocations); aLocIter.More(); aLocIter.Next()) {
+            anInstances->Connect(aPartPrs, aLocIter.Value());
+        }
+        aPrsList.Append(anInstances);
+    }
+    if(hasMerged) {
+        aPrsList.Prepend(aShapePrs);
     }
 
-    // setup new output shape
-    myResultLock.lock();
-        const bool isEmpty = aPrsList.IsEmpty();
-        myPrsList.Assign(aPrsList);
-        aPrsList.Clear();
-        myIsLoaded = true;
-    myResultLock.unlock();
-    return !isEmpty;
+    if(!aPrsList.IsEmpty()) {
+        myResultLock.lock();
+            myPrsList.Append(aPrsList);
+        myResultLock.unlock();
+    }
 }
 
 bool StCADLoader::getNextDoc(NCollection_Sequence<Handle(AIS_InteractiveObject)>& thePrsList,
-                             Handle(StAssetDocument)& theDoc) {
+                             Handle(StAssetDocument)& theDoc,
+                             bool&                    theToReset,
+                             bool&                    theIsFailed) {
     if(!myResultLock.tryLock()) {
         return false;
     }
 
-    bool hasNewShape = false;
+    const bool hasChanges = myToReset
+                        || myIsLoaded
+                        || myIsFailed
+                        || !myPrsList.IsEmpty();
+    theToReset  = myToReset;
+    theIsFailed = myIsFailed;
+    thePrsList.Append(myPrsList);
     if(myIsLoaded) {
-        thePrsList.Append(myPrsList);
         theDoc = myDoc;
-        myPrsList.Clear();
         myDoc.Nullify();
-        hasNewShape = true;
         myIsLoaded = false;
     }
+    myToReset  = false;
+    myIsFailed = false;
     myResultLock.unlock();
-    return hasNewShape;
+    return hasChanges;
 }
 
 void StCADLoader::mainLoop() {
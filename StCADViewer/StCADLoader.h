@@ -12,6 +12,7 @@
 #endif
 
 #include <AIS_InteractiveObject.hxx>
+#include <NCollection_DataMap.hxx>
 #include <NCollection_Sequence.hxx>
 
 #include <StStrings/StString.h>
@@ -36,6 +37,7 @@ class StCADLoader {
 
     ST_LOCAL StCADLoader(const StHandle<StLangMap>&  theLangMap,
                          const StHandle<StPlayList>& thePlayList,
+                         const StString&             theCacheFolder,
                          const bool                  theToStartThread = true);
     ST_LOCAL virtual ~StCADLoader();
 
@@ -45,8 +47,20 @@ class StCADLoader {
         myEvLoadNext.set();
     }
 
+    /**
+     * Retrieve presentations published since the previous call.
+     * Presentations are published progressively while the model is being loaded (largest parts first).
+     * @param thePrsList new presentations to display
+     * @param theDoc     the document, returned only when loading has been completed
+     * @param theToReset flag indicating that loading of another model has been started,
+     *                   so that previously displayed presentations should be removed
+     * @param theIsFailed flag indicating that loading has failed and nothing has been published
+     * @return true if any of output values has been changed
+     */
     ST_LOCAL virtual bool getNextDoc(NCollection_Sequence<Handle(AIS_InteractiveObject)>& thePrsList,
-                                     Handle(StAssetDocument)& theDoc);
+                                     Handle(StAssetDocument)& theDoc,
+                                     bool&                    theToReset,
+                                     bool&                    theIsFailed);
 
         public:  //!< Signals
 
@@ -62,6 +76,14 @@ class StCADLoader {
 
     ST_LOCAL virtual bool loadModel(const StHandle<StFileNode>& theSource);
 
+    /**
+     * Create presentations for the loaded subtree of the document and publish them.
+     * @param theNode       subtree root
+     * @param theParentTrsf location of the parent node
+     */
+    ST_LOCAL void doSubtreeLoaded(const Handle(StDocNode)& theNode,
+                                  const gp_Trsf&           theParentTrsf);
+
     /**
      * Just redirect callback slot.
      */
@@ -80,12 +102,18 @@ class StCADLoader {
     StHandle<StThread>   myThread;
     StHandle<StLangMap>  myLangMap;
     StHandle<StPlayList> myPlayList;
+    StString             myCacheFolder; //!< folder for caching triangulated documents
+    StHandle<StThreadPool> myThreadPool; //!< workers for computing presentations of large parts
     StCondition          myEvLoadNext;
     Handle(StAssetDocument) myDoc;
     NCollection_Sequence<Handle(AIS_InteractiveObject)> myPrsList;
+    NCollection_DataMap<Handle(Standard_Transient), Handle(AIS_InteractiveObject)>
+                         myPrototypes; //!< shared presentations of instanced meshes within currently loaded model
     Graphic3d_MaterialAspect myDefaultMat;
     StMutex              myResultLock;
     volatile bool        myIsLoaded;
+    volatile bool        myIsFailed;   //!< loading of the model has failed
+    volatile bool        myToReset;    //!< loading of new model has been started
     volatile bool        myToQuit;
 
 };
@@ -65,7 +65,8 @@ StCADViewer::StCADViewer(const StHandle<StResourceManager>& theResMgr,
   myIsLeftHold(false),
   myIsRightHold(false),
   myIsMiddleHold(false),
-  myIsCtrlPressed(false) {
+  myIsCtrlPressed(false),
+  myToFitAll(false) {
     mySettings = new StSettings(myResMgr, ST_DRAWER_PLUGIN_NAME);
     myLangMap  = new StTranslations(myResMgr, ST_DRAWER_PLUGIN_NAME);
     StCADViewerStrings::loadDefaults(*myLangMap);
@@ -432,7 +433,7 @@ bool StCADViewer::init() {
 
     // create working threads
     if(!isReset) {
-        myCADLoader = new StCADLoader(myLangMap, myPlayList);
+        myCADLoader = new StCADLoader(myLangMap, myPlayList, myResMgr->getCacheFolder());
         myCADLoader->signals.onError = stSlot(myMsgQueue.access(), &StMsgQueue::doPushError);
     }
 
@@ -779,14 +780,33 @@ void StCADViewer::beforeDraw() {
 
     if(!myAisContext.IsNull()) {
         NCollection_Sequence<Handle(AIS_InteractiveObject)> aNewPrsList;
-        if(myCADLoader->getNextDoc(aNewPrsList, myDoc)) {
-            myAisContext->RemoveAll(false);
+        Handle(StAssetDocument) aNewDoc;
+        bool toReset  = false;
+        bool isFailed = false;
+        if(myCADLoader->getNextDoc(aNewPrsList, aNewDoc, toReset, isFailed)) {
+            if(toReset) {
+                myAisContext->RemoveAll(false);
+                myDoc.Nullify();
+                myToFitAll = true;
+            }
             for(NCollection_Sequence<Handle(AIS_InteractiveObject)>::Iterator aPrsIter(aNewPrsList); aPrsIter.More(); aPrsIter.Next()) {
                 myAisContext->Display(aPrsIter.Value(), aPrsIter.Value()->DisplayMode(), -1, false);
             }
 
-            doFitAll();
-            doUpdateStateLoaded(!aNewPrsList.IsEmpty());
+            // fit the first published (largest) parts and the complete model
+            if(!aNewPrsList.IsEmpty() && myToFitAll) {
+                doFitAll();
+                myToFitAll = false;
+            }
+            if(!aNewDoc.IsNull()) {
+                myDoc = aNewDoc;
+                AIS_ListOfInteractive aDisplayed;
+                myAisContext->DisplayedObjects(aDisplayed);
+                doFitAll();
+                doUpdateStateLoaded(!aDisplayed.IsEmpty());
+            } else if(isFailed) {
+                doUpdateStateLoaded(false);
+            }
         }
     }
 
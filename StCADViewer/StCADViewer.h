@@ -238,6 +238,7 @@ class StCADViewer : public StApplication {
     bool                     myIsRightHold;
     bool                     myIsMiddleHold;
     bool                     myIsCtrlPressed;
+    bool                     myToFitAll;      //!< fit view on first presentations of progressively loaded model
 
     Handle(V3d_Viewer)             myViewer;     //!< main viewer
     Handle(V3d_View)               myView;       //!< main view
@@ -14,6 +14,7 @@
 
 #include <StCore/StApplication.h>
 #include <StCore/StSearchMonitors.h>
+#include <StImage/StImageBufferPool.h>
 #include <StTemplates/StHandle.h>
 #include <StThreads/StThread.h>
 #include <StStrings/StLogger.h>
@@ -320,6 +321,11 @@ void StAndroidGlue::fetchState(StString&             theNewFile,
     }
 }
 
+void StAndroidGlue::fetchOrientation(StQuaternion<double>& theQuaternion) {
+    StMutexAuto aLock(myFetchLock);
+    theQuaternion = myQuaternion;
+}
+
 int StAndroidGlue::openFileDescriptor(const StString& thePath) {
     if(myJavaVM == NULL) {
         return -1;
@@ -701,6 +707,11 @@ void StAndroidGlue::processCommand() {
             myToDestroy = true;
             break;
         }
+        case CommandId_LowMemory: {
+            // return cached frame buffers to the system
+            StImageBufferPool::GetDefault().trim();
+            break;
+        }
     }
 
     signals.onAppCmd(aCmd);
@@ -1,6 +1,6 @@
 /**
  * StCore, window system independent C++ toolkit for writing OpenGL applications.
- * Copyright © 2007-2013 Kirill Gavrilov <kirill@sview.ru>
+ * Copyright © 2007-2017 Kirill Gavrilov <kirill@sview.ru>
  *
  * Distributed under the Boost Software License, Version 1.0.
  * See accompanying file license-boost.txt or copy at
@@ -11,21 +11,25 @@
 #define __StEventsBuffer_h_
 
 #include <StCore/StEvent.h>
+#include <StThreads/StAtomicOp.h>
 
 /**
- * Double buffer for StWindow callback events.
- * One buffer is read-only (could be read by StWindow thread without lock)
- * and another one is write-only (access is protected by mutex).
- * Swap method reverse buffers mission.
+ * Lock-free buffer for StWindow callback events.
+ * Events are appended by any number of threads into bounded ring without locks
+ * and fetched by single consumer thread (StWindow thread) in swapBuffers().
+ * Fetched events are stored in read-only buffer which could be read by consumer thread till next swap.
  *
- * Current implementation is lossy - buffers created with limited size
+ * Consecutive events carrying absolute state (window size, touches moving) are coalesced while fetching,
+ * so that consumer processes only the latest state.
+ *
+ * Current implementation is lossy - ring is created with limited size
  * and if not swaped in time, new events will be lost.
  */
 class StEventsBuffer {
 
         public:
 
-    static const size_t BUFFER_SIZE = 2048U;
+    static const size_t BUFFER_SIZE = 2048U; //!< ring size, should be power of 2
 
         public:
 
@@ -33,11 +37,14 @@ class StEventsBuffer {
      * Create empty buffer.
      */
     ST_LOCAL StEventsBuffer()
-    : myEventsRead (new StEvent[BUFFER_SIZE]),
-      myEventsWrite(new StEvent[BUFFER_SIZE]),
-      mySizeRead (0),
-      mySizeWrite(0) {
-        //
+    : mySlots(new Slot[BUFFER_SIZE]),
+      myEventsRead(new StEvent[BUFFER_SIZE]),
+      mySizeRead(0),
+      myEnqueuePos(0),
+      myDequeuePos(0) {
+        for(size_t aSlotIter = 0; aSlotIter < BUFFER_SIZE; ++aSlotIter) {
+            mySlots[aSlotIter].Sequence = uint32_t(aSlotIter);
+        }
     }
 
     /**
@@ -46,18 +53,19 @@ class StEventsBuffer {
     ST_LOCAL ~StEventsBuffer() {
         // release dynamically allocated resources
         swapBuffers();
+        releaseReadEvents();
+        delete[] mySlots;
         delete[] myEventsRead;
-        delete[] myEventsWrite;
     }
 
     /**
      * Reset both buffers.
+     * Should be called only by consumer thread.
      */
     ST_LOCAL void reset() {
-        StMutexAuto aLock(myMutex);
         swapBuffers();
-        mySizeRead  = 0;
-        mySizeWrite = 0;
+        releaseReadEvents();
+        mySizeRead = 0;
     }
 
     /**
@@ -84,51 +92,134 @@ class StEventsBuffer {
     }
 
     /**
-     * Append one more event to the write buffer.
+     * Append one more event to the ring.
+     * Can be called from any thread.
      */
     ST_LOCAL void append(const StEvent& theEvent) {
-        StMutexAuto aLock(myMutex);
-        if(mySizeWrite >= BUFFER_SIZE) {
-            return;
+        uint32_t aPos  = myEnqueuePos;
+        Slot*    aSlot = NULL;
+        for(;;) {
+            aSlot = &mySlots[aPos & (BUFFER_SIZE - 1)];
+            const uint32_t aSeq = aSlot->Sequence;
+            StAtomicOp::Barrier();
+            const int32_t aDiff = int32_t(aSeq - aPos);
+            if(aDiff == 0) {
+                // slot is free - try to reserve it
+                if(StAtomicOp::CompareAndSwap(myEnqueuePos, aPos, aPos + 1)) {
+                    break;
+                }
+            } else if(aDiff < 0) {
+                // ring is full
+                return;
+            }
+            aPos = myEnqueuePos;
         }
 
-        StEvent& anEvent = myEventsWrite[mySizeWrite++];
-        anEvent = theEvent;
-        if(theEvent.Type == stEvent_FileDrop) {
-            if(theEvent.DNDrop.NbFiles == 0) {
-                anEvent.DNDrop.Files = NULL;
-                return;
+        copyEvent(aSlot->Event, theEvent);
+
+        // publish the event
+        StAtomicOp::Barrier();
+        aSlot->Sequence = aPos + 1;
+    }
+
+    /**
+     * Fetch events appended since previous call into read-only buffer.
+     * Should be called only by consumer thread.
+     */
+    ST_LOCAL void swapBuffers() {
+        releaseReadEvents();
+        mySizeRead = 0;
+
+        // fetch only events reserved before this call - producers may refill released slots meanwhile,
+        // and read-only buffer should never receive more than BUFFER_SIZE events
+        const uint32_t aLastPos = myEnqueuePos;
+        StAtomicOp::Barrier();
+        for(; myDequeuePos != aLastPos && mySizeRead < BUFFER_SIZE;) {
+            Slot& aSlot = mySlots[myDequeuePos & (BUFFER_SIZE - 1)];
+            const uint32_t aSeq = aSlot.Sequence;
+            StAtomicOp::Barrier();
+            if(int32_t(aSeq - (myDequeuePos + 1)) < 0) {
+                // no more published events
+                break;
             }
 
-            // make a copy in C-style
-            anEvent.DNDrop.Files = stMemAlloc<const char**>(sizeof(const char* ) * theEvent.DNDrop.NbFiles);
-            if(anEvent.DNDrop.Files == NULL) {
-                anEvent.DNDrop.NbFiles = 0;
+            pushRead(aSlot.Event);
+
+            // release the slot for the next round
+            StAtomicOp::Barrier();
+            aSlot.Sequence = myDequeuePos + uint32_t(BUFFER_SIZE);
+            ++myDequeuePos;
+        }
+    }
+
+        private:
+
+    /**
+     * Ring element.
+     */
+    struct Slot {
+        volatile uint32_t Sequence; //!< slot state - position of the event to be written or to be read
+        StEvent           Event;    //!< event
+    };
+
+    /**
+     * Copy event, making a copy of dynamically allocated data.
+     */
+    ST_LOCAL static void copyEvent(StEvent&       theDst,
+                                   const StEvent& theSrc) {
+        theDst = theSrc;
+        if(theSrc.Type != stEvent_FileDrop) {
+            return;
+        }
+
+        if(theSrc.DNDrop.NbFiles == 0) {
+            theDst.DNDrop.Files = NULL;
+            return;
+        }
+
+        // make a copy in C-style
+        theDst.DNDrop.Files = stMemAlloc<const char**>(sizeof(const char* ) * theSrc.DNDrop.NbFiles);
+        if(theDst.DNDrop.Files == NULL) {
+            theDst.DNDrop.NbFiles = 0;
+            return;
+        }
+
+        stMemZero(theDst.DNDrop.Files, sizeof(const char* ) * theSrc.DNDrop.NbFiles);
+        for(uint32_t aFileIter = 0; aFileIter < theSrc.DNDrop.NbFiles; ++aFileIter) {
+            const char*  aBufferSrc = theSrc.DNDrop.Files[aFileIter];
+            const size_t aSize      = std::strlen(aBufferSrc);
+            char*        aBufferDst = stMemAlloc<char*>(sizeof(char) * aSize + 1);
+            if(aBufferDst == NULL) {
+                theDst.DNDrop.NbFiles = aFileIter;
                 return;
             }
 
-            stMemZero(anEvent.DNDrop.Files, sizeof(const char* ) * theEvent.DNDrop.NbFiles);
-            for(uint32_t aFileIter = 0; aFileIter < theEvent.DNDrop.NbFiles; ++aFileIter) {
-                const char*  aBufferSrc = theEvent.DNDrop.Files[aFileIter];
-                const size_t aSize      = std::strlen(aBufferSrc);
-                char*        aBufferDst = stMemAlloc<char*>(sizeof(char) * aSize + 1);
-                if(aBufferDst == NULL) {
-                    anEvent.DNDrop.NbFiles = aFileIter;
-                    return;
-                }
+            stMemCpy(aBufferDst, aBufferSrc, aSize);
+            aBufferDst[aSize] = '\0';
+            theDst.DNDrop.Files[aFileIter] = aBufferDst;
+        }
+    }
 
-                stMemCpy(aBufferDst, aBufferSrc, aSize);
-                aBufferDst[aSize] = '\0';
-                anEvent.DNDrop.Files[aFileIter] = aBufferDst;
+    /**
+     * Append event to read-only buffer, coalescing it with the previous one when possible.
+     */
+    ST_LOCAL void pushRead(const StEvent& theEvent) {
+        if(mySizeRead != 0) {
+            StEvent& aLast = myEventsRead[mySizeRead - 1];
+            if(aLast.Type == theEvent.Type
+            && (theEvent.Type == stEvent_Size
+             || theEvent.Type == stEvent_TouchMove)) {
+                aLast = theEvent;
+                return;
             }
         }
+        myEventsRead[mySizeRead++] = theEvent;
     }
 
     /**
-     * Swap read/write buffers. Write buffer become empty as result.
+     * Release dynamically allocated resources of events in read-only buffer.
      */
-    ST_LOCAL void swapBuffers() {
-        // release dynamically allocated resources
+    ST_LOCAL void releaseReadEvents() {
         for(size_t anIter = 0; anIter < mySizeRead; ++anIter) {
             StEvent& anEvent = myEventsRead[anIter];
             if(anEvent.Type == stEvent_FileDrop) {
@@ -140,20 +231,20 @@ class StEventsBuffer {
                 anEvent.DNDrop.NbFiles = 0;
             }
         }
-
-        StMutexAuto aLock(myMutex);
-        std::swap(myEventsRead, myEventsWrite);
-        mySizeRead  = mySizeWrite;
-        mySizeWrite = 0;
     }
 
         private: //! @name private fields
 
-    StMutex  myMutex;       //!< mutex for thread-safe access
-    StEvent* myEventsRead;  //!< read-only  events buffer, could be accessed by StWindow thread without lock
-    StEvent* myEventsWrite; //!< write-only events buffer, each insertion operation is protected with mutex
-    size_t   mySizeRead;    //!< number of events in read-only  buffer
-    size_t   mySizeWrite;   //!< number of events in write-only buffer
+    Slot*             mySlots;      //!< ring of appended events
+    StEvent*          myEventsRead; //!< read-only events buffer, accessed only by consumer thread
+    size_t            mySizeRead;   //!< number of events in read-only buffer
+    volatile uint32_t myEnqueuePos; //!< position for the next appended event
+    uint32_t          myDequeuePos; //!< position of the next event to fetch, modified only by consumer thread
+
+        private: //! @name copying is forbidden
+
+    StEventsBuffer           (const StEventsBuffer& );
+    StEventsBuffer& operator=(const StEventsBuffer& );
 
 };
 
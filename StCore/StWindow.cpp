@@ -433,6 +433,25 @@ StQuaternion<double> StWindow::getDeviceOrientation() const {
     return StQuaternion<double>();
 }
 
+StQuaternion<double> StWindow::latchDeviceOrientation() {
+#if defined(__ANDROID__)
+    if(myWin->myToTrackOrient
+    && myWin->myHasOrientSensor
+    && myWin->myParentWin != NULL) {
+        myWin->myParentWin->fetchOrientation(myWin->myQuaternion);
+    }
+#endif
+    return StWindow::getDeviceOrientation();
+}
+
+float StWindow::getReprojectionFov() const {
+    return myWin->myReprojFov;
+}
+
+void StWindow::setReprojectionFov(const float theTanHalfFovY) {
+    myWin->myReprojFov = theTanHalfFovY;
+}
+
 bool StWindow::toSwapEyesHW() const {
     return myWin->myToSwapEyesHW;
 }
@@ -51,6 +51,7 @@ StWindowImpl::StWindowImpl(const StHandle<StResourceManager>& theResMgr,
   myHasOrientSensor(false),
   myIsPoorOrient(false),
   myToTrackOrient(false),
+  myReprojFov(0.0f),
   myToHideStatusBar(true),
   myToHideNavBar(true),
   myToSwapEyesHW(false),
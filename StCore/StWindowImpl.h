@@ -278,6 +278,7 @@ class StWindowImpl {
     bool               myHasOrientSensor; //!< flag indicating that device has orientation sensors
     bool               myIsPoorOrient;    //!< flag indicating that available orientation sensor provides imprecise values
     bool               myToTrackOrient;   //!< track device orientation
+    float              myReprojFov;       //!< tangent of vertical half FOV of head-tracked scene, 0 to disable reprojection
     bool               myToHideStatusBar; //!< hide system-provided status bar
     bool               myToHideNavBar;    //!< hide system-provided navigation bar
     bool               myToSwapEyesHW;    //!< flag to swap LR views on external event
@@ -473,7 +474,7 @@ class StWindowImpl {
 
     StKeysState    myKeysState;        //!< cached keyboard state
     StSyncTimer    myEventsTimer;
-    StEventsBuffer myEventsBuffer;     //!< window events double buffer
+    StEventsBuffer myEventsBuffer;     //!< window events buffer (lock-free)
     StEvent        myStEvent;          //!< temporary event object (to be used in message loop thread)
     StEvent        myStEvent2;         //!< temporary event object (to be used in message loop thread)
     StEvent        myStEventAux;       //!< extra temporary event object (to be used in StWindow creation thread)
@@ -10,6 +10,8 @@
 #include <StGLWidgets/StGLFpsLabel.h>
 #include <StGLWidgets/StGLRootWidget.h>
 
+#include <StImage/StImageBufferPool.h>
+
 #include <StGL/StGLContext.h>
 #include <StGLCore/StGLCore20.h>
 
@@ -23,6 +25,7 @@ StGLFpsLabel::StGLFpsLabel(StGLWidget* theParent)
   myPlayFps(-1.0),
   myPlayQueued(0),
   myPlayQueueLen(0),
+  myStatistics(NULL),
   myTimer(true),
   myCounter(0) {
     StGLWidget::signals.onMouseUnclick.connect(this, &StGLFpsLabel::doMouseUnclick);
@@ -63,6 +66,37 @@ void StGLFpsLabel::update(const bool      theIsStereo,
                   myPlayQueued, myPlayQueueLen, myPlayFps);
     }
     StString aText(aBuffer);
+
+    // playback statistics
+    if(myStatistics != NULL
+    && myPlayFps > 0.0) {
+        const StFrameStatistics::Snapshot aStats = myStatistics->getSnapshot();
+        stsprintf(aBuffer, 128, "\nFrame %.1f/%.1f ms, miss %u\nUpload %.1f ms, drop %u\nA/V %+.0f ms, pkt %u",
+                  aStats.Frame.getAverageMs(), aStats.Frame.MaxMs, unsigned(aStats.NbVsyncMisses),
+                  aStats.Upload.getAverageMs(), unsigned(aStats.NbDropped),
+                  aStats.DiffVAMs, unsigned(aStats.DecoderQueue));
+        aText += aBuffer;
+        if(aStats.Decode[1].Count != 0) {
+            stsprintf(aBuffer, 128, "\nDecode %.1f|%.1f ms",
+                      aStats.Decode[0].getAverageMs(), aStats.Decode[1].getAverageMs());
+            aText += aBuffer;
+        } else if(aStats.Decode[0].Count != 0) {
+            stsprintf(aBuffer, 128, "\nDecode %.1f ms", aStats.Decode[0].getAverageMs());
+            aText += aBuffer;
+        }
+    }
+
+    // frame buffers memory
+    const StImageBufferPool::Statistics aPoolStats = StImageBufferPool::GetDefault().getStatistics();
+    if(aPoolStats.BytesPeak != 0) {
+        stsprintf(aBuffer, 128, "\nMem %.0f+%.0f MiB (%u%%)",
+                  double(aPoolStats.BytesUsed) / (1024.0 * 1024.0),
+                  double(aPoolStats.BytesFree) / (1024.0 * 1024.0),
+                  aPoolStats.NbHits + aPoolStats.NbMisses != 0
+                ? unsigned(100 * aPoolStats.NbHits / (aPoolStats.NbHits + aPoolStats.NbMisses))
+                : 0u);
+        aText += aBuffer;
+    }
     if(!theExtraInfo.isEmpty()) {
         aText += "\n";
         aText += theExtraInfo;
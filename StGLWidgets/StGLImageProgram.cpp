@@ -82,8 +82,7 @@ StGLImageProgram::StGLImageProgram()
     registerFragmentShaderPart(FragSection_ToRgb, FragToRgb_FromRgb,
         "void convertToRGB(inout vec4 color, in vec3 texCoord) {}\n\n");
 
-    registerFragmentShaderPart(FragSection_ToRgb, FragToRgb_FromRgba,
-        "void convertToRGB(inout vec4 color, in vec3 texCoord) {\n"
+    const char F_SHADER_BACK_COLOR[] =
         "    vec4 backColor;\n"
         "    bool evenX = int(mod(floor(gl_FragCoord.x + 1.5), 16.0)) >= 8;\n" // just simple 8 pixels check-board
         "    bool evenY = int(mod(floor(gl_FragCoord.y + 1.5), 16.0)) >= 8;\n"
@@ -91,9 +90,13 @@ StGLImageProgram::StGLImageProgram()
         "        backColor = vec4(0.4, 0.4, 0.4, 1.0);\n"
         "    } else {\n"
         "        backColor = vec4(0.6, 0.6, 0.6, 1.0);\n"
-        "    }\n"
-        "    color = mix(backColor, color, color.a);\n"
-        "}\n\n");
+        "    }\n";
+
+    registerFragmentShaderPart(FragSection_ToRgb, FragToRgb_FromRgba, StString()
+        + "void convertToRGB(inout vec4 color, in vec3 texCoord) {\n"
+        + F_SHADER_BACK_COLOR
+        + "    color = mix(backColor, color, color.a);\n"
+        + "}\n\n");
     registerFragmentShaderPart(FragSection_ToRgb, FragToRgb_FromGray,
         "void convertToRGB(inout vec4 color, in vec3 texCoord) {\n"
         "    color.r = color.a;\n" // gray scale stored in alpha
@@ -117,38 +120,34 @@ StGLImageProgram::StGLImageProgram()
        "    theColor = aColor;"
        "}\n\n");
 
-    const char F_SHADER_YUV2RGB_MPEG[] =
+    // fetch YUV components from planes (Y in alpha channel of main texture)
+    const char F_SHADER_YUV_PLANAR[] =
        "uniform stSampler uTextureU;\n"
        "uniform stSampler uTextureV;\n"
        "void convertToRGB(inout vec4 color, in vec3 texCoordUV) {\n"
-       "    vec3 colorYUV = vec3(color.a, stTexture(uTextureU, texCoordUV).a, stTexture(uTextureV, texCoordUV).a);\n"
-       "    colorYUV   *= TheRangeBits;\n"
-       "    colorYUV.x  = 1.1643 * (colorYUV.x - 0.0625);\n"
-       "    colorYUV.y -= 0.5;\n"
-       "    colorYUV.z -= 0.5;\n"
-       "    color.r = colorYUV.x +  1.5958 * colorYUV.z;\n"
-       "    color.g = colorYUV.x - 0.39173 * colorYUV.y - 0.81290 * colorYUV.z;\n"
-       "    color.b = colorYUV.x +   2.017 * colorYUV.y;\n"
-       "}\n\n";
+       "    vec3 colorYUV = vec3(color.a, stTexture(uTextureU, texCoordUV).a, stTexture(uTextureV, texCoordUV).a);\n";
 
-    const char F_SHADER_YUV2RGB_FULL[] =
+    // semi-planar layout (NV12, P010) - interleaved UV plane in luminance and alpha channels
+    const char F_SHADER_YUV_NV[] =
        "uniform stSampler uTextureU;\n"
-       "uniform stSampler uTextureV;\n"
        "void convertToRGB(inout vec4 color, in vec3 texCoordUV) {\n"
-       "    vec3 colorYUV = vec3(color.a, stTexture(uTextureU, texCoordUV).a, stTexture(uTextureV, texCoordUV).a);\n"
-       "    colorYUV   *= TheRangeBits;\n"
-       "    colorYUV.x  = colorYUV.x;\n"
-       "    colorYUV.y -= 0.5;\n"
-       "    colorYUV.z -= 0.5;\n"
-       "    color.r = colorYUV.x + 1.402 * colorYUV.z;\n"
-       "    color.g = colorYUV.x - 0.344 * colorYUV.y - 0.714 * colorYUV.z;\n"
-       "    color.b = colorYUV.x + 1.772 * colorYUV.y;\n"
-       "}\n\n";
+       "    vec3 colorYUV = vec3(color.a, stTexture(uTextureU, texCoordUV).r, stTexture(uTextureU, texCoordUV).a);\n";
 
-    const char F_SHADER_YUVNV2RGB_MPEG[] =
+    // packed 4:2:2 layout - the same data is bound as luminance+alpha texture of full width (Y and interleaved U/V)
+    // and as RGBA texture of half width (two pixels with shared chroma)
+    const char F_SHADER_YUV_YUYV[] =
        "uniform stSampler uTextureU;\n"
        "void convertToRGB(inout vec4 color, in vec3 texCoordUV) {\n"
-       "    vec3 colorYUV = vec3(color.a, stTexture(uTextureU, texCoordUV).r, stTexture(uTextureU, texCoordUV).a);\n"
+       "    vec4 aChroma  = stTexture(uTextureU, texCoordUV);\n"
+       "    vec3 colorYUV = vec3(color.r, aChroma.g, aChroma.a);\n";
+
+    const char F_SHADER_YUV_UYVY[] =
+       "uniform stSampler uTextureU;\n"
+       "void convertToRGB(inout vec4 color, in vec3 texCoordUV) {\n"
+       "    vec4 aChroma  = stTexture(uTextureU, texCoordUV);\n"
+       "    vec3 colorYUV = vec3(color.a, aChroma.r, aChroma.b);\n";
+
+    const char F_SHADER_YUV2RGB_MPEG[] =
        "    colorYUV   *= TheRangeBits;\n"
        "    colorYUV.x  = 1.1643 * (colorYUV.x - 0.0625);\n"
        "    colorYUV.y -= 0.5;\n"
@@ -158,10 +157,7 @@ StGLImageProgram::StGLImageProgram()
        "    color.b = colorYUV.x +   2.017 * colorYUV.y;\n"
        "}\n\n";
 
-    const char F_SHADER_YUVNV2RGB_FULL[] =
-       "uniform stSampler uTextureU;\n"
-       "void convertToRGB(inout vec4 color, in vec3 texCoordUV) {\n"
-       "    vec3 colorYUV = vec3(color.a, stTexture(uTextureU, texCoordUV).r, stTexture(uTextureU, texCoordUV).a);\n"
+    const char F_SHADER_YUV2RGB_FULL[] =
        "    colorYUV   *= TheRangeBits;\n"
        "    colorYUV.x  = colorYUV.x;\n"
        "    colorYUV.y -= 0.5;\n"
@@ -171,37 +167,65 @@ StGLImageProgram::StGLImageProgram()
        "    color.b = colorYUV.x + 1.772 * colorYUV.y;\n"
        "}\n\n";
 
-    regToRgb(FragToRgb_FromYuvFull, StString()
-        + "const float TheRangeBits = 1.0;\n"
-        + F_SHADER_YUV2RGB_FULL);
-
-    regToRgb(FragToRgb_FromYuvMpeg, StString()
-        + "const float TheRangeBits = 1.0;\n"
-        + F_SHADER_YUV2RGB_MPEG);
-
-    regToRgb(FragToRgb_FromYuv9Full, StString()
-        + "const float TheRangeBits = 65535.0 / 511.0;\n"
-        + F_SHADER_YUV2RGB_FULL);
-
-    regToRgb(FragToRgb_FromYuv9Mpeg, StString()
-        + "const float TheRangeBits = 65535.0 / 511.0;\n"
-        + F_SHADER_YUV2RGB_MPEG);
-
-    regToRgb(FragToRgb_FromYuv10Full, StString()
-        + "const float TheRangeBits = 65535.0 / 1023.0;\n"
-        + F_SHADER_YUV2RGB_FULL);
-
-    regToRgb(FragToRgb_FromYuv10Mpeg, StString()
-        + "const float TheRangeBits = 65535.0 / 1023.0;\n"
-        + F_SHADER_YUV2RGB_MPEG);
-
-    regToRgb(FragToRgb_FromYuvNvFull, StString()
-        + "const float TheRangeBits = 1.0;\n"
-        + F_SHADER_YUVNV2RGB_FULL);
+    // planar RGB stored in G, B, R planes order
+    const char F_SHADER_GBR2RGB[] =
+       "uniform stSampler uTextureU;\n"
+       "uniform stSampler uTextureV;\n"
+       "void convertToRGB(inout vec4 color, in vec3 texCoordUV) {\n"
+       "    color.rgb = vec3(stTexture(uTextureV, texCoordUV).a, color.a, stTexture(uTextureU, texCoordUV).a) * TheRangeBits;\n"
+       "    color.a   = 1.0;\n"
+       "}\n\n";
 
-    regToRgb(FragToRgb_FromYuvNvMpeg, StString()
-        + "const float TheRangeBits = 1.0;\n"
-        + F_SHADER_YUVNV2RGB_MPEG);
+    const char F_RANGE_8[]  = "const float TheRangeBits = 1.0;\n";
+    const char F_RANGE_9[]  = "const float TheRangeBits = 65535.0 / 511.0;\n";
+    const char F_RANGE_10[] = "const float TheRangeBits = 65535.0 / 1023.0;\n";
+    const char F_RANGE_12[] = "const float TheRangeBits = 65535.0 / 4095.0;\n";
+    // 10 bits stored in high bits of 16 bits (P010)
+    const char F_RANGE_NV10[] = "const float TheRangeBits = 65535.0 / 65472.0;\n";
+
+    regToRgb(FragToRgb_FromYuvFull,    StString() + F_RANGE_8  + F_SHADER_YUV_PLANAR + F_SHADER_YUV2RGB_FULL);
+    regToRgb(FragToRgb_FromYuvMpeg,    StString() + F_RANGE_8  + F_SHADER_YUV_PLANAR + F_SHADER_YUV2RGB_MPEG);
+    regToRgb(FragToRgb_FromYuv9Full,   StString() + F_RANGE_9  + F_SHADER_YUV_PLANAR + F_SHADER_YUV2RGB_FULL);
+    regToRgb(FragToRgb_FromYuv9Mpeg,   StString() + F_RANGE_9  + F_SHADER_YUV_PLANAR + F_SHADER_YUV2RGB_MPEG);
+    regToRgb(FragToRgb_FromYuv10Full,  StString() + F_RANGE_10 + F_SHADER_YUV_PLANAR + F_SHADER_YUV2RGB_FULL);
+    regToRgb(FragToRgb_FromYuv10Mpeg,  StString() + F_RANGE_10 + F_SHADER_YUV_PLANAR + F_SHADER_YUV2RGB_MPEG);
+    regToRgb(FragToRgb_FromYuv12Full,  StString() + F_RANGE_12 + F_SHADER_YUV_PLANAR + F_SHADER_YUV2RGB_FULL);
+    regToRgb(FragToRgb_FromYuv12Mpeg,  StString() + F_RANGE_12 + F_SHADER_YUV_PLANAR + F_SHADER_YUV2RGB_MPEG);
+    // P016 keeps all 16 bits and thus uses the same shaders as NV12
+    regToRgb(FragToRgb_FromYuvNvFull,  StString() + F_RANGE_8  + F_SHADER_YUV_NV     + F_SHADER_YUV2RGB_FULL);
+    regToRgb(FragToRgb_FromYuvNvMpeg,  StString() + F_RANGE_8  + F_SHADER_YUV_NV     + F_SHADER_YUV2RGB_MPEG);
+    regToRgb(FragToRgb_FromYuvNv10Full, StString() + F_RANGE_NV10 + F_SHADER_YUV_NV + F_SHADER_YUV2RGB_FULL);
+    regToRgb(FragToRgb_FromYuvNv10Mpeg, StString() + F_RANGE_NV10 + F_SHADER_YUV_NV + F_SHADER_YUV2RGB_MPEG);
+    regToRgb(FragToRgb_FromYuyvFull,   StString() + F_RANGE_8  + F_SHADER_YUV_YUYV   + F_SHADER_YUV2RGB_FULL);
+    regToRgb(FragToRgb_FromYuyvMpeg,   StString() + F_RANGE_8  + F_SHADER_YUV_YUYV   + F_SHADER_YUV2RGB_MPEG);
+    regToRgb(FragToRgb_FromUyvyFull,   StString() + F_RANGE_8  + F_SHADER_YUV_UYVY   + F_SHADER_YUV2RGB_FULL);
+    regToRgb(FragToRgb_FromUyvyMpeg,   StString() + F_RANGE_8  + F_SHADER_YUV_UYVY   + F_SHADER_YUV2RGB_MPEG);
+    regToRgb(FragToRgb_FromGbr,        StString() + F_RANGE_8  + F_SHADER_GBR2RGB);
+    regToRgb(FragToRgb_FromGbr9,       StString() + F_RANGE_9  + F_SHADER_GBR2RGB);
+    regToRgb(FragToRgb_FromGbr10,      StString() + F_RANGE_10 + F_SHADER_GBR2RGB);
+    regToRgb(FragToRgb_FromGbr12,      StString() + F_RANGE_12 + F_SHADER_GBR2RGB);
+
+    // alpha plane has the same bit depth as color planes (TheRangeBits is defined by color conversion section)
+    const char F_SHADER_APPLY_ALPHA[] =
+        "void applyAlpha(inout vec4 color, in vec3 texCoord) {\n"
+        "    float anAlpha = getAlpha(texCoord) * TheRangeBits;\n";
+
+    registerFragmentShaderPart(FragSection_Alpha, FragAlpha_Off,
+        "void applyAlpha(inout vec4 color, in vec3 texCoord) {}\n\n");
+    registerFragmentShaderPart(FragSection_Alpha, FragAlpha_On, StString()
+        + "uniform sampler2D uTextureA;\n"
+        + "float getAlpha(in vec3 texCoord) { return texture2D(uTextureA, texCoord.xy).a; }\n"
+        + F_SHADER_APPLY_ALPHA
+        + F_SHADER_BACK_COLOR
+        + "    color = mix(backColor, color, anAlpha);\n"
+        + "}\n\n");
+    registerFragmentShaderPart(FragSection_Alpha, FragAlpha_OnCubemap, StString()
+        + "uniform samplerCube uTextureA;\n"
+        + "float getAlpha(in vec3 texCoord) { return textureCube(uTextureA, texCoord).a; }\n"
+        + F_SHADER_APPLY_ALPHA
+        + F_SHADER_BACK_COLOR
+        + "    color = mix(backColor, color, anAlpha);\n"
+        + "}\n\n");
 
     params.gamma = new StFloat32Param(1.0f);
     params.gamma->setMinMaxValues(0.05f, 99.0f);
@@ -272,6 +296,7 @@ StGLImageProgram::StGLImageProgram()
         // - to optimize rendering on old hardware not supported conditions (GeForce FX for example).
        "vec4 getColor(in vec3 texCoord);\n"
        "void convertToRGB(inout vec4 theColor, in vec3 theTexUVCoord);\n"
+       "void applyAlpha(inout vec4 theColor, in vec3 theTexCoord);\n"
        "void applyCorrection(inout vec4 theColor);\n"
        "void applyGamma(inout vec4 theColor);\n"
 
@@ -280,6 +305,8 @@ StGLImageProgram::StGLImageProgram()
        "    vec4 aColor = getColor(fTexCoord);\n"
             // convert from alien color model (like YUV) to RGB
        "    convertToRGB(aColor, fTexUVCoord);\n"
+            // blend with alpha plane (like YUVA)
+       "    applyAlpha(aColor, fTexCoord);\n"
             // color processing (saturation, brightness, etc)
        "    applyCorrection(aColor);\n"
             // gamma correction
@@ -341,19 +368,37 @@ static inline StGLImageProgram::FragToRgb getColorShader(const StImage::ImgColor
         case StImage::ImgColor_RGBA: return StGLImageProgram::FragToRgb_FromRgba;
         case StImage::ImgColor_GRAY: return StGLImageProgram::FragToRgb_FromGray;
         case StImage::ImgColor_XYZ:  return StGLImageProgram::FragToRgb_FromXyz;
-        case StImage::ImgColor_YUV: {
+        case StImage::ImgColor_YUV:
+        case StImage::ImgColor_YUVA: {
             switch(theColorScale) {
-                case StImage::ImgScale_Mpeg9:  return StGLImageProgram::FragToRgb_FromYuv9Mpeg;
-                case StImage::ImgScale_Mpeg10: return StGLImageProgram::FragToRgb_FromYuv10Mpeg;
-                case StImage::ImgScale_Jpeg9:  return StGLImageProgram::FragToRgb_FromYuv9Full;
-                case StImage::ImgScale_Jpeg10: return StGLImageProgram::FragToRgb_FromYuv10Full;
-                case StImage::ImgScale_Mpeg:   return StGLImageProgram::FragToRgb_FromYuvMpeg;
-                case StImage::ImgScale_Full:   return StGLImageProgram::FragToRgb_FromYuvFull;
-                case StImage::ImgScale_NvMpeg: return StGLImageProgram::FragToRgb_FromYuvNvMpeg;
-                case StImage::ImgScale_NvFull: return StGLImageProgram::FragToRgb_FromYuvNvFull;
+                case StImage::ImgScale_Mpeg9:    return StGLImageProgram::FragToRgb_FromYuv9Mpeg;
+                case StImage::ImgScale_Mpeg10:   return StGLImageProgram::FragToRgb_FromYuv10Mpeg;
+                case StImage::ImgScale_Mpeg12:   return StGLImageProgram::FragToRgb_FromYuv12Mpeg;
+                case StImage::ImgScale_Jpeg9:    return StGLImageProgram::FragToRgb_FromYuv9Full;
+                case StImage::ImgScale_Jpeg10:   return StGLImageProgram::FragToRgb_FromYuv10Full;
+                case StImage::ImgScale_Jpeg12:   return StGLImageProgram::FragToRgb_FromYuv12Full;
+                case StImage::ImgScale_Mpeg:     return StGLImageProgram::FragToRgb_FromYuvMpeg;
+                case StImage::ImgScale_Full:     return StGLImageProgram::FragToRgb_FromYuvFull;
+                case StImage::ImgScale_NvMpeg:   return StGLImageProgram::FragToRgb_FromYuvNvMpeg;
+                case StImage::ImgScale_NvFull:   return StGLImageProgram::FragToRgb_FromYuvNvFull;
+                case StImage::ImgScale_Nv10Mpeg: return StGLImageProgram::FragToRgb_FromYuvNv10Mpeg;
+                case StImage::ImgScale_Nv10Full: return StGLImageProgram::FragToRgb_FromYuvNv10Full;
+                case StImage::ImgScale_YuyvMpeg: return StGLImageProgram::FragToRgb_FromYuyvMpeg;
+                case StImage::ImgScale_YuyvFull: return StGLImageProgram::FragToRgb_FromYuyvFull;
+                case StImage::ImgScale_UyvyMpeg: return StGLImageProgram::FragToRgb_FromUyvyMpeg;
+                case StImage::ImgScale_UyvyFull: return StGLImageProgram::FragToRgb_FromUyvyFull;
             }
             return StGLImageProgram::FragToRgb_FromYuvFull;
         }
+        case StImage::ImgColor_GBR:
+        case StImage::ImgColor_GBRA: {
+            switch(theColorScale) {
+                case StImage::ImgScale_Jpeg9:  return StGLImageProgram::FragToRgb_FromGbr9;
+                case StImage::ImgScale_Jpeg10: return StGLImageProgram::FragToRgb_FromGbr10;
+                case StImage::ImgScale_Jpeg12: return StGLImageProgram::FragToRgb_FromGbr12;
+                default:                       return StGLImageProgram::FragToRgb_FromGbr;
+            }
+        }
         default: {
             ST_DEBUG_LOG("No GLSL shader for this color model = " + theColorModel);
             ST_ASSERT(false, "StGLImageProgram::getColorShader() - unsupported color model!");
@@ -382,7 +427,12 @@ bool StGLImageProgram::init(StGLContext&                 theCtx,
         aToRgb += FragToRgb_CUBEMAP;
     }
 
+    const bool hasAlphaPlane = theColorModel == StImage::ImgColor_YUVA
+                            || theColorModel == StImage::ImgColor_GBRA;
     isChanged = setFragmentShaderPart(theCtx, FragSection_ToRgb,    aToRgb) || isChanged;
+    isChanged = setFragmentShaderPart(theCtx, FragSection_Alpha,
+                                      !hasAlphaPlane ? FragAlpha_Off
+                                    : (theFilter == FragGetColor_Cubemap ? FragAlpha_OnCubemap : FragAlpha_On)) || isChanged;
     isChanged = setFragmentShaderPart(theCtx, FragSection_GetColor, theFilter) || isChanged;
     isChanged = setVertexShaderPart  (theCtx, 0, theFilter == FragGetColor_Cubemap ? VertMain_Cubemap : VertMain_Normal) || isChanged;
     if(isChanged) {
@@ -405,10 +455,12 @@ bool StGLImageProgram::init(StGLContext&                 theCtx,
         StGLVarLocation uniTextureLoc  = myActiveProgram->getUniformLocation(theCtx, "uTexture");
         StGLVarLocation uniTextureULoc = myActiveProgram->getUniformLocation(theCtx, "uTextureU");
         StGLVarLocation uniTextureVLoc = myActiveProgram->getUniformLocation(theCtx, "uTextureV");
+        StGLVarLocation uniTextureALoc = myActiveProgram->getUniformLocation(theCtx, "uTextureA");
         myActiveProgram->use(theCtx);
         theCtx.core20fwd->glUniform1i(uniTextureLoc,  StGLProgram::TEXTURE_SAMPLE_0);
         theCtx.core20fwd->glUniform1i(uniTextureULoc, StGLProgram::TEXTURE_SAMPLE_1);
         theCtx.core20fwd->glUniform1i(uniTextureVLoc, StGLProgram::TEXTURE_SAMPLE_2);
+        theCtx.core20fwd->glUniform1i(uniTextureALoc, StGLProgram::TEXTURE_SAMPLE_3);
         myActiveProgram->unuse(theCtx);
 
         /*if (!uniModelMatLoc.isValid()
@@ -204,6 +204,9 @@ namespace {
     static const float THE_SPHERE_RADIUS     = -10.0f;
     static const float THE_PANORAMA_DEF_ZOOM = 0.45f;
 
+    static const float ST_PI    = 3.1415926535897932384626433832795f;
+    static const float ST_TWOPI = 6.2831853071795864769252867665590f;
+
 }
 
 StGLImageRegion::StGLImageRegion(StGLWidget* theParent,
@@ -213,6 +216,7 @@ StGLImageRegion::StGLImageRegion(StGLWidget* theParent,
   myQuad(),
   myUVSphere(StGLVec3(0.0f, 0.0f, 0.0f), 1.0f, 64),
   myTextureQueue(theTextureQueue),
+  myVisibleTiles(false),
   myClickPntZo(0.0, 0.0),
   myKeyFlags(ST_VF_NONE),
   myDragDelayMs(0.0),
@@ -224,7 +228,8 @@ StGLImageRegion::StGLImageRegion(StGLWidget* theParent,
   myToRightRotate(false),
 #endif
   myIsInitialized(false),
-  myHasVideoStream(false) {
+  myHasVideoStream(false),
+  myHasPendingTiles(false) {
     params.DisplayMode = new StEnumParam(MODE_STEREO, stCString("viewStereoMode"), stCString("Stereo Output"));
     params.DisplayMode->defineOption(MODE_STEREO,     stCString("Stereo"));
     params.DisplayMode->defineOption(MODE_ONLY_LEFT,  stCString("Left View"));
@@ -242,6 +247,7 @@ StGLImageRegion::StGLImageRegion(StGLWidget* theParent,
     params.DisplayRatio->defineOption(RATIO_5_4,   stCString("5:4"));
 
     params.ToHealAnamorphicRatio = new StBoolParamNamed(false, stCString("toHealAnamorphic"), stCString("Heal Anamorphic Ratio"));
+    params.ToUploadVisible       = new StBoolParamNamed(false, stCString("toUploadVisible"),  stCString("Upload visible panorama region"));
     params.TextureFilter = new StEnumParam(StGLImageProgram::FILTER_LINEAR, stCString("viewTexFilter"), stCString("Texture Filter"));
     params.TextureFilter->defineOption(StGLImageProgram::FILTER_NEAREST, stCString("Nearest"));
     params.TextureFilter->defineOption(StGLImageProgram::FILTER_LINEAR,  stCString("Linear"));
@@ -392,6 +398,7 @@ StGLImageRegion::~StGLImageRegion() {
     // make sure GL objects are released within GL thread
     StGLContext& aCtx = getContext();
     myTextureQueue->getQTexture().release(aCtx);
+    myTileCache.release(aCtx);
     myQuad.release(aCtx);
     myUVSphere.release(aCtx);
     myProgram.release(aCtx);
@@ -416,12 +423,32 @@ void StGLImageRegion::stglUpdate(const StPointD_t& thePointZo,
                                  bool theIsPreciseInput) {
     StGLWidget::stglUpdate(thePointZo, theIsPreciseInput);
     if(myIsInitialized) {
+        // upload only panorama tiles visible within previous frame (with margin for head rotation)
+        if(params.ToUploadVisible->getValue()
+        && !myVisibleTiles.isEmpty()) {
+            myVisibleTiles.dilate();
+        } else {
+            myVisibleTiles.setAll(true);
+        }
+        myTextureQueue->setVisibleTiles(myVisibleTiles);
+        myVisibleTiles.setAll(false);
+
         myHasVideoStream = myTextureQueue->stglUpdateStTextures(getContext()) || myTextureQueue->hasConnectedStream();
         StHandle<StStereoParams> aFileParams = myTextureQueue->getQTexture().getFront(StGLQuadTexture::LEFT_TEXTURE).getSource();
         if(params.stereoFile != aFileParams) {
             params.stereoFile = aFileParams;
             onParamsChanged();
         }
+
+        // release full-resolution image as soon as it is removed from queue
+        StHandle<StStereoParams> aPyramidParams;
+        if(!myTileCache.getPyramid().isNull()
+        &&  myTextureQueue->getPyramid(aPyramidParams).isNull()) {
+            myTileCache.setPyramid(StHandle<StImagePyramid>());
+        }
+
+        // tiles exceeded upload budget of previous frame - keep redrawing until all of them are resident
+        myHasPendingTiles = myTileCache.hasPendingTiles();
     }
 }
 
@@ -515,6 +542,21 @@ bool StGLImageRegion::getHeadOrientation(StGLQuaternion& theOrient,
     return true;
 }
 
+float StGLImageRegion::getPanoramaTanHalfFov() const {
+    StHandle<StStereoParams> aParams = params.stereoFile;
+    if(aParams.isNull()
+    || aParams->ViewingMode == StViewSurface_Plain) {
+        return 0.0f;
+    }
+
+    // panorama surface is scaled in XY by the same factor as within stglDraw()
+    const double aZNear = myProjCam.getZNear();
+    StRectD_t aZParams;
+    myProjCam.getZParams(aZNear, aZParams);
+    const double aScale = THE_PANORAMA_DEF_ZOOM * aParams->ScaleFactor * myRoot->getVrZoomOut();
+    return float(aZParams.top() / (aZNear * aScale));
+}
+
 void StGLImageRegion::stglDraw(unsigned int theView) {
     StHandle<StStereoParams> aParams = getSource();
     if(!myIsInitialized || !isVisible() || aParams.isNull()
@@ -548,6 +590,98 @@ void StGLImageRegion::stglDraw(unsigned int theView) {
     StGLWidget::stglDraw(theView);
 }
 
+void StGLImageRegion::stglDrawTiles(StGLContext&                    theCtx,
+                                    const StHandle<StStereoParams>& theParams,
+                                    const GLfloat                   theBaseSizeX,
+                                    const StGLMatrix&               theProjMat,
+                                    const StGLMatrix&               theModelMat) {
+    StHandle<StStereoParams> aPyramidParams;
+    StHandle<StImagePyramid> aPyramid = myTextureQueue->getPyramid(aPyramidParams);
+    if(aPyramidParams != theParams
+    || !theParams->isMono()) {
+        aPyramid.nullify();
+    }
+    myTileCache.setPyramid(aPyramid);
+    if(aPyramid.isNull()) {
+        return;
+    }
+    myTileCache.beginFrame();
+
+    // estimate how many screen pixels cover one pixel of full-resolution image
+    const StGLBoxPx  aVPort = theCtx.stglViewport();
+    const StGLMatrix aMVP   = StGLMatrix::multiply(theProjMat, theModelMat);
+    const GLfloat    aHalfW = 0.5f * GLfloat(aVPort.width());
+    const GLfloat    aHalfH = 0.5f * GLfloat(aVPort.height());
+    const StGLVec2   anAxisX(aMVP.getValue(0, 0) * aHalfW, aMVP.getValue(1, 0) * aHalfH);
+    const StGLVec2   anAxisY(aMVP.getValue(0, 1) * aHalfW, aMVP.getValue(1, 1) * aHalfH);
+    const StImagePlane& aLevel0 = aPyramid->getLevel(0);
+    const GLfloat aPxPerTexel = stMax(anAxisX.modulus() * 2.0f / GLfloat(aLevel0.getSizeX()),
+                                      anAxisY.modulus() * 2.0f / GLfloat(aLevel0.getSizeY()));
+
+    // pick the coarsest level still having at least one texel per screen pixel
+    size_t aLevelId = 0;
+    for(GLfloat aScale = aPxPerTexel * 2.0f; aLevelId + 1 < aPyramid->getNbLevels() && aScale <= 1.0f; aScale *= 2.0f) {
+        ++aLevelId;
+    }
+    const StImagePlane& aLevel = aPyramid->getLevel(aLevelId);
+    if(GLfloat(aLevel.getSizeX()) <= theBaseSizeX) {
+        // downscaled image is good enough
+        return;
+    }
+
+    const bool    isLinear  = params.TextureFilter->getValue() != StGLImageProgram::FILTER_NEAREST;
+    const GLfloat aTileSize = GLfloat(aPyramid->getTileSize());
+    const GLfloat aSizeX    = GLfloat(aLevel.getSizeX());
+    const GLfloat aSizeY    = GLfloat(aLevel.getSizeY());
+    const size_t  aNbTilesX = aPyramid->getNbTilesX(aLevelId);
+    const size_t  aNbTilesY = aPyramid->getNbTilesY(aLevelId);
+    for(size_t aTileY = 0; aTileY < aNbTilesY; ++aTileY) {
+        const GLfloat aTop    = 1.0f - 2.0f * GLfloat(aTileY) * aTileSize / aSizeY;
+        const GLfloat aBottom = 1.0f - 2.0f * stMin(GLfloat(aTileY + 1) * aTileSize, aSizeY) / aSizeY;
+        for(size_t aTileX = 0; aTileX < aNbTilesX; ++aTileX) {
+            const GLfloat aLeft  = -1.0f + 2.0f * GLfloat(aTileX) * aTileSize / aSizeX;
+            const GLfloat aRight = -1.0f + 2.0f * stMin(GLfloat(aTileX + 1) * aTileSize, aSizeX) / aSizeX;
+
+            // skip tiles outside of the viewport
+            StGLVec2 aMin( 2.0f,  2.0f);
+            StGLVec2 aMax(-2.0f, -2.0f);
+            for(int aCorner = 0; aCorner < 4; ++aCorner) {
+                const StGLVec4 aPnt = aMVP * StGLVec4((aCorner & 1) != 0 ? aRight  : aLeft,
+                                                      (aCorner & 2) != 0 ? aBottom : aTop,
+                                                      0.0f, 1.0f);
+                const StGLVec2 aNdc(aPnt.x() / aPnt.w(), aPnt.y() / aPnt.w());
+                aMin.x() = stMin(aMin.x(), aNdc.x());
+                aMin.y() = stMin(aMin.y(), aNdc.y());
+                aMax.x() = stMax(aMax.x(), aNdc.x());
+                aMax.y() = stMax(aMax.y(), aNdc.y());
+            }
+            if(aMax.x() < -1.0f || aMin.x() > 1.0f
+            || aMax.y() < -1.0f || aMin.y() > 1.0f) {
+                continue;
+            }
+
+            StGLVec4 aDataRect;
+            StGLTexture* aTexture = myTileCache.getTile(theCtx, aLevelId, aTileX, aTileY, isLinear, aDataRect);
+            if(aTexture == NULL) {
+                // downscaled image remains visible until the tile is uploaded
+                continue;
+            }
+
+            StGLMatrix aTileMat(theModelMat);
+            aTileMat.translate(StGLVec3(0.5f * (aLeft + aRight), 0.5f * (aTop + aBottom), 0.0f));
+            aTileMat.scale(0.5f * (aRight - aLeft), 0.5f * (aTop - aBottom), 1.0f);
+
+            aTexture->setMinMagFilter(theCtx, isLinear ? GL_LINEAR : GL_NEAREST);
+            aTexture->bind(theCtx);
+            myProgram.setTextureSizePx      (theCtx, StGLVec2(GLfloat(aTexture->getSizeX()), GLfloat(aTexture->getSizeY())));
+            myProgram.setTextureMainDataSize(theCtx, aDataRect);
+            myProgram.getActiveProgram()->setModelMat(theCtx, aTileMat);
+            myQuad.draw(theCtx, *myProgram.getActiveProgram());
+            aTexture->unbind(theCtx);
+        }
+    }
+}
+
 void StGLImageRegion::stglDrawView(unsigned int theView) {
     StGLQuadTexture::LeftOrRight aLeftOrRight = StGLQuadTexture::LEFT_TEXTURE;
     StHandle<StStereoParams> aParams = getSource();
@@ -695,6 +829,7 @@ void StGLImageRegion::stglDrawView(unsigned int theView) {
                                                 : StGLImageProgram::FragGetColor_Normal;
     switch(aViewMode) {
         case StViewSurface_Plain: {
+            myVisibleTiles.setAll(true);
             if(!myProgram.init(aCtx, aTextures.getColorModel(), aTextures.getColorScale(), aColorGetter)) {
                 break;
             }
@@ -824,6 +959,8 @@ void StGLImageRegion::stglDrawView(unsigned int theView) {
 
             myQuad.draw(aCtx, *myProgram.getActiveProgram());
 
+            stglDrawTiles(aCtx, aParams, aTextures.getPlane().getDataSize().x() * aTextureSize.x(), anOrthoMat, aModelMat);
+
             myProgram.getActiveProgram()->unuse(aCtx);
 
             // restore changed parameters
@@ -854,8 +991,10 @@ void StGLImageRegion::stglDrawView(unsigned int theView) {
             StGLMatrix aMatModelInv, aMatProjInv;
             aModelMat.inverted(aMatModelInv);
             myProjCam.getProjMatrixMono().inverted(aMatProjInv);
-            myProgram.getActiveProgram()->setProjMat (aCtx, StGLMatrix::multiply(aMatModelInv, aMatProjInv));
+            const StGLMatrix anUnprojMat = StGLMatrix::multiply(aMatModelInv, aMatProjInv);
+            myProgram.getActiveProgram()->setProjMat (aCtx, anUnprojMat);
             myProgram.getActiveProgram()->setModelMat(aCtx, aModelMat);
+            addVisibleTiles(anUnprojMat, true, aParams->ToFlipCubeZ ? 1.0f : -1.0f);
 
             ///glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
 
@@ -892,6 +1031,10 @@ void StGLImageRegion::stglDrawView(unsigned int theView) {
             myProgram.getActiveProgram()->setProjMat (aCtx, myProjCam.getProjMatrixMono());
             myProgram.getActiveProgram()->setModelMat(aCtx, aModelMat);
 
+            StGLMatrix anUnprojMat;
+            StGLMatrix::multiply(myProjCam.getProjMatrixMono(), aModelMat).inverted(anUnprojMat);
+            addVisibleTiles(anUnprojMat, false, 1.0f);
+
             myUVSphere.draw(aCtx, *myProgram.getActiveProgram());
 
             myProgram.getActiveProgram()->unuse(aCtx);
@@ -905,6 +1048,74 @@ void StGLImageRegion::stglDrawView(unsigned int theView) {
     aCtx.stglResizeViewport(aViewportBack);
 }
 
+void StGLImageRegion::addVisibleTiles(const StGLMatrix& theUnprojMat,
+                                      const bool        theIsCubemap,
+                                      const float       theFlipZ) {
+    // sample view directions on the grid slightly exceeding the viewport
+    static const int   THE_NB_SAMPLES = 33;
+    static const float THE_NDC_RANGE  = 1.1f;
+    for(int aSampleY = 0; aSampleY < THE_NB_SAMPLES; ++aSampleY) {
+        const float aNdcY = THE_NDC_RANGE * (2.0f * float(aSampleY) / float(THE_NB_SAMPLES - 1) - 1.0f);
+        for(int aSampleX = 0; aSampleX < THE_NB_SAMPLES; ++aSampleX) {
+            const float aNdcX = THE_NDC_RANGE * (2.0f * float(aSampleX) / float(THE_NB_SAMPLES - 1) - 1.0f);
+            if(theIsCubemap) {
+                // the same direction as computed by cubemap vertex shader
+                const StGLVec4 aPnt = theUnprojMat * StGLVec4(aNdcX, aNdcY, 0.0f, 1.0f);
+                const StGLVec3 aDir(aPnt.x(), aPnt.y(), aPnt.z() * theFlipZ);
+
+                // select the cubemap face following OpenGL rules
+                const StGLVec3 anAbs(std::abs(aDir.x()), std::abs(aDir.y()), std::abs(aDir.z()));
+                int   aFace = 0;
+                float aS = 0.0f, aT = 0.0f, aMajor = 1.0f;
+                if(anAbs.x() >= anAbs.y() && anAbs.x() >= anAbs.z()) {
+                    aMajor = anAbs.x();
+                    aFace  = aDir.x() > 0.0f ? 0 : 1;
+                    aS     = aDir.x() > 0.0f ? -aDir.z() : aDir.z();
+                    aT     = -aDir.y();
+                } else if(anAbs.y() >= anAbs.z()) {
+                    aMajor = anAbs.y();
+                    aFace  = aDir.y() > 0.0f ? 2 : 3;
+                    aS     = aDir.x();
+                    aT     = aDir.y() > 0.0f ? aDir.z() : -aDir.z();
+                } else {
+                    aMajor = anAbs.z();
+                    aFace  = aDir.z() > 0.0f ? 4 : 5;
+                    aS     = aDir.z() > 0.0f ? aDir.x() : -aDir.x();
+                    aT     = -aDir.y();
+                }
+                if(aMajor <= 0.0f) {
+                    continue;
+                }
+                myVisibleTiles.addFacePoint(aFace, 0.5f * (aS / aMajor + 1.0f), 0.5f * (aT / aMajor + 1.0f));
+                continue;
+            }
+
+            // unproject the point on the far plane into the sphere model space
+            const StGLVec4 aPnt = theUnprojMat * StGLVec4(aNdcX, aNdcY, 1.0f, 1.0f);
+            if(aPnt.w() == 0.0f) {
+                continue;
+            }
+            StGLVec3 aDir(aPnt.x() / aPnt.w(), aPnt.y() / aPnt.w(), aPnt.z() / aPnt.w());
+            const float aLen = aDir.modulus();
+            if(aLen <= 0.0f) {
+                continue;
+            }
+            aDir /= aLen;
+
+            // the same mapping as within StGLUVSphere
+            const float aU = std::atan2(aDir.z(), aDir.x()) / ST_TWOPI;
+            const float aV = std::asin(stMin(stMax(aDir.y(), -1.0f), 1.0f)) / ST_PI + 0.5f;
+            myVisibleTiles.addPoint(aU, aV);
+            if(aV < 1.0f / float(StGLVisibleTiles::NB_ROWS)) {
+                // tiles around the pole are too narrow to be hit by sparse samples
+                myVisibleTiles.addRow(0);
+            } else if(aV > 1.0f - 1.0f / float(StGLVisibleTiles::NB_ROWS)) {
+                myVisibleTiles.addRow(StGLVisibleTiles::NB_ROWS - 1);
+            }
+        }
+    }
+}
+
 void StGLImageRegion::doRightUnclick(const StPointD_t& theCursorZo) {
     StHandle<StStereoParams> aParams = getSource();
     if(!myIsInitialized || aParams.isNull()
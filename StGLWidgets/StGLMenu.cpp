@@ -1,6 +1,6 @@
 /**
  * StGLWidgets, small C++ toolkit for writing GUI using OpenGL.
- * Copyright © 2009-2016 Kirill Gavrilov <kirill@sview.ru>
+ * Copyright © 2009-2017 Kirill Gavrilov <kirill@sview.ru>
  *
  * Distributed under the Boost Software License, Version 1.0.
  * See accompanying file license-boost.txt or copy at
@@ -64,6 +64,7 @@ StGLMenu::StGLMenu(StGLWidget* theParent,
 StGLMenu::~StGLMenu() {
     myVertexBuf   .release(getContext());
     myVertexBndBuf.release(getContext());
+    myTextBatch   .release(getContext());
 }
 
 void StGLMenu::setOpacity(const float theOpacity, bool theToSetChildren) {
@@ -212,7 +213,15 @@ void StGLMenu::stglDraw(unsigned int theView) {
     aProgram.unuse(aCtx);
     aCtx.core20fwd->glDisable(GL_BLEND);
 
+    // menu items do not overlap, so that their text can be drawn after all items at once
+    StGLTextBatch* aPrevBatch = myRoot->setTextBatch(&myTextBatch);
+    myTextBatch.reset();
     StGLWidget::stglDraw(theView);
+    myRoot->setTextBatch(aPrevBatch);
+
+    StGLMatrix aModelMat;
+    aModelMat.translate(StGLVec3(myRoot->getScreenDispX(), 0.0f, -getCamera()->getZScreen()));
+    myTextBatch.stglDraw(aCtx, myRoot->getTextProgram(), aModelMat);
 }
 
 bool StGLMenu::doKeyDown(const StKeyEvent& theEvent) {
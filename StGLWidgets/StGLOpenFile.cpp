@@ -28,6 +28,11 @@ StGLOpenFile::StGLOpenFile(StGLWidget*     theParent,
   myCurrentPath(NULL),
   myHotList(NULL),
   myList(NULL),
+  myNbRows(0),
+  myNbRowItems(0),
+  myFirstRow(-1),
+  myRowsWidth(0),
+  myHasUpItem(false),
   myHighlightColor(0.5f, 0.5f, 0.5f, 1.0f),
   myItemColor     (1.0f, 1.0f, 1.0f, 1.0f),
   myFileColor     (0.7f, 0.7f, 0.7f, 1.0f),
@@ -165,6 +170,18 @@ void StGLOpenFile::doFolderUpClick(const size_t ) {
     }
 }
 
+void StGLOpenFile::doListItemClick(const size_t theRow) {
+    if(myHasUpItem) {
+        if(theRow == 0) {
+            doFolderUpClick(0);
+        } else {
+            doFileItemClick(theRow - 1);
+        }
+        return;
+    }
+    doFileItemClick(theRow);
+}
+
 bool StGLOpenFile::tryUnClick(const StClickEvent& theEvent,
                               bool&               theIsItemUnclicked) {
     bool aRes = StGLMessageBox::tryUnClick(theEvent, theIsItemUnclicked);
@@ -269,27 +286,139 @@ void StGLOpenFile::openFolder(const StString& theFolder) {
     myCurrentPath->setText(StString("<b>Location:*</b>") + aPath + (!aPath.isEmpty() ? ST_FILE_SPLITTER : ""));
 
     StString aPathUp = StFileNode::getFolderUp(aPath);
-    if(!aPathUp.isEmpty()) {
-        StGLMenuItem* anUpItem = new StGLPassiveMenuItem(myList);
-        anUpItem->setText("..");
-        anUpItem->setTextColor(myItemColor);
-        anUpItem->setHilightColor(myHighlightColor);
-        anUpItem->changeMargins().left = myMarginX + myIconSizeX + myMarginX;
-        anUpItem->signals.onItemClick = stSlot(this, &StGLOpenFile::doFolderUpClick);
+    myHasUpItem  = !aPathUp.isEmpty();
+    myNbRows     = int(myFolder->size()) + (myHasUpItem ? 1 : 0);
+    myNbRowItems = 0;
+    myFirstRow   = -1;
+    myRowsWidth  = 0;
+    addRowItems(stMin(myNbRows, myContent->getRectPx().height() / myList->getItemHeight() + 2));
+
+    // recycled items are created without text - compute the list width from all rows at once,
+    // so that the list is not collapsed and long names are not wrapped within fixed-height rows
+    if(StGLMenuItem* anItem = (StGLMenuItem* )myList->getChildren()->getStart()) {
+        int aTextWidth = myHasUpItem ? anItem->computeTextWidth("..") : 0;
+        const size_t aNbItems = myFolder->size();
+        for(size_t anItemIter = 0; anItemIter < aNbItems; ++anItemIter) {
+            aTextWidth = stMax(aTextWidth, anItem->computeTextWidth(myFolder->getValue(anItemIter)->getSubPath()));
+        }
+        myRowsWidth = anItem->getMargins().left + aTextWidth + anItem->getMargins().right;
     }
+    myList->changeRectPx().moveTopTo(0);
+    stglInit();
+}
 
-    const size_t aNbItems = myFolder->size();
-    for(size_t anItemIter = 0; anItemIter < aNbItems; ++anItemIter) {
-        const StFileNode* aNode = myFolder->getValue(anItemIter);
-        StString aName = aNode->getSubPath();
+void StGLOpenFile::addRowItems(const int theNbItems) {
+    for(int anItemIter = 0; anItemIter < theNbItems; ++anItemIter) {
         StGLMenuItem* anItem = new StGLPassiveMenuItem(myList);
-        setItemIcon(anItem, aNode->isFolder() ? myItemColor : myFileColor, aNode->isFolder());
-        anItem->setText(aName);
+        setItemIcon(anItem, myItemColor, true);
         anItem->setTextColor(myItemColor);
         anItem->setHilightColor(myHighlightColor);
-        anItem->setUserData(anItemIter);
-        anItem->signals.onItemClick = stSlot(this, &StGLOpenFile::doFileItemClick);
+        anItem->signals.onItemClick = stSlot(this, &StGLOpenFile::doListItemClick);
+    }
+    myNbRowItems += theNbItems;
+}
+
+bool StGLOpenFile::stglInit() {
+    myList->setItemWidthMin(stMax(myContent->getRectPx().width(), myRowsWidth));
+    const bool isOk = StGLMessageBox::stglInit();
+    if(myNbRowItems == 0) {
+        return isOk;
     }
+
+    stglInitRows();
+    return isOk;
+}
+
+void StGLOpenFile::stglInitRows() {
+    // menu layouts only recycled items - extend it to the whole list to scroll through
+    myList->changeRectPx().bottom() = myList->getRectPx().top() + myNbRows * myList->getItemHeight();
+    bindRows(true);
+    myContent->stglResize();
+}
+
+void StGLOpenFile::stglResize() {
+    StGLMessageBox::stglResize();
+    if(myList == NULL
+    || myNbRowItems == 0) {
+        return;
+    }
+
+    // visible part of the list might grow - extend the pool of recycled items
+    const int aNbRowItems = stMin(myNbRows, myContent->getRectPx().height() / myList->getItemHeight() + 2);
+    if(aNbRowItems <= myNbRowItems) {
+        return;
+    }
+
+    addRowItems(aNbRowItems - myNbRowItems);
     myList->stglInit();
-    stglInit();
+    stglInitRows();
+}
+
+void StGLOpenFile::bindRows(const bool theToForce) {
+    if(myNbRowItems == 0) {
+        return;
+    }
+
+    const int anItemSizeY = myList->getItemHeight();
+    const int aFirstRow   = stMax(-myList->getRectPx().top(), 0) / anItemSizeY;
+    if(aFirstRow == myFirstRow
+    && !theToForce) {
+        return;
+    }
+
+    myFirstRow = aFirstRow;
+    int anIter = 0;
+    for(StGLWidget* aChild = myList->getChildren()->getStart(); aChild != NULL; aChild = aChild->getNext(), ++anIter) {
+        StGLMenuItem* anItem = (StGLMenuItem* )aChild;
+        const int aRow = aFirstRow + (anIter - aFirstRow % myNbRowItems + myNbRowItems) % myNbRowItems;
+        if(aRow >= myNbRows) {
+            anItem->setOpacity(0.0f, false);
+            continue;
+        }
+
+        if(theToForce
+        || anItem->getUserData() != size_t(aRow)) {
+            bindRow(anItem, aRow);
+        }
+        anItem->setOpacity(1.0f, false);
+        anItem->changeRectPx().moveTopTo(aRow * anItemSizeY);
+    }
+}
+
+void StGLOpenFile::bindRow(StGLMenuItem* theItem,
+                           const int     theRow) {
+    theItem->setUserData(size_t(theRow));
+    theItem->setClicked(ST_MOUSE_LEFT, false);
+    StGLIcon* anIcon = theItem->getIcon();
+    if(myHasUpItem
+    && theRow == 0) {
+        theItem->setText("..");
+        if(anIcon != NULL) {
+            anIcon->setOpacity(0.0f, false);
+        }
+        return;
+    }
+
+    const StFileNode* aNode = myFolder->getValue(size_t(theRow - (myHasUpItem ? 1 : 0)));
+    theItem->setText(aNode->getSubPath());
+    if(anIcon == NULL) {
+        return;
+    }
+
+    const StHandle<StGLTextureArray>& aTextures = aNode->isFolder() ? myTextureFolder : myTextureFile;
+    anIcon->setColor(aNode->isFolder() ? myItemColor : myFileColor);
+    anIcon->setExternalTextures(aTextures);
+    anIcon->setOpacity(1.0f, false);
+    if(!aTextures->changeValue(0).isValid()) {
+        // texture is loaded on initialization
+        anIcon->stglInit();
+    }
+}
+
+void StGLOpenFile::stglDraw(unsigned int theView) {
+    if(isVisible()
+    && theView != ST_DRAW_RIGHT) {
+        bindRows(false);
+    }
+    StGLMessageBox::stglDraw(theView);
 }
@@ -1,6 +1,6 @@
 /**
  * StGLWidgets, small C++ toolkit for writing GUI using OpenGL.
- * Copyright © 2013-2015 Kirill Gavrilov <kirill@sview.ru
+ * Copyright © 2013-2017 Kirill Gavrilov <kirill@sview.ru
  *
  * Distributed under the Boost Software License, Version 1.0.
  * See accompanying file license-boost.txt or copy at
@@ -55,27 +55,39 @@ StGLMenuItem* StGLPlayList::addItem() {
     return aNewItem;
 }
 
-void StGLPlayList::doItemClick(const size_t theItem) {
-    if(myList->walkToPosition(myFromId + theItem)) {
+void StGLPlayList::doItemClick(const size_t theRow) {
+    if(myList->walkToPosition(theRow)) {
         signals.onOpenItem();
     }
 }
 
 void StGLPlayList::updateList() {
+    if(myItemsNb <= 0) {
+        return;
+    }
+
     StArrayList<StString> aList;
-    myList->getSubList(aList, myFromId, myFromId + myItemsNb);
-    const size_t aCurrent     = myList->getCurrentId() - myFromId;
+    myList->getSubList(aList, myFromId, myFromId + myItemsNb, true);
+    const size_t aCurrent     = myList->getCurrentId();
     const size_t anUpperLimit = aList.size();
+    const int    anItemSizeY  = myMenu->getItemHeight();
+    const size_t aShift       = myFromId % size_t(myItemsNb);
 
+    // each playlist position is bound to the same item while it remains on screen,
+    // so that scrolling re-formats only the text of items entering the view
     int anIter = 0;
     for(StGLWidget* aChild = myMenu->getChildren()->getStart();
         aChild != NULL && anIter < myItemsNb; ++anIter, aChild = aChild->getNext()) {
         StGLMenuItem* anItem = dynamic_cast<StGLMenuItem*>(aChild);
+        const size_t aSlot = (size_t(anIter) + size_t(myItemsNb) - aShift) % size_t(myItemsNb);
+        const size_t aRow  = myFromId + aSlot;
         anItem->setClicked(ST_MOUSE_LEFT, false);
-        if(size_t(anIter) < anUpperLimit) {
-            anItem->setText(aList.getValue(anIter));
+        anItem->setUserData(aRow);
+        anItem->changeRectPx().moveTopTo(int(aSlot) * anItemSizeY);
+        if(aSlot < anUpperLimit) {
+            anItem->setText(aList.getValue(aSlot));
             anItem->setOpacity(1.0f, false);
-            anItem->setFocus(size_t(anIter) == aCurrent);
+            anItem->setFocus(aRow == aCurrent);
             anItem->changeRectPx().right() = anItem->getRectPx().left() + myMenu->getItemWidth();
         } else {
             anItem->setText("");
@@ -83,7 +95,6 @@ void StGLPlayList::updateList() {
             //anItem->changeRectPx().right() = anItem->getRectPx().left();
         }
     }
-    stglInitMenu();
 }
 
 void StGLPlayList::doResetList() {
@@ -152,10 +163,6 @@ void StGLPlayList::stglResize() {
     const int anItemsOld = myItemsNb;
     myItemsNb = stMax(aNewHeight / myMenu->getItemHeight(), 0);
 
-    StArrayList<StString> aList;
-    myList->getSubList(aList, myFromId, myFromId + myItemsNb);
-    const size_t anUpperLimit = aList.size();
-
     for(int anIter = anItemsOld; anIter > myItemsNb; --anIter) {
         StGLWidget* aChild = myMenu->getChildren()->getLast();
         if(aChild != NULL) {
@@ -165,18 +172,12 @@ void StGLPlayList::stglResize() {
 
     for(int anIter = anItemsOld; anIter < myItemsNb; ++anIter) {
         StGLMenuItem* anItem = addItem();
-        anItem->setUserData(anIter);
         anItem->signals.onItemClick = stSlot(this, &StGLPlayList::doItemClick);
         anItem->StGLWidget::signals.onMouseClick   += stSlot(this, &StGLPlayList::doMouseClick);
         anItem->StGLWidget::signals.onMouseUnclick += stSlot(this, &StGLPlayList::doMouseUnclick);
 
         anItem->setHilightText();
         anItem->setHilightColor(StGLVec4(0.5f, 0.5f, 0.5f, 1.0f));
-
-        if(size_t(anIter) < anUpperLimit) {
-            anItem->setText(aList.getValue(anIter));
-            anItem->setOpacity(1.0f, false);
-        }
     }
 
     if(myItemsNb != anItemsOld) {
@@ -221,6 +222,9 @@ bool StGLPlayList::stglInitMenu() {
     myMenu->changeRectPx().bottom() = getRectPx().height();
     changeRectPx().right()  = getRectPx().left() + myMenu->getRectPx().width();
     resizeWidth();
+
+    // menu places items in order of creation - rebind them to visible positions
+    myToUpdateList = true;
     return true;
 }
 
@@ -364,13 +368,11 @@ void StGLPlayList::stglDraw(unsigned int theView) {
         updateList();
     }
 
-    const size_t aCurrent = myList->getCurrentId() - myFromId;
-    int anIter = 0;
-    for(StGLWidget* aChild = myMenu->getChildren()->getStart();
-        aChild != NULL; ++anIter, aChild = aChild->getNext()) {
+    const size_t aCurrent = myList->getCurrentId();
+    for(StGLWidget* aChild = myMenu->getChildren()->getStart(); aChild != NULL; aChild = aChild->getNext()) {
         StGLMenuItem* anItem = dynamic_cast<StGLMenuItem*>(aChild);
         if(anItem != NULL) {
-            anItem->setFocus(size_t(anIter) == aCurrent);
+            anItem->setFocus(anItem->getUserData() == aCurrent);
         }
     }
 
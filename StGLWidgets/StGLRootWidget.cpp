@@ -64,6 +64,7 @@ StGLRootWidget::StGLRootWidget(const StHandle<StResourceManager>& theResMgr)
   myCursorZo(0.0, 0.0),
   myFocusWidget(NULL),
   myModalDialog(NULL),
+  myTextBatch(NULL),
   myIsMenuPressed(false),
   myMenuIconSize(IconSize_16),
   myClickThreshold(3) {
@@ -8,6 +8,7 @@
  */
 
 #include <StGLWidgets/StGLTextArea.h>
+#include <StGLWidgets/StGLTextBatch.h>
 
 #include <StGLWidgets/StGLRootWidget.h>
 #include <StGLWidgets/StGLTextProgram.h>
@@ -20,6 +21,15 @@
 #include <StFile/StFileNode.h>
 #include <StThreads/StProcess.h>
 
+namespace {
+
+    /**
+     * Counter for unique identifiers of formatting results.
+     */
+    static size_t THE_TEXT_REVISION = 0;
+
+}
+
 StGLTextArea::StGLTextArea(StGLWidget* theParent,
                            const int theLeft, const int theTop,
                            const StGLCorner theCorner,
@@ -33,7 +43,9 @@ StGLTextArea::StGLTextArea(StGLWidget* theParent,
   myBorderColor(0.0f, 0.0f, 0.0f, 1.0f),
   myTextDX(0.0f),
   myTextWidth(-1.0f),
+  myTextRevision(0),
   myToRecompute(true),
+  myToUpload(false),
   myToShowBorder(false),
   myToDrawShadow(false),
   myIsInitialized(false) {
@@ -66,8 +78,11 @@ bool StGLTextArea::setText(const StString& theText) {
 }
 
 void StGLTextArea::setTextWidth(const int theWidth) {
-    myTextWidth = (GLfloat )theWidth;
-    myToRecompute = true;
+    const GLfloat aWidth = (GLfloat )theWidth;
+    if(myTextWidth != aWidth) {
+        myTextWidth = aWidth;
+        myToRecompute = true;
+    }
 }
 
 void StGLTextArea::computeTextWidthFake(const StString& theText,
@@ -224,12 +239,20 @@ void StGLTextArea::formatText(StGLContext& theCtx) {
         myFormatter.reset();
         myFormatter.append(theCtx, myText, *myFont);
         myFormatter.format(myTextWidth, GLfloat(getRectPx().height()));
-        myFormatter.getResult(theCtx, myTexturesList, myTextVertBuf, myTextTCrdBuf);
         myFormatter.getBndBox(myTextBndBox);
         if(myToShowBorder) {
             recomputeBorder(theCtx);
         }
-        myToRecompute = false;
+        myToRecompute  = false;
+        myToUpload     = true;
+        myTextRevision = ++THE_TEXT_REVISION;
+    }
+}
+
+void StGLTextArea::uploadText(StGLContext& theCtx) {
+    if(myToUpload) {
+        myFormatter.getResult(theCtx, myTexturesList, myTextVertBuf, myTextTCrdBuf);
+        myToUpload = false;
     }
 }
 
@@ -276,6 +299,19 @@ void StGLTextArea::stglDraw(unsigned int theView) {
     StRectD_t zparams; getCamera()->getZParams(zparams);
     GLfloat aSizeOut = 2.0f * GLfloat(zparams.top()) / GLfloat(getRoot()->getRootFullSizeY());
 
+    StGLTextBatch* aBatch = myRoot->getTextBatch();
+    if(aBatch != NULL
+    && !myToShowBorder
+    && !myToDrawShadow) {
+        // the text is drawn later by the batch owner together with the text of sibling widgets
+        aBatch->addText(myFormatter, myTextRevision,
+                        StGLVec2(GLfloat(aTextRectGl.left()) + myTextDX, GLfloat(aTextRectGl.top())),
+                        aSizeOut, aTextColor);
+        StGLWidget::stglDraw(theView);
+        return;
+    }
+    uploadText(aCtx);
+
     StGLMatrix aModelMat;
     aModelMat.translate(StGLVec3(getRoot()->getScreenDispX() + myTextDX, 0.0f, -getCamera()->getZScreen()));
     aModelMat.translate(StGLVec3(GLfloat(aTextRectGl.left()),
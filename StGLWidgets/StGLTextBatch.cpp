@@ -0,0 +1,154 @@
+/**
+ * StGLWidgets, small C++ toolkit for writing GUI using OpenGL.
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file license-boost.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+
+#include <StGLWidgets/StGLTextBatch.h>
+
+#include <StGLWidgets/StGLTextProgram.h>
+
+#include <StGL/StGLContext.h>
+#include <StGLCore/StGLCore20.h>
+
+StGLTextBatch::StGLTextBatch()
+: myNbStreams(0) {
+    //
+}
+
+StGLTextBatch::~StGLTextBatch() {
+    //
+}
+
+void StGLTextBatch::release(StGLContext& theCtx) {
+    for(size_t aStreamIter = 0; aStreamIter < myStreams.size(); ++aStreamIter) {
+        myStreams[aStreamIter]->VertBuf.release(theCtx);
+        myStreams[aStreamIter]->TCrdBuf.release(theCtx);
+    }
+    myStreams.clear();
+    myBlocks.clear();
+    myBuiltBlocks.clear();
+    myNbStreams = 0;
+}
+
+void StGLTextBatch::reset() {
+    myBlocks.clear();
+}
+
+void StGLTextBatch::addText(const StGLTextFormatter& theFormatter,
+                            const size_t             theRevision,
+                            const StGLVec2&          theOffset,
+                            const GLfloat            theScale,
+                            const StGLVec4&          theColor) {
+    Block aBlock;
+    aBlock.Formatter = &theFormatter;
+    aBlock.Revision  = theRevision;
+    aBlock.Offset    = theOffset;
+    aBlock.Scale     = theScale;
+    aBlock.Color     = theColor;
+    myBlocks.push_back(aBlock);
+}
+
+bool StGLTextBatch::isChanged() const {
+    if(myBlocks.size() != myBuiltBlocks.size()) {
+        return true;
+    }
+    for(size_t aBlockIter = 0; aBlockIter < myBlocks.size(); ++aBlockIter) {
+        if(!myBlocks[aBlockIter].isSame(myBuiltBlocks[aBlockIter])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void StGLTextBatch::rebuild(StGLContext& theCtx) {
+    myNbStreams = 0;
+
+    std::vector<GLuint> aTextures;
+    std::vector< StHandle < std::vector<StGLVec2> > > aVertsPerTexture;
+    std::vector< StHandle < std::vector<StGLVec2> > > aTCrdsPerTexture;
+    for(size_t aBlockIter = 0; aBlockIter < myBlocks.size(); ++aBlockIter) {
+        const Block& aBlock = myBlocks[aBlockIter];
+        if(aBlock.Color.a() <= 0.0f) {
+            continue;
+        }
+
+        aBlock.Formatter->getResult(aTextures, aVertsPerTexture, aTCrdsPerTexture);
+        for(size_t aTexIter = 0; aTexIter < aTextures.size(); ++aTexIter) {
+            size_t aStreamId = 0;
+            for(; aStreamId < myNbStreams; ++aStreamId) {
+                if(myStreams[aStreamId]->Texture == aTextures[aTexIter]
+                && myStreams[aStreamId]->Color   == aBlock.Color) {
+                    break;
+                }
+            }
+            if(aStreamId == myNbStreams) {
+                if(myNbStreams == myStreams.size()) {
+                    myStreams.push_back(new Stream());
+                }
+                Stream& aNewStream = *myStreams[myNbStreams++];
+                aNewStream.Texture = aTextures[aTexIter];
+                aNewStream.Color   = aBlock.Color;
+                aNewStream.Verts.clear();
+                aNewStream.TCrds.clear();
+            }
+
+            Stream& aStream = *myStreams[aStreamId];
+            const std::vector<StGLVec2>& aVerts = *aVertsPerTexture[aTexIter];
+            const std::vector<StGLVec2>& aTCrds = *aTCrdsPerTexture[aTexIter];
+            for(size_t aVertIter = 0; aVertIter < aVerts.size(); ++aVertIter) {
+                aStream.Verts.push_back(aBlock.Offset + aVerts[aVertIter] * aBlock.Scale);
+            }
+            aStream.TCrds.insert(aStream.TCrds.end(), aTCrds.begin(), aTCrds.end());
+        }
+    }
+
+    for(size_t aStreamIter = 0; aStreamIter < myNbStreams; ++aStreamIter) {
+        Stream& aStream = *myStreams[aStreamIter];
+        aStream.VertBuf.init(theCtx, aStream.Verts);
+        aStream.TCrdBuf.init(theCtx, aStream.TCrds);
+        aStream.Verts.clear();
+        aStream.TCrds.clear();
+    }
+    myBuiltBlocks = myBlocks;
+}
+
+void StGLTextBatch::stglDraw(StGLContext&      theCtx,
+                             StGLTextProgram&  theProgram,
+                             const StGLMatrix& theModelMat) {
+    if(isChanged()) {
+        rebuild(theCtx);
+    }
+    if(myNbStreams == 0) {
+        return;
+    }
+
+    theCtx.core20fwd->glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    theCtx.core20fwd->glEnable(GL_BLEND);
+    theCtx.core20fwd->glActiveTexture(GL_TEXTURE0);
+    theProgram.use(theCtx);
+    theProgram.setModelMat(theCtx, theModelMat);
+    for(size_t aStreamIter = 0; aStreamIter < myNbStreams; ++aStreamIter) {
+        const Stream& aStream = *myStreams[aStreamIter];
+        if(!aStream.VertBuf.isValid()
+        ||  aStream.VertBuf.getElemsCount() < 1) {
+            continue;
+        }
+
+        theProgram.setColor(theCtx, aStream.Color);
+        theCtx.core20fwd->glBindTexture(GL_TEXTURE_2D, aStream.Texture);
+        aStream.VertBuf.bindVertexAttrib(theCtx, theProgram.getVVertexLoc());
+        aStream.TCrdBuf.bindVertexAttrib(theCtx, theProgram.getVTexCoordLoc());
+
+        theCtx.core20fwd->glDrawArrays(GL_TRIANGLES, 0, GLsizei(aStream.VertBuf.getElemsCount()));
+
+        aStream.TCrdBuf.unBindVertexAttrib(theCtx, theProgram.getVTexCoordLoc());
+        aStream.VertBuf.unBindVertexAttrib(theCtx, theProgram.getVVertexLoc());
+    }
+    theCtx.core20fwd->glBindTexture(GL_TEXTURE_2D, 0);
+    theProgram.unuse(theCtx);
+    theCtx.core20fwd->glDisable(GL_BLEND);
+}
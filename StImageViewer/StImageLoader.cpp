@@ -22,6 +22,7 @@
 #include "StImageViewerGUI.h"
 
 #include <StAV/StAVImage.h>
+#include <StImage/StImagePyramid.h>
 #include <StThreads/StThread.h>
 
 using namespace StImageViewerStrings;
@@ -62,12 +63,14 @@ StImageLoader::StImageLoader(const StImageFile::ImageClass      theImageLib,
   myMaxTexDim(theMaxTexDim),
   myTextureQueue(theTextureQueue),
   myMsgQueue(theMsgQueue),
+  myInfoIndex(new StMediaInfoIndex(theResMgr->getCacheFolder() + "imageinfo.idx")),
   myImageLib(theImageLib),
   myAction(Action_NONE),
   myToStickPano360(false),
   myToFlipCubeZ6x1(false),
   myToFlipCubeZ3x2(false) {
       myPlayList->setExtensions(myMimeList.getExtensionsList());
+      myPlayList->setInfoIndex(myInfoIndex);
       myThread = new StThread(threadFunction, (void* )this, "StImageLoader");
 }
 
@@ -76,12 +79,17 @@ StImageLoader::~StImageLoader() {
     myLoadNextEvent.set(); // stop the thread
     myThread->wait();
     myThread.nullify();
+    myInfoIndex->save();
 }
 
 void StImageLoader::setCompressMemory(const bool theToCompress) {
     myTextureQueue->setCompressMemory(theToCompress);
 }
 
+void StImageLoader::setCompactStorage(const bool theToCompact) {
+    myTextureQueue->setCompactStorage(theToCompact);
+}
+
 void StImageLoader::processLoadFail(const StString& theErrorDesc) {
     myMsgQueue->pushError(theErrorDesc);
     myTextureQueue->setConnectedStream(false);
@@ -89,21 +97,21 @@ void StImageLoader::processLoadFail(const StString& theErrorDesc) {
 }
 
 void StImageLoader::metadataFromExif(const StHandle<StExifDir>& theDir,
-                                     StHandle<StImageInfo>&     theInfo) {
+                                     StArgumentsMap&            theInfo) {
     if(theDir.isNull()) {
         return;
     }
 
     if(!theDir->CameraMaker.isEmpty()) {
-        StDictEntry& anEntry  = theInfo->Info.addChange("Exif.Image.Make");
+        StDictEntry& anEntry  = theInfo.addChange("Exif.Image.Make");
         anEntry.changeValue() = theDir->CameraMaker;
     }
     if(!theDir->CameraModel.isEmpty()) {
-        StDictEntry& anEntry  = theInfo->Info.addChange("Exif.Image.Model");
+        StDictEntry& anEntry  = theInfo.addChange("Exif.Image.Model");
         anEntry.changeValue() = theDir->CameraModel;
     }
     if(!theDir->UserComment.isEmpty()) {
-        StDictEntry& anEntry  = theInfo->Info.addChange("Exif.UserComment");
+        StDictEntry& anEntry  = theInfo.addChange("Exif.UserComment");
         anEntry.changeValue() = theDir->UserComment;
     }
 
@@ -112,12 +120,35 @@ void StImageLoader::metadataFromExif(const StHandle<StExifDir>& theDir,
     }
 }
 
+void StImageInfo::fillDeferredMetadata() {
+    if(JpegHeaders.isNull()) {
+        return;
+    }
+
+    StHandle<StJpegParser::Image> anImg = JpegHeaders->getImage(0);
+    JpegHeaders.nullify();
+    if(anImg.isNull()) {
+        return;
+    }
+
+    const StExifDir::List& anExif = anImg->getExif();
+    for(size_t anExifId = 0; anExifId < anExif.size(); ++anExifId) {
+        StImageLoader::metadataFromExif(anExif[anExifId], Info);
+    }
+    const StString aTime = anImg->getDateTime();
+    if(!aTime.isEmpty()) {
+        StDictEntry& anEntry  = Info.addChange("Exif.Image.DateTime");
+        anEntry.changeValue() = aTime;
+    }
+}
+
 inline StHandle<StImage> scaledImage(StHandle<StImageFile>& theRef,
                                      const size_t           theMaxSizeX,
                                      const size_t           theMaxSizeY,
                                      StCubemap              theCubemap,
                                      const size_t*          theCubeCoeffs,
-                                     StPairRatio            thePairRatio) {
+                                     StPairRatio            thePairRatio,
+                                     const bool             theToKeepSource = false) {
     if(theRef->isNull()) {
         return theRef;
     }
@@ -182,7 +213,9 @@ inline StHandle<StImage> scaledImage(StHandle<StImageFile>& theRef,
         ST_ERROR_LOG("Scale failed!");
         return theRef;
     }
-    theRef->close();
+    if(!theToKeepSource) {
+        theRef->close();
+    }
     return anImage;
 }
 
@@ -238,6 +271,7 @@ bool StImageLoader::loadImage(const StHandle<StFileNode>& theSource,
 
     StTimer aLoadTimer(true);
     StFormat  aSrcFormatCurr = myStFormatByUser;
+    StMediaInfoIndex::Entry anIndexEntry;
     if(anImgType == StImageFile::ST_TYPE_MPO
     || anImgType == StImageFile::ST_TYPE_JPEG
     || anImgType == StImageFile::ST_TYPE_JPS) {
@@ -287,14 +321,8 @@ bool StImageLoader::loadImage(const StHandle<StFileNode>& theSource,
             anEntry.changeValue() = aParser.getJpsComment();
         }
         if(!anImg1.isNull()) {
-            for(size_t anExifId = 0; anExifId < anImg1->Exif.size(); ++anExifId) {
-                metadataFromExif(anImg1->Exif[anExifId], anImgInfo);
-            }
-            const StString aTime = anImg1->getDateTime();
-            if(!aTime.isEmpty()) {
-                StDictEntry& anEntry  = anImgInfo->Info.addChange("Exif.Image.DateTime");
-                anEntry.changeValue() = aTime;
-            }
+            // EXIF will be decoded and formatted only when file info is requested
+            anImgInfo->JpegHeaders = aParser.copyHeaders(anImg1);
         }
         if(myStFormatByUser == StFormat_AUTO
         && aParser.getSrcFormat() != StFormat_AUTO) {
@@ -316,7 +344,8 @@ bool StImageLoader::loadImage(const StHandle<StFileNode>& theSource,
 
         // read image from memory
         const StJpegParser::Orient anOrient = anImg1->getOrientation();
-        theParams->setZRotateZero((GLfloat )StJpegParser::getRotationAngle(anOrient));
+        anIndexEntry.Rotation = StJpegParser::getRotationAngle(anOrient);
+        theParams->setZRotateZero((GLfloat )anIndexEntry.Rotation);
         anImg1->getParallax(anHParallax);
         if(!anImageFileL->load(aFilePath, StImageFile::ST_TYPE_JPEG,
                                (uint8_t* )anImg1->Data, (int )anImg1->Length)
@@ -342,6 +371,7 @@ bool StImageLoader::loadImage(const StHandle<StFileNode>& theSource,
                 anEntry.changeValue() = StString(anHParallax);
             }
             theParams->setSeparationNeutral(aParallaxPx);
+            anIndexEntry.Parallax = anHParallax;
         } else if(anImgType == StImageFile::ST_TYPE_MPO) {
             ST_DEBUG_LOG("MPO image \"" + aFilePath + "\" is invalid!");
         }
@@ -466,7 +496,14 @@ bool StImageLoader::loadImage(const StHandle<StFileNode>& theSource,
         }
     }
 
-    StHandle<StImage> anImageL = scaledImage(anImageFileL, aSizeXLim, aSizeYLim, aSrcCubemap, aCubeCoeffs, aPairRatio);
+    // keep full-resolution mono image as tiled pyramid to show sharp picture on zooming
+    const bool toBuildPyramid = anImageFileR->isNull()
+                             && aSrcCubemap == StCubemap_OFF
+                             && theParams->ViewingMode == StViewSurface_Plain
+                             && (aSrcFormatCurr == StFormat_AUTO || aSrcFormatCurr == StFormat_Mono)
+                             && (aSizeX1 > aSizeXLim || aSizeY1 > aSizeYLim)
+                             && StImagePyramid::isSupported(*anImageFileL);
+    StHandle<StImage> anImageL = scaledImage(anImageFileL, aSizeXLim, aSizeYLim, aSrcCubemap, aCubeCoeffs, aPairRatio, toBuildPyramid);
     StHandle<StImage> anImageR = scaledImage(anImageFileR, aSizeXLim, aSizeYLim, aSrcCubemap, aCubeCoeffs, aPairRatio);
 #ifdef ST_DEBUG
     const double aScaleTimeMSec = aLoadTimer.getElapsedTimeInMilliSec() - aLoadTimeMSec;
@@ -484,8 +521,19 @@ bool StImageLoader::loadImage(const StHandle<StFileNode>& theSource,
     }
 #endif
 
+    StHandle<StImagePyramid> aPyramid;
+    if(toBuildPyramid
+    && anImageL != anImageFileL) {
+        aPyramid = new StImagePyramid();
+        if(!aPyramid->init(anImageFileL, anImageL->getSizeX(), anImageL->getSizeY(), StImagePyramid::DEFAULT_TILE_SIZE)) {
+            aPyramid.nullify();
+            anImageFileL->close();
+        }
+    }
+
     // finally push image data in Texture Queue
     myTextureQueue->setConnectedStream(true);
+    myTextureQueue->setPyramid(aPyramid, theParams);
 
     {
         StImage anImageRefL, anImageRefR;
@@ -530,6 +578,16 @@ bool StImageLoader::loadImage(const StHandle<StFileNode>& theSource,
     myImgInfo = anImgInfo;
     myLock.unlock();
 
+    if(theSource->size() < 2) {
+        // remember properties so that they can be retrieved without opening the file
+        anIndexEntry.SizeX        = (int )theParams->Src1SizeX;
+        anIndexEntry.SizeY        = (int )theParams->Src1SizeY;
+        anIndexEntry.NbImages     = theParams->Src2SizeX != 0 ? 2 : 1;
+        anIndexEntry.StereoFormat = anImgInfo->StInfoStream;
+        anIndexEntry.StreamKinds  = StMediaInfoIndex::StreamKind_Video;
+        myInfoIndex->update(aFilePath, anIndexEntry);
+    }
+
     // clean up - close opened files and reset memory
     anImageL.nullify();
     anImageR.nullify();
@@ -651,6 +709,45 @@ bool StImageLoader::saveImage(const StHandle<StFileNode>&     theSource,
     return true;
 }
 
+StHandle<StImageInfo> StImageLoader::getFileInfoFromIndex(const StHandle<StFileNode>&     theFile,
+                                                          const StHandle<StStereoParams>& theParams) const {
+    if(theFile.isNull()
+    || theFile->size() >= 2) {
+        return NULL;
+    }
+
+    const StString aFilePath = theFile->getPath();
+    StMediaInfoIndex::Entry anEntry;
+    if(!myInfoIndex->scan(aFilePath, anEntry)) {
+        return NULL;
+    }
+
+    StHandle<StImageInfo> anInfo = new StImageInfo();
+    anInfo->Id           = theParams;
+    anInfo->Path         = aFilePath;
+    anInfo->ImageType    = StImageFile::guessImageType(aFilePath, theFile->getMIME());
+    anInfo->StInfoStream = anEntry.StereoFormat;
+
+    StString aTitleString, aFolder;
+    StFileNode::getFolderAndFile(aFilePath, aFolder, aTitleString);
+    bool isAnamorphByName = false;
+    anInfo->StInfoFileName = st::formatFromName(aTitleString, isAnamorphByName);
+    anInfo->Info.add(StArgument(tr(INFO_FILE_NAME), aTitleString));
+    if(anEntry.SizeX > 0
+    && anEntry.SizeY > 0) {
+        anInfo->Info.add(StArgument(tr(INFO_DIMENSIONS), StString() + anEntry.SizeX + " x " + anEntry.SizeY));
+    }
+    if(anEntry.StereoFormat != StFormat_AUTO) {
+        StDictEntry& aFormatEntry  = anInfo->Info.addChange("Jpeg.JpsStereo");
+        aFormatEntry.changeValue() = tr(StImageViewerGUI::trSrcFormatId(anEntry.StereoFormat));
+    }
+    if(anEntry.Parallax != 0.0) {
+        StDictEntry& aParallaxEntry  = anInfo->Info.addChange("Exif.Fujifilm.Parallax");
+        aParallaxEntry.changeValue() = StString(anEntry.Parallax);
+    }
+    return anInfo;
+}
+
 bool StImageLoader::saveImageInfo(const StHandle<StImageInfo>& theInfo) {
     if(theInfo.isNull()
     || theInfo->Path.isEmpty()) {
@@ -684,6 +781,7 @@ bool StImageLoader::saveImageInfo(const StHandle<StImageInfo>& theInfo) {
 void StImageLoader::mainLoop() {
     StHandle<StFileNode>     aFileToLoad;
     StHandle<StStereoParams> aFileParams;
+    myInfoIndex->load();
     for(;;) {
         myLoadNextEvent.wait();
         switch(myAction) {
@@ -20,6 +20,7 @@
 #define __StImageLoader_h_
 
 #include <StStrings/StMsgQueue.h>
+#include <StFile/StMediaInfoIndex.h>
 #include <StFile/StMIMEList.h>
 #include <StGL/StPlayList.h>
 #include <StGLStereo/StGLTextureQueue.h>
@@ -41,9 +42,16 @@ struct StImageInfo {
     StFormat                 StInfoStream;   //!< source format as stored in file metadata
     StFormat                 StInfoFileName; //!< source format detected from file name
     bool                     IsSavable;      //!< indicate that file can be saved without re-encoding
+    StHandle<StJpegParser>   JpegHeaders;    //!< JPEG headers which EXIF should be appended to Info on demand
 
     StImageInfo() : ImageType(StImageFile::ST_TYPE_NONE), StInfoStream(StFormat_AUTO), StInfoFileName(StFormat_AUTO), IsSavable(false) {}
 
+    /**
+     * Decode and format deferred EXIF metadata into Info map.
+     * Should be called from GUI thread before displaying Info.
+     */
+    ST_LOCAL void fillDeferredMetadata();
+
 };
 
 /**
@@ -51,6 +59,8 @@ struct StImageInfo {
  */
 class StImageLoader {
 
+    friend struct StImageInfo;
+
         public:
 
     enum Action {
@@ -121,6 +131,16 @@ class StImageLoader {
         return (!anInfo.isNull() && anInfo->Id == theParams) ? anInfo : NULL;
     }
 
+    /**
+     * Retrieve basic properties of not (yet) loaded file from persistent index,
+     * scanning only file headers when file is not indexed.
+     * @param theFile   file node
+     * @param theParams file parameters to be used as info identifier
+     * @return NULL if properties are unavailable
+     */
+    ST_LOCAL StHandle<StImageInfo> getFileInfoFromIndex(const StHandle<StFileNode>&     theFile,
+                                                        const StHandle<StStereoParams>& theParams) const;
+
     ST_LOCAL void setStereoFormat(const StFormat theSrcFormat) {
         myStFormatByUser = theSrcFormat;
     }
@@ -134,6 +154,11 @@ class StImageLoader {
      */
     ST_LOCAL void setCompressMemory(const bool theToCompress);
 
+    /**
+     * Store float and 16-bit RGB images in compact texture formats.
+     */
+    ST_LOCAL void setCompactStorage(const bool theToCompact);
+
     /**
      * Stick to panorama 360 mode.
      */
@@ -187,8 +212,8 @@ class StImageLoader {
     /**
      * Fill metadata map from EXIF.
      */
-    ST_LOCAL void metadataFromExif(const StHandle<StExifDir>& theDir,
-                                   StHandle<StImageInfo>&     theInfo);
+    ST_LOCAL static void metadataFromExif(const StHandle<StExifDir>& theDir,
+                                          StArgumentsMap&            theInfo);
 
     ST_LOCAL const StString& tr(const size_t theId) const {
         return myLangMap->getValue(theId);
@@ -209,6 +234,7 @@ class StImageLoader {
     StHandle<StImageInfo>       myImgInfo;       //!< info about currently loaded image
     StHandle<StImageInfo>       myInfoToSave;    //!< modified info to be saved
     StHandle<StMsgQueue>        myMsgQueue;      //!< messages queue
+    StHandle<StMediaInfoIndex>  myInfoIndex;     //!< persistent index of image properties
 
     volatile StImageFile::ImageClass myImageLib;
     volatile Action            myAction;
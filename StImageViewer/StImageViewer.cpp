@@ -115,6 +115,7 @@ void StImageViewer::updateStrings() {
     params.IsVSyncOn->setName(tr(MENU_VSYNC));
     params.ToOpenLast->setName(tr(OPTION_OPEN_LAST_ON_STARTUP));
     params.ToSaveRecent->setName(stCString("Remember recent file"));
+    params.ToCompactTextures->setName(tr(OPTION_COMPACT_TEXTURES));
     params.TargetFps->setName(stCString("FPS Target"));
     myLangMap->params.language->setName(tr(MENU_HELP_LANGS));
 }
@@ -194,6 +195,8 @@ StImageViewer::StImageViewer(const StHandle<StResourceManager>& theResMgr,
     StApplication::params.VSyncMode->setValue(StGLContext::VSync_ON);
     params.ToOpenLast   = new StBoolParamNamed(false, stCString("toOpenLast"));
     params.ToSaveRecent = new StBoolParamNamed(false, stCString("toSaveRecent"));
+    params.ToCompactTextures = new StBoolParamNamed(false, stCString("toCompactTextures"));
+    params.ToCompactTextures->signals.onChanged = stSlot(this, &StImageViewer::doChangeCompactTextures);
     params.imageLib = StImageFile::ST_LIBAV,
     params.TargetFps = new StInt32ParamNamed(0, stCString("fpsTarget"));
     updateStrings();
@@ -217,6 +220,7 @@ StImageViewer::StImageViewer(const StHandle<StResourceManager>& theResMgr,
     mySettings->loadParam (params.ToHideStatusBar);
     mySettings->loadParam (params.ToHideNavBar);
     mySettings->loadParam (params.ToOpenLast);
+    mySettings->loadParam (params.ToCompactTextures);
     mySettings->loadParam (params.IsVSyncOn);
     mySettings->loadParam (params.ToShowPlayList);
     mySettings->loadParam (params.ToShowAdjustImage);
@@ -373,6 +377,7 @@ void StImageViewer::saveAllParams() {
         mySettings->saveParam (params.ToHideStatusBar);
         mySettings->saveParam (params.ToHideNavBar);
         mySettings->saveParam (params.ToOpenLast);
+        mySettings->saveParam (params.ToCompactTextures);
         mySettings->saveParam (params.IsVSyncOn);
         mySettings->saveParam (params.ToShowPlayList);
         mySettings->saveParam (params.ToShowAdjustImage);
@@ -530,6 +535,7 @@ bool StImageViewer::init() {
                                  myGUI->myImage->getTextureQueue(), myContext->getMaxTextureSize());
     myLoader->signals.onLoaded.connect(this, &StImageViewer::doLoaded);
     myLoader->setCompressMemory(myWindow->isMobile());
+    myLoader->setCompactStorage(params.ToCompactTextures->getValue());
     myLoader->setStickPano360(params.ToStickPanorama->getValue());
     myLoader->setFlipCubeZ6x1(params.ToFlipCubeZ6x1->getValue());
     myLoader->setFlipCubeZ3x2(params.ToFlipCubeZ3x2->getValue());
@@ -1102,7 +1108,8 @@ void StImageViewer::stglDraw(unsigned int theView) {
     myGUI->changeCamera()->setView(theView);
     if(theView == ST_DRAW_LEFT
     || theView == ST_DRAW_MONO) {
-        if(!myWindow->isActive()) {
+        if(!myWindow->isActive()
+        && !myGUI->myImage->hasPendingTiles()) {
             // enforce deep sleeps
             StThread::sleep(200);
         }
@@ -1241,6 +1248,14 @@ void StImageViewer::doChangeFlipCubeZ(const bool ) {
     myLoader->setFlipCubeZ3x2(params.ToFlipCubeZ3x2->getValue());
 }
 
+void StImageViewer::doChangeCompactTextures(const bool theToCompact) {
+    if(myLoader.isNull()) {
+        return;
+    }
+
+    myLoader->setCompactStorage(theToCompact);
+}
+
 void StImageViewer::doOpen1FileFromGui(StHandle<StString> thePath) {
     myOpenDialog->setPaths(*thePath, "");
 }
@@ -1382,5 +1397,9 @@ bool StImageViewer::getCurrentFile(StHandle<StFileNode>&     theFileNode,
         return false;
     }
     theInfo = myLoader->getFileInfo(theParams);
+    if(theInfo.isNull()) {
+        // file is not loaded yet - show properties from the index without waiting for decoding
+        theInfo = myLoader->getFileInfoFromIndex(theFileNode, theParams);
+    }
     return true;
 }
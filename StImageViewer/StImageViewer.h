@@ -148,6 +148,7 @@ class StImageViewer : public StApplication {
         StHandle<StBoolParamNamed>    IsVSyncOn;        //!< flag to use VSync
         StHandle<StBoolParamNamed>    ToOpenLast;       //!< option to open last file from recent list by default
         StHandle<StBoolParamNamed>    ToSaveRecent;     //!< load/save recent file
+        StHandle<StBoolParamNamed>    ToCompactTextures;//!< store HDR images in half-float / packed 10-bit textures
         StString                      lastFolder;       //!< laster folder used to open / save file
         StImageFile::ImageClass       imageLib;         //!< preferred image library
         StHandle<StInt32ParamNamed>   TargetFps;        //!< limit or not rendering FPS
@@ -191,6 +192,7 @@ class StImageViewer : public StApplication {
     ST_LOCAL void doPanoramaOnOff(const size_t );
     ST_LOCAL void doChangeStickPano360(const bool );
     ST_LOCAL void doChangeFlipCubeZ(const bool );
+    ST_LOCAL void doChangeCompactTextures(const bool theToCompact);
     ST_LOCAL void doShowPlayList(const bool theToShow);
     ST_LOCAL void doShowAdjustImage(const bool theToShow);
     ST_LOCAL void doFileNext();
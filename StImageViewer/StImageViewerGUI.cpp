@@ -594,6 +594,7 @@ void StImageViewerGUI::doAboutImage(const size_t ) {
         setModalDialog(aMsgBox);
         return;
     }
+    anExtraInfo->fillDeferredMetadata();
 
     const StString aTitle  = tr(DIALOG_FILE_INFO);
     StInfoDialog*  aDialog = new StInfoDialog(myPlugin, this, aTitle, scale(512), scale(300));
@@ -787,6 +788,7 @@ void StImageViewerGUI::doMobileSettings(const size_t ) {
     aParams.add(myPlugin->params.ToFlipCubeZ3x2);
     aParams.add(myPlugin->params.ToShowFps);
     aParams.add(myPlugin->params.SlideShowDelay);
+    aParams.add(myPlugin->params.ToCompactTextures);
     aParams.add(myLangMap->params.language);
     aParams.add(myPlugin->params.IsMobileUI);
     if(isMobile()) {
@@ -1435,6 +1437,12 @@ void StImageViewerGUI::setVisibility(const StPointD_t& theCursor,
     StQuaternion<double> aQ = myWindow->getDeviceOrientation();
     myImage->setDeviceOrientation(StGLQuaternion((float )aQ.x(), (float )aQ.y(), (float )aQ.z(), (float )aQ.w()));
 
+    // head-locked GUI should not be rotated together with panorama by output reprojection
+    const bool hasOverlay = anOpacity > 0.0f
+                         || myIsMinimalGUI
+                         || getFocus() != NULL; // message box or dialog
+    myWindow->setReprojectionFov(!hasOverlay ? myImage->getPanoramaTanHalfFov() : 0.0f);
+
     if(myDescr != NULL) {
         bool wasEmpty = myDescr->getText().isEmpty();
         if(::isPointIn(myBtnOpen, theCursor)) {
@@ -237,6 +237,8 @@ void loadDefaults(StLangMap& theStrings) {
                "Hide system navigation bar");
     theStrings(OPTION_OPEN_LAST_ON_STARTUP,
                "Open last viewed file on startup");
+    theStrings(OPTION_COMPACT_TEXTURES,
+               "Compact textures for HDR images");
 
     theStrings(UPDATES_NOTIFY,
                "A new version of sView is available on the official site www.sview.ru.\n"
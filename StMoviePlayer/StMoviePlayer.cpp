@@ -158,6 +158,7 @@ void StMoviePlayer::updateStrings() {
     params.ToHideStatusBar->setName("Hide system status bar");
     params.ToHideNavBar   ->setName(tr(OPTION_HIDE_NAVIGATION_BAR));
     params.ToOpenLast     ->setName(tr(OPTION_OPEN_LAST_ON_STARTUP));
+    params.ToCompactTextures->setName(tr(OPTION_COMPACT_TEXTURES));
     params.ToShowExtra->setName(tr(MENU_HELP_EXPERIMENTAL));
     params.TargetFps->setName(stCString("FPS Target"));
 
@@ -288,6 +289,8 @@ StMoviePlayer::StMoviePlayer(const StHandle<StResourceManager>& theResMgr,
     params.ToHideNavBar    = new StBoolParamNamed(true, stCString("toHideNavBar"));
     params.ToHideNavBar   ->signals.onChanged = stSlot(this, &StMoviePlayer::doHideSystemBars);
     params.ToOpenLast    = new StBoolParamNamed(false, stCString("toOpenLast"));
+    params.ToCompactTextures = new StBoolParamNamed(false, stCString("toCompactTextures"));
+    params.ToCompactTextures->signals.onChanged = stSlot(this, &StMoviePlayer::doChangeCompactTextures);
     params.ToShowExtra   = new StBoolParamNamed(false, stCString("experimental"));
     // set rendering FPS as twice as average video FPS
     params.TargetFps = new StInt32ParamNamed(2, stCString("fpsTarget"));
@@ -344,6 +347,7 @@ StMoviePlayer::StMoviePlayer(const StHandle<StResourceManager>& theResMgr,
     mySettings->loadParam (params.ToHideStatusBar);
     mySettings->loadParam (params.ToHideNavBar);
     mySettings->loadParam (params.ToOpenLast);
+    mySettings->loadParam (params.ToCompactTextures);
     mySettings->loadParam (params.ToShowExtra);
     if(params.StartWebUI->getValue() == WEBUI_ONCE) {
         params.StartWebUI->setValue(WEBUI_OFF);
@@ -542,6 +546,7 @@ void StMoviePlayer::saveGuiParams() {
     mySettings->saveParam (myGUI->myImage->params.DisplayMode);
     mySettings->saveInt32 (ST_SETTING_GAMMA,       stRound(100.0f * myGUI->myImage->params.Gamma->getValue()));
     mySettings->saveParam (myGUI->myImage->params.ToHealAnamorphicRatio);
+    mySettings->saveParam (myGUI->myImage->params.ToUploadVisible);
     mySettings->saveInt32(myGUI->myImage->params.DisplayRatio->getKey(),
                           params.ToRestoreRatio->getValue()
                         ? myGUI->myImage->params.DisplayRatio->getValue()
@@ -594,6 +599,7 @@ void StMoviePlayer::saveAllParams() {
         mySettings->saveParam (params.ToHideStatusBar);
         mySettings->saveParam (params.ToHideNavBar);
         mySettings->saveParam (params.ToOpenLast);
+        mySettings->saveParam (params.ToCompactTextures);
         mySettings->saveParam (params.ToShowExtra);
 
         // store hot-keys
@@ -656,6 +662,7 @@ bool StMoviePlayer::createGui(StHandle<StGLTextureQueue>& theTextureQueue,
     mySettings->loadParam (myGUI->myImage->params.TextureFilter);
     mySettings->loadParam (myGUI->myImage->params.DisplayRatio);
     mySettings->loadParam (myGUI->myImage->params.ToHealAnamorphicRatio);
+    mySettings->loadParam (myGUI->myImage->params.ToUploadVisible);
     params.ToRestoreRatio->setValue(myGUI->myImage->params.DisplayRatio->getValue() != StGLImageRegion::RATIO_AUTO);
     int32_t loadedGamma = 100; // 1.0f
         mySettings->loadInt32(ST_SETTING_GAMMA, loadedGamma);
@@ -829,6 +836,7 @@ bool StMoviePlayer::init() {
         myGUI.nullify();
         return false;
     }
+    aTextureQueue->setCompactStorage(params.ToCompactTextures->getValue());
 
     // capture multimedia keys even without window focus
     myWindow->setAttribute(StWinAttr_GlobalMediaKeys, params.AreGlobalMKeys->getValue());
@@ -1604,8 +1612,19 @@ void StMoviePlayer::stglDraw(unsigned int theView) {
         return;
     }
 
+    // frame boundary for playback statistics
+    StFrameStatistics* aStats = !myVideo.isNull() ? &myVideo->getTextureQueue()->changeStatistics() : NULL;
+    if(aStats != NULL
+    && (theView == ST_DRAW_LEFT || theView == ST_DRAW_MONO)) {
+        aStats->nextFrame(myWindow->getTargetFps());
+    }
+
+    StTimer aRenderTimer(true);
     myGUI->changeCamera()->setView(theView);
     myGUI->stglDraw(theView);
+    if(aStats != NULL) {
+        aStats->addRenderTime(aRenderTimer.getElapsedTimeInMilliSec());
+    }
 }
 
 void StMoviePlayer::doShowPlayList(const bool theToShow) {
@@ -1973,6 +1992,14 @@ void StMoviePlayer::doSetBenchmark(const bool theValue) {
     myVideo->setBenchmark(theValue);
 }
 
+void StMoviePlayer::doChangeCompactTextures(const bool theToCompact) {
+    if(myVideo.isNull()) {
+        return;
+    }
+
+    myVideo->getTextureQueue()->setCompactStorage(theToCompact);
+}
+
 bool StMoviePlayer::getCurrentFile(StHandle<StFileNode>&     theFileNode,
                                    StHandle<StStereoParams>& theParams,
                                    StHandle<StMovieInfo>&    theInfo) {
@@ -1981,6 +2008,10 @@ bool StMoviePlayer::getCurrentFile(StHandle<StFileNode>&     theFileNode,
         return false;
     }
     theInfo = myVideo->getFileInfo(theParams);
+    if(theInfo.isNull()) {
+        // file is not opened yet - show properties from the index without waiting for probing
+        theInfo = myVideo->getFileInfoFromIndex(theFileNode, theParams);
+    }
     return true;
 }
 
@@ -2016,6 +2047,7 @@ int StMoviePlayer::beginRequest(mg_connection*         theConnection,
 
     // process AJAX requests
     StString aContent;
+    StString aContentType = "text/plain";
     if(anURI.isEquals(stCString("/prev"))) {
         invokeAction(Action_ListPrev);
         aContent = "open previous item in playlist...";
@@ -2054,6 +2086,10 @@ int StMoviePlayer::beginRequest(mg_connection*         theConnection,
         myVideo->pushPlayEvent(ST_PLAYEVENT_RESUME);
         myVideo->doLoadNext();
         aContent = "open item...";
+    } else if(anURI.isEquals(stCString("/stats"))) {
+        // return playback statistics
+        aContentType = "application/json";
+        aContent = StFrameStatistics::formatJson(myVideo->getTextureQueue()->changeStatistics().getSnapshot());
     } else if(anURI.isEquals(stCString("/version"))) {
         aContent = StVersionInfo::getSDKVersionString();
     } else if(anURI.isEquals(stCString("/playlist"))) {
@@ -2089,10 +2125,9 @@ int StMoviePlayer::beginRequest(mg_connection*         theConnection,
     }
 
     const StString anAnswer = StString("HTTP/1.1 200 OK\r\n"
-                                       //"Content-Type: text/html; charset=utf-8\r\n"
-                                       "Content-Type: text/plain; charset=utf-8\r\n"
-                                       "Content-Length: ") + aContent.getSize() + "\r\n"
-                                        "\r\n" + aContent;
+                                       "Content-Type: ") + aContentType + "; charset=utf-8\r\n"
+                                       "Content-Length: " + aContent.getSize() + "\r\n"
+                                       "\r\n" + aContent;
 
     // send HTTP reply to the client
     mg_write(theConnection, anAnswer.toCString(), anAnswer.getSize());
@@ -223,6 +223,7 @@ class StMoviePlayer : public StApplication {
         StHandle<StBoolParamNamed>    ToHideStatusBar;   //!< hide system-provided status bar
         StHandle<StBoolParamNamed>    ToHideNavBar;      //!< hide system-provided navigation bar
         StHandle<StBoolParamNamed>    ToOpenLast;        //!< option to open last file from recent list by default
+        StHandle<StBoolParamNamed>    ToCompactTextures; //!< repack 10-bit planar YUV into semi-planar textures and store HDR frames in compact formats
         StHandle<StBoolParamNamed>    ToShowExtra;       //!< show experimental menu items
         StHandle<StInt32ParamNamed>   SnapshotImgType;   //!< default snapshot image type
         StString                      lastFolder;        //!< laster folder used to open / save file
@@ -308,6 +309,7 @@ class StMoviePlayer : public StApplication {
     ST_LOCAL void doImageAdjustReset(const size_t dummy = 0);
     ST_LOCAL void doHideSystemBars(const bool theToHide);
     ST_LOCAL void doSetBenchmark(const bool theValue);
+    ST_LOCAL void doChangeCompactTextures(const bool theToCompact);
 
         public:
 
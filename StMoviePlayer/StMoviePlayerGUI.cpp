@@ -1909,6 +1909,12 @@ void StMoviePlayerGUI::setVisibility(const StPointD_t& theCursor) {
     StQuaternion<double> aQ = myWindow->getDeviceOrientation();
     myImage->setDeviceOrientation(StGLQuaternion((float )aQ.x(), (float )aQ.y(), (float )aQ.z(), (float )aQ.w()));
 
+    // head-locked GUI and subtitles should not be rotated together with panorama by output reprojection
+    const bool hasOverlay = anOpacity > 0.0f
+                         || getFocus() != NULL // message box or dialog
+                         || (mySubtitles != NULL && !mySubtitles->getText().isEmpty());
+    myWindow->setReprojectionFov(!hasOverlay ? myImage->getPanoramaTanHalfFov() : 0.0f);
+
     if(myDescr != NULL) {
         bool wasEmpty = myDescr->getText().isEmpty();
         if(::isPointIn(myBtnOpen, theCursor)) {
@@ -2112,6 +2118,7 @@ void StMoviePlayerGUI::stglDraw(unsigned int theView) {
         myImage->getTextureQueue()->getQueueInfo(myFpsWidget->changePlayQueued(),
                                                  myFpsWidget->changePlayQueueLength(),
                                                  myFpsWidget->changePlayFps());
+        myFpsWidget->setStatistics(&myImage->getTextureQueue()->changeStatistics());
         myFpsWidget->update(myPlugin->getMainWindow()->isStereoOutput(),
                             myPlugin->getMainWindow()->getTargetFps(),
                             myPlugin->getMainWindow()->getStatistics());
@@ -2263,6 +2270,8 @@ void StMoviePlayerGUI::doMobileSettings(const size_t ) {
     aRend->getOptions(aParams);
     aParams.add(myPlugin->params.ToShowFps);
     aParams.add(myPlugin->params.UseGpu);
+    aParams.add(myImage->params.ToUploadVisible);
+    aParams.add(myPlugin->params.ToCompactTextures);
     if(myPlugin->hasAlHrtf()) {
         aParams.add(myPlugin->params.AudioAlHrtf);
     }
@@ -307,6 +307,8 @@ void loadDefaults(StLangMap& theStrings) {
                "Hide system navigation bar");
     theStrings(OPTION_OPEN_LAST_ON_STARTUP,
                "Open last played file on startup");
+    theStrings(OPTION_COMPACT_TEXTURES,
+               "Compact textures for high bit depth video");
 
     theStrings(FILE_VIDEO_OPEN,
                "Open another movie");
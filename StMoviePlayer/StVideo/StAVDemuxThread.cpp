@@ -0,0 +1,114 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StMoviePlayer program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StMoviePlayer program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StAVDemuxThread.h"
+
+SV_THREAD_FUNCTION StAVDemuxThread::threadFunction(void* theDemux) {
+    StAVDemuxThread* aDemux = (StAVDemuxThread* )theDemux;
+    aDemux->mainLoop();
+    return SV_THREAD_RETURN 0;
+}
+
+StAVDemuxThread::StAVDemuxThread(AVFormatContext*                                theFormatCtx,
+                                 const StArrayList< StHandle<StAVPacketQueue> >& theQueues,
+                                 const StHandle<StStereoParams>&                 theParams)
+: myFormatCtx(theFormatCtx),
+  myQueues(theQueues),
+  myPacket(theParams),
+  myEventResume(false),
+  myEventPaused(false),
+  myHasPacket(false),
+  myIsEof(false),
+  myToPause(false),
+  myToQuit(false) {
+    myThread = new StThread(threadFunction, (void* )this, "StAVDemuxThread");
+}
+
+StAVDemuxThread::~StAVDemuxThread() {
+    myToQuit = true;
+    myEventResume.set();
+    myThread->wait();
+    myThread.nullify();
+    myPacket.free();
+}
+
+void StAVDemuxThread::pause() {
+    myEventResume.reset();
+    myToPause = true;
+    myEventPaused.wait();
+}
+
+void StAVDemuxThread::resume(const bool theToReset) {
+    if(theToReset) {
+        myPacket.free();
+        myHasPacket = false;
+        myIsEof     = false;
+    }
+    myToPause = false;
+    myEventResume.set();
+}
+
+bool StAVDemuxThread::pushPacket() {
+    for(size_t aQueueIter = 0; aQueueIter < myQueues.size(); ++aQueueIter) {
+        StHandle<StAVPacketQueue>& aQueue = myQueues[aQueueIter];
+        if(!aQueue->isInContext(myFormatCtx, myPacket.getStreamId())) {
+            continue;
+        } else if(aQueue->isFull()) {
+            return false;
+        }
+
+        myPacket.setDurationSeconds(aQueue->unitsToSeconds(myPacket.getDuration()));
+        aQueue->pushMove(myPacket);
+        return true;
+    }
+
+    // packet of inactive stream
+    myPacket.free();
+    return true;
+}
+
+void StAVDemuxThread::mainLoop() {
+    for(;;) {
+        if(myToQuit) {
+            return;
+        } else if(myToPause) {
+            myEventPaused.set();
+            myEventResume.wait();
+            // reset only after wake up, so that repeated pause() will not wait for already paused thread
+            myEventPaused.reset();
+            continue;
+        } else if(myIsEof) {
+            StThread::sleep(10);
+            continue;
+        }
+
+        if(!myHasPacket) {
+            if(av_read_frame(myFormatCtx, myPacket.getAVpkt()) < 0) {
+                myIsEof = true;
+                continue;
+            }
+            myHasPacket = true;
+        }
+
+        if(pushPacket()) {
+            myHasPacket = false;
+        } else {
+            StThread::sleep(2);
+        }
+    }
+}
@@ -0,0 +1,115 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StMoviePlayer program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StMoviePlayer program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __StAVDemuxThread_h_
+#define __StAVDemuxThread_h_
+
+#include "StAVPacketQueue.h"
+
+#include <StThreads/StCondition.h>
+#include <StThreads/StThread.h>
+
+template<> inline void StArray< StHandle<StAVPacketQueue> >::sort() {}
+
+/**
+ * Demuxing thread reading packets from single format context
+ * and feeding them into packet queues of streams within this context.
+ * Each opened file has its own thread, so that slow or high-bitrate input
+ * does not delay packets for another one.
+ *
+ * The format context and queues should be modified (seeking, stream switching, flushing)
+ * only while the thread is paused.
+ */
+class StAVDemuxThread {
+
+        public:
+
+    /**
+     * Main constructor, starts the thread.
+     * @param theFormatCtx format context to read
+     * @param theQueues    packet queues to feed, packets of other streams are skipped
+     * @param theParams    stereo parameters to be attached to packets
+     */
+    ST_LOCAL StAVDemuxThread(AVFormatContext*                                theFormatCtx,
+                             const StArrayList< StHandle<StAVPacketQueue> >& theQueues,
+                             const StHandle<StStereoParams>&                 theParams);
+
+    /**
+     * Destructor, stops the thread.
+     */
+    ST_LOCAL ~StAVDemuxThread();
+
+    /**
+     * @return format context
+     */
+    ST_LOCAL AVFormatContext* getContext() const {
+        return myFormatCtx;
+    }
+
+    /**
+     * @return true if all packets have been read
+     */
+    ST_LOCAL bool isEof() const {
+        return myIsEof;
+    }
+
+    /**
+     * Request the thread to pause and wait until it stops accessing format context and queues.
+     */
+    ST_LOCAL void pause();
+
+    /**
+     * Resume the thread paused by pause().
+     * @param theToReset drop pending packet and EOF state (after seeking or flushing)
+     */
+    ST_LOCAL void resume(const bool theToReset);
+
+        private:
+
+    /**
+     * Thread function.
+     */
+    static SV_THREAD_FUNCTION threadFunction(void* theDemux);
+
+    /**
+     * Demuxing loop.
+     */
+    ST_LOCAL void mainLoop();
+
+    /**
+     * Push the packet into appropriate queue.
+     * @return false if queue is full and packet should be pushed later
+     */
+    ST_LOCAL bool pushPacket();
+
+        private:
+
+    StHandle<StThread>                       myThread;      //!< demuxing thread
+    AVFormatContext*                         myFormatCtx;   //!< format context
+    StArrayList< StHandle<StAVPacketQueue> > myQueues;      //!< packet queues
+    StAVPacket                               myPacket;      //!< pending packet
+    StCondition                              myEventResume; //!< event to resume paused thread
+    StCondition                              myEventPaused; //!< event signaling that the thread has been paused
+    bool                                     myHasPacket;   //!< flag indicating that pending packet has been read
+    volatile bool                            myIsEof;       //!< all packets have been read
+    volatile bool                            myToPause;     //!< pause request
+    volatile bool                            myToQuit;      //!< quit request
+
+};
+
+#endif // __StAVDemuxThread_h_
@@ -31,11 +31,10 @@ namespace {
 struct StAVPacketQueue::QueueItem {
 
     StHandle<StAVPacket> myItem; //!< handle for packet
-    QueueItem* myNext; //!< link to the next queue item
+    QueueItem* myNext; //!< link to the next queue item (or to the next unused item within pool)
 
-    ST_LOCAL QueueItem(const StAVPacket& thePacket)
-    : myItem(new StAVPacket(thePacket)), // copy with content
-      myNext(NULL) {}
+    ST_LOCAL QueueItem()
+    : myNext(NULL) {}
 
 };
 
@@ -61,6 +60,7 @@ StAVPacketQueue::StAVPacketQueue(const size_t theSizeLimit)
   // queue
   myFront(NULL),
   myBack(NULL),
+  myFreeItems(NULL),
   mySize(0),
   mySizeLimit(theSizeLimit),
   mySizeSeconds(0.0),
@@ -69,18 +69,37 @@ StAVPacketQueue::StAVPacketQueue(const size_t theSizeLimit)
 }
 
 StAVPacketQueue::~StAVPacketQueue() {
-    while(!isEmpty()) {
-        pop();
-    }
+    clear();
     deinit();
+    for(QueueItem* anItem = myFreeItems; anItem != NULL;) {
+        QueueItem* aNext = anItem->myNext;
+        delete anItem;
+        anItem = aNext;
+    }
+    myFreeItems = NULL;
 }
 
 void StAVPacketQueue::clear() {
     myMutex.lock();
-    while(!isEmpty()) {
-        pop();
+        QueueItem* aFront = myFront;
+        QueueItem* aBack  = myBack;
+        myFront = NULL;
+        myBack  = NULL;
+        mySize  = 0;
+        mySizeSeconds = 0.0;
+    myMutex.unlock();
+    if(aFront == NULL) {
+        return;
+    }
+
+    // release packets outside the lock
+    for(QueueItem* anItem = aFront; anItem != NULL; anItem = anItem->myNext) {
+        anItem->myItem.nullify();
     }
-    mySizeSeconds = 0.0;
+
+    myMutex.lock();
+        aBack->myNext = myFreeItems;
+        myFreeItems   = aFront;
     myMutex.unlock();
 }
 
@@ -163,35 +182,64 @@ StString StAVPacketQueue::getCodecInfo() const {
 }
 
 StHandle<StAVPacket> StAVPacketQueue::pop() {
+    StHandle<StAVPacket> aPacket;
     myMutex.lock();
-        if(isEmpty()) {
+        QueueItem* anItem = myFront;
+        if(anItem == NULL) {
             myMutex.unlock();
-            return StHandle<StAVPacket>();
+            return aPacket;
         }
-        QueueItem* anItem = myFront;
-        myFront = myFront->myNext;
-        StHandle<StAVPacket> aPacket = anItem->myItem;
-        delete anItem;
+        myFront = anItem->myNext;
+        if(myFront == NULL) {
+            myBack = NULL;
+        }
+        aPacket = anItem->myItem;
+        anItem->myItem.nullify();
         --mySize;
         mySizeSeconds -= aPacket->getDurationSeconds();
+
+        // return the item to the pool
+        anItem->myNext = myFreeItems;
+        myFreeItems    = anItem;
     myMutex.unlock();
     return aPacket;
 }
 
-void StAVPacketQueue::push(const StAVPacket& thePacket) {
+void StAVPacketQueue::pushItem(const StHandle<StAVPacket>& thePacket) {
     myMutex.lock();
-        QueueItem* anItem = new QueueItem(thePacket);
-        if(isEmpty()) {
+        QueueItem* anItem = myFreeItems;
+        if(anItem != NULL) {
+            myFreeItems = anItem->myNext;
+        } else {
+            // the pool is empty - allocate new item outside the lock
+            myMutex.unlock();
+            anItem = new QueueItem();
+            myMutex.lock();
+        }
+        anItem->myItem = thePacket;
+        anItem->myNext = NULL;
+        if(myFront == NULL) {
             myFront = myBack = anItem;
         } else {
             myBack->myNext = anItem;
             myBack = anItem;
         }
         ++mySize;
-        mySizeSeconds += thePacket.getDurationSeconds();
+        mySizeSeconds += thePacket->getDurationSeconds();
     myMutex.unlock();
 }
 
+void StAVPacketQueue::push(const StAVPacket& thePacket) {
+    StHandle<StAVPacket> aPacket = new StAVPacket(thePacket);
+    pushItem(aPacket);
+}
+
+void StAVPacketQueue::pushMove(StAVPacket& thePacket) {
+    StHandle<StAVPacket> aPacket = new StAVPacket();
+    aPacket->moveFrom(thePacket);
+    pushItem(aPacket);
+}
+
 void StAVPacketQueue::pushStart() {
     StAVPacketQueue::push(ST_START_PACKET);
 }
@@ -69,11 +69,16 @@ class StAVPacketQueue {
     ST_LOCAL StHandle<StAVPacket> pop();
 
     /**
-     * @param thePacket (StAVPacket& ) - packet to add (will be copied with content).
-     * @return true on success.
+     * @param thePacket (StAVPacket& ) - packet to add (reference-counted payload is shared, otherwise copied).
      */
     ST_LOCAL void push(const StAVPacket& thePacket);
 
+    /**
+     * Move the packet into the queue without copying its payload.
+     * @param thePacket packet to add, becomes empty
+     */
+    ST_LOCAL void pushMove(StAVPacket& thePacket);
+
     ST_LOCAL void pushStart();
     ST_LOCAL void pushEnd();
     ST_LOCAL void pushQuit();
@@ -259,12 +264,20 @@ class StAVPacketQueue {
     bool             myIsPlaying;      //!< playback state
     bool             myIsAttachedPic;  //!< flag indicating the stream is attached image
 
-        private: //! @name Private fields
+        private:
 
     struct QueueItem;
 
+    /**
+     * Append the packet to the queue.
+     */
+    ST_LOCAL void pushItem(const StHandle<StAVPacket>& thePacket);
+
+        private: //! @name Private fields
+
     QueueItem*       myFront;          //!< queue front packet (first to pop)
     QueueItem*       myBack;           //!< queue back  packet (last  to pop)
+    QueueItem*       myFreeItems;      //!< pool of unused queue items
     size_t           mySize;           //!< packets number in queue
     size_t           mySizeLimit;      //!< packets limit
     double           mySizeSeconds;    //!< cumulative packets length in seconds
@@ -0,0 +1,158 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StMoviePlayer program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StMoviePlayer program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StAmbisonicDecoder.h"
+
+namespace {
+
+    /**
+     * Virtual microphones are turned by 60 degrees from the front,
+     * so that sounds behind the listener are attenuated.
+     */
+    static const float THE_MIC_COS = 0.5f;
+    static const float THE_MIC_SIN = 0.8660254f;
+
+    /**
+     * Ambisonics axes (X - front, Y - left, Z - up) in OpenGL coordinates.
+     */
+    static const StGLVec3 THE_AMBI_AXES[3] = {
+        StGLVec3( 0.0f, 0.0f, -1.0f),
+        StGLVec3(-1.0f, 0.0f,  0.0f),
+        StGLVec3( 0.0f, 1.0f,  0.0f)
+    };
+
+    inline void convertSample(const float theValue, float&   theSample) {
+        theSample = theValue;
+    }
+
+    inline void convertSample(const float theValue, int16_t& theSample) {
+        const float aClamped = theValue > 1.0f ? 1.0f : (theValue < -1.0f ? -1.0f : theValue);
+        theSample = int16_t(aClamped * 32767.0f);
+    }
+
+    /**
+     * Decode block with left/right microphone coefficients interpolated from begin to end of the block.
+     * Written as plain loop over planar data to be auto-vectorized by compiler.
+     */
+    template<typename sample_t>
+    inline void decodeBlock(const float* theW,
+                            const float* theX,
+                            const float* theY,
+                            const float* theZ,
+                            const float  theLeftBeg[3],
+                            const float  theLeftEnd[3],
+                            const float  theRightBeg[3],
+                            const float  theRightEnd[3],
+                            sample_t*    theOut,
+                            const size_t theNbSamples) {
+        float aLeftDelta[3], aRightDelta[3];
+        for(int anAxis = 0; anAxis < 3; ++anAxis) {
+            aLeftDelta [anAxis] = theLeftEnd [anAxis] - theLeftBeg [anAxis];
+            aRightDelta[anAxis] = theRightEnd[anAxis] - theRightBeg[anAxis];
+        }
+
+        const float aStep = 1.0f / float(theNbSamples);
+        for(size_t aSampleIter = 0; aSampleIter < theNbSamples; ++aSampleIter) {
+            const float aT = float(aSampleIter) * aStep;
+            const float aW = 0.5f * theW[aSampleIter];
+            const float aLeft  = aW
+                               + (theLeftBeg[0]  + aLeftDelta[0]  * aT) * theX[aSampleIter]
+                               + (theLeftBeg[1]  + aLeftDelta[1]  * aT) * theY[aSampleIter]
+                               + (theLeftBeg[2]  + aLeftDelta[2]  * aT) * theZ[aSampleIter];
+            const float aRight = aW
+                               + (theRightBeg[0] + aRightDelta[0] * aT) * theX[aSampleIter]
+                               + (theRightBeg[1] + aRightDelta[1] * aT) * theY[aSampleIter]
+                               + (theRightBeg[2] + aRightDelta[2] * aT) * theZ[aSampleIter];
+            convertSample(aLeft,  theOut[aSampleIter * 2 + 0]);
+            convertSample(aRight, theOut[aSampleIter * 2 + 1]);
+        }
+    }
+
+}
+
+StAmbisonicDecoder::StAmbisonicDecoder() {
+    reset();
+}
+
+void StAmbisonicDecoder::reset() {
+    for(int anAxis = 0; anAxis < 3; ++anAxis) {
+        myRotNext[0][anAxis] = anAxis == 0 ? 1.0f : 0.0f;
+        myRotNext[1][anAxis] = anAxis == 1 ? 1.0f : 0.0f;
+    }
+    stMemCpy(myRotPrev, myRotNext, sizeof(myRotNext));
+}
+
+void StAmbisonicDecoder::setOrientation(const StGLQuaternion& theHeadOrient) {
+    StGLQuaternion anOrient = theHeadOrient;
+    anOrient.normalize();
+
+    // rotate the sound field from world into head space,
+    // only rotated X (front) and Y (left) components are needed for stereo decoding
+    for(int anAxis = 0; anAxis < 3; ++anAxis) {
+        const StGLVec3 aRotated = anOrient.multiply(THE_AMBI_AXES[anAxis]);
+        myRotNext[0][anAxis] = -aRotated.z();
+        myRotNext[1][anAxis] = -aRotated.x();
+    }
+}
+
+bool StAmbisonicDecoder::decode(const StPCMBuffer& theBFormat,
+                                StPCMBuffer&       theStereo) {
+    if(theBFormat.getFormat()   != StPcmFormat_Float32
+    || theBFormat.getPlanesNb() != 4) {
+        return false;
+    }
+
+    const size_t aNbSamples = theBFormat.getPlaneSize() / sizeof(float);
+    theStereo.setDataSize(0);
+    if(aNbSamples == 0) {
+        return true;
+    }
+
+    float aLeftBeg[3], aLeftEnd[3], aRightBeg[3], aRightEnd[3];
+    for(int anAxis = 0; anAxis < 3; ++anAxis) {
+        aLeftBeg [anAxis] = 0.5f * (THE_MIC_COS * myRotPrev[0][anAxis] + THE_MIC_SIN * myRotPrev[1][anAxis]);
+        aRightBeg[anAxis] = 0.5f * (THE_MIC_COS * myRotPrev[0][anAxis] - THE_MIC_SIN * myRotPrev[1][anAxis]);
+        aLeftEnd [anAxis] = 0.5f * (THE_MIC_COS * myRotNext[0][anAxis] + THE_MIC_SIN * myRotNext[1][anAxis]);
+        aRightEnd[anAxis] = 0.5f * (THE_MIC_COS * myRotNext[0][anAxis] - THE_MIC_SIN * myRotNext[1][anAxis]);
+    }
+    stMemCpy(myRotPrev, myRotNext, sizeof(myRotNext));
+
+    const float* aW = (const float* )theBFormat.getPlane(0);
+    const float* aX = (const float* )theBFormat.getPlane(1);
+    const float* aY = (const float* )theBFormat.getPlane(2);
+    const float* aZ = (const float* )theBFormat.getPlane(3);
+    switch(theStereo.getFormat()) {
+        case StPcmFormat_Float32: {
+            const size_t aDataSize = aNbSamples * 2 * sizeof(float);
+            theStereo.resize(aDataSize, false);
+            decodeBlock(aW, aX, aY, aZ, aLeftBeg, aLeftEnd, aRightBeg, aRightEnd,
+                        (float* )theStereo.getPlane(0), aNbSamples);
+            return theStereo.setDataSize(aDataSize);
+        }
+        case StPcmFormat_Int16: {
+            const size_t aDataSize = aNbSamples * 2 * sizeof(int16_t);
+            theStereo.resize(aDataSize, false);
+            decodeBlock(aW, aX, aY, aZ, aLeftBeg, aLeftEnd, aRightBeg, aRightEnd,
+                        (int16_t* )theStereo.getPlane(0), aNbSamples);
+            return theStereo.setDataSize(aDataSize);
+        }
+        default: {
+            return false;
+        }
+    }
+}
@@ -0,0 +1,70 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StMoviePlayer program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StMoviePlayer program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __StAmbisonicDecoder_h_
+#define __StAmbisonicDecoder_h_
+
+#include <StGL/StGLVec.h>
+
+#include "StPCMBuffer.h"
+
+/**
+ * Software decoder of first-order Ambisonics (B-Format) into stereo pair,
+ * used when OpenAL implementation does not support AL_EXT_BFORMAT.
+ *
+ * The sound field is rotated by head orientation before decoding,
+ * and rotation is interpolated across the block from orientation of previous block
+ * to avoid clicks on fast head movements.
+ * Stereo is formed by two virtual cardioid microphones turned to the left and to the right.
+ */
+class StAmbisonicDecoder {
+
+        public:
+
+    /**
+     * Empty constructor.
+     */
+    ST_LOCAL StAmbisonicDecoder();
+
+    /**
+     * Reset orientation to identity (without interpolation).
+     */
+    ST_LOCAL void reset();
+
+    /**
+     * Set head orientation to be reached at the end of next decoded block.
+     */
+    ST_LOCAL void setOrientation(const StGLQuaternion& theHeadOrient);
+
+    /**
+     * Decode the block.
+     * @param theBFormat input buffer in Float32 format with 4 planes in W, X, Y, Z order (SN3D normalization)
+     * @param theStereo  output interleaved stereo buffer in Float32 or Int16 format
+     * @return false if input configuration is unsupported
+     */
+    ST_LOCAL bool decode(const StPCMBuffer& theBFormat,
+                         StPCMBuffer&       theStereo);
+
+        private:
+
+    float myRotPrev[2][3]; //!< rotated X and Y rows applied at the beginning of the block
+    float myRotNext[2][3]; //!< rotated X and Y rows to be reached at the end of the block
+
+};
+
+#endif // __StAmbisonicDecoder_h_
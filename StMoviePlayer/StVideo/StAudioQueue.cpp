@@ -58,6 +58,13 @@ namespace {
     static const StGLVec3 THE_LISTENER_FORWARD      ( 0.0f, 0.0f, -1.0f);
     static const StGLVec3 THE_LISTENER_UP           ( 0.0f, 1.0f,  0.0f);
 
+    /**
+     * Duration of the block for software B-Format decoding.
+     * Head orientation is applied per block, so that block should be short enough.
+     * Together with THE_NUM_AL_BUFFERS_AMBI this defines the lag of sound field behind head motion.
+     */
+    static const double THE_AMBI_BLOCK_SEC = 0.02;
+
 }
 
 #if(LIBAVCODEC_VERSION_INT < AV_VERSION_INT(53, 0, 0))
@@ -245,7 +252,8 @@ void StAudioQueue::stalResetHrtf() {
 }
 
 void StAudioQueue::stalOrientListener() {
-    if(myToOrientListener) {
+    if(myToOrientListener
+    && !myAlIsAmbiSoft) {
         StGLQuaternion aHeadOrient;
         {
             StMutexAuto aLock(mySwitchMutex);
@@ -269,6 +277,16 @@ void StAudioQueue::stalOrientListener() {
     }
 }
 
+void StAudioQueue::stalDecodeAmbisonics() {
+    StGLQuaternion aHeadOrient;
+    if(myToOrientListener) {
+        StMutexAuto aLock(mySwitchMutex);
+        aHeadOrient = myHeadOrient;
+    }
+    myAmbiDecoder.setOrientation(aHeadOrient);
+    myAmbiDecoder.decode(myBufferOut, myBufferAmbi);
+}
+
 void StAudioQueue::stalEmpty() {
     alSourceStopv(THE_NUM_AL_SOURCES, myAlSources);
 
@@ -320,6 +338,8 @@ StAudioQueue::StAudioQueue(const std::string& theAlDeviceName,
   myAvNbChannels(-1),
   myBufferSrc(StPcmFormat_Int16),
   myBufferOut(StPcmFormat_Int16),
+  myBufferAmbi(StPcmFormat_Int16),
+  myAmbiBlockSize(0),
   myIsAlValid(ST_AL_INIT_NA),
   myToSwitchDev(false),
   myIsDisconnected(false),
@@ -335,6 +355,7 @@ StAudioQueue::StAudioQueue(const std::string& theAlDeviceName,
   myAlIsListOrient(false),
   myAlCanBFormat(false),
   myAlIsBFormat(false),
+  myAlIsAmbiSoft(false),
   myAlHrtf(theAlHrtf),
   myAlHrtfPrev(theAlHrtf),
   myDbgPrevQueued(-1),
@@ -527,6 +548,27 @@ bool StAudioQueue::initOut40BFormat(const bool theIsPlanar) {
     return true;
 }
 
+bool StAudioQueue::initOut40BFormatSoft(const bool theIsPlanar) {
+    if(myAlCtx.hasExtFloat32) {
+        myAlFormat = alGetEnumValue("AL_FORMAT_STEREO_FLOAT32");
+        myBufferAmbi.setFormat(StPcmFormat_Float32);
+    } else {
+        myAlFormat = AL_FORMAT_STEREO16;
+        myBufferAmbi.setFormat(StPcmFormat_Int16);
+    }
+    myBufferAmbi.setupChannels(StChannelMap::CH20, StChannelMap::PCM, 1);
+
+    // keep B-Format in separate float planes till decoding
+    myBufferOut.setFormat(StPcmFormat_Float32);
+    myBufferSrc.setupChannels(StChannelMap::CH40, StChannelMap::WYZX, theIsPlanar ? myCodecCtx->channels : 1);
+    myBufferOut.setupChannels(StChannelMap::CH40, StChannelMap::PCM, 4);
+    myAmbiBlockSize = size_t(double(myCodecCtx->sample_rate) * THE_AMBI_BLOCK_SEC) * sizeof(float);
+    myAmbiDecoder.reset();
+    myAlDataLoop.setNbBuffers(THE_NUM_AL_BUFFERS_AMBI);
+    stalConfigureSources1();
+    return true;
+}
+
 bool StAudioQueue::initOut50Soft(const bool theIsPlanar) {
     if(!setupOutMonoFormat()) {
         return false;
@@ -659,6 +701,8 @@ bool StAudioQueue::initOutChannels() {
 
     myAlCanBFormat = false;
     myAlIsBFormat  = false;
+    myAlIsAmbiSoft = false;
+    myAlDataLoop.setNbBuffers(THE_NUM_AL_BUFFERS);
     switch(myCodecCtx->channels) {
         case 1: {
             myAlSoftLayout = true; // just unsupported
@@ -678,11 +722,16 @@ bool StAudioQueue::initOutChannels() {
             return initOut30Soft(isPlanar);
         }
         case 4: {
-            myAlCanBFormat = myAlCtx.hasExtBFormat;
-            if(myToForceBFormat && myAlCtx.hasExtBFormat) {
+            myAlCanBFormat = true;
+            if(myToForceBFormat) {
                 myAlSoftLayout = true;
                 myAlIsBFormat  = true;
-                return initOut40BFormat(isPlanar);
+                if(myAlCtx.hasExtBFormat) {
+                    return initOut40BFormat(isPlanar);
+                }
+                ST_DEBUG_LOG("OpenAL: B-Format extension (AL_FORMAT_BFORMAT3D_16) is unavailable, decoding in software");
+                myAlIsAmbiSoft = true;
+                return initOut40BFormatSoft(isPlanar);
             }
             if(myAlCtx.hasExtMultiChannel && !myToOrientListener) {
                 myAlSoftLayout = false;
@@ -810,6 +859,7 @@ bool StAudioQueue::initBuffers() {
     // setup frequency
     myBufferSrc.setFreq(myCodecCtx->sample_rate);
     myBufferOut.setFreq(myCodecCtx->sample_rate);
+    myBufferAmbi.setFreq(myCodecCtx->sample_rate);
 
     // setup channel order
     if(!initOutChannels()) {
@@ -823,12 +873,14 @@ bool StAudioQueue::initBuffers() {
 void StAudioQueue::deinit() {
     myBufferSrc.clear();
     myBufferOut.clear();
+    myBufferAmbi.clear();
     myAvSrcFormat  = -1;
     myAvSampleRate = -1;
     myAvNbChannels = -1;
     myAlSoftLayout = true;
     myAlCanBFormat = false;
     myAlIsBFormat  = false;
+    myAlIsAmbiSoft = false;
     StAVPacketQueue::deinit();
 }
 
@@ -912,6 +964,7 @@ bool StAudioQueue::parseEvents() {
 bool StAudioQueue::stalQueue(const double thePts) {
     ALint aQueued = 0;
     ALint aProcessed = 0;
+    const ALint aNbBuffers = getNbAlBuffers();
     ALenum aState = stalGetSourceState();
     alGetSourcei(myAlSources[0], AL_BUFFERS_PROCESSED, &aProcessed);
     alGetSourcei(myAlSources[0], AL_BUFFERS_QUEUED,    &aQueued);
@@ -919,7 +972,7 @@ bool StAudioQueue::stalQueue(const double thePts) {
 #ifdef ST_DEBUG
     if(myDbgPrevQueued != aQueued) {
         ST_DEBUG_LOG("OpenAL buffers: " + aQueued + " queued + "
-            + aProcessed + " processed from " + THE_NUM_AL_BUFFERS
+            + aProcessed + " processed from " + aNbBuffers
         );
     }
     myDbgPrevQueued = aQueued;
@@ -936,7 +989,7 @@ bool StAudioQueue::stalQueue(const double thePts) {
     if(myPrevFormat    != myAlFormat
     || myPrevFrequency != myBufferOut.getFreq()
     || (aState  == AL_STOPPED
-     && aQueued == THE_NUM_AL_BUFFERS)) {
+     && aQueued >= aNbBuffers)) {
         ST_DEBUG_LOG("AL, reinitialize buffers per source , plane size= " + myBufferOut.getPlaneSize()
                             + "; freq= " + myBufferOut.getFreq());
         stalEmpty();
@@ -947,7 +1000,7 @@ bool StAudioQueue::stalQueue(const double thePts) {
 
     bool toTryToPlay = false;
     bool isQueued = false;
-    if(aProcessed == 0 && aQueued < THE_NUM_AL_BUFFERS) {
+    if(aProcessed == 0 && aQueued < aNbBuffers) {
         if(myBufferOut.isEmpty()) {
             ST_DEBUG_LOG(" EMPTY BUFFER ");
             return true;
@@ -957,15 +1010,19 @@ bool StAudioQueue::stalQueue(const double thePts) {
         ///ST_DEBUG_LOG("AL, queue more buffers " + aQueued + " / " + NUM_AL_BUFFERS);
         myPrevFormat    = myAlFormat;
         myPrevFrequency = myBufferOut.getFreq();
-        for(size_t aSrcId = 0; aSrcId < myBufferOut.getPlanesNb(); ++aSrcId) {
+        if(myAlIsAmbiSoft) {
+            stalDecodeAmbisonics();
+        }
+        const StPCMBuffer& anAlBuffer = myAlIsAmbiSoft ? myBufferAmbi : myBufferOut;
+        for(size_t aSrcId = 0; aSrcId < anAlBuffer.getPlanesNb(); ++aSrcId) {
             alBufferData(myAlBuffers[aSrcId][aQueued], myAlFormat,
-                         myBufferOut.getPlane(aSrcId), (ALsizei )myBufferOut.getPlaneSize(),
-                         myBufferOut.getFreq());
+                         anAlBuffer.getPlane(aSrcId), (ALsizei )anAlBuffer.getPlaneSize(),
+                         anAlBuffer.getFreq());
             stalCheckErrors("alBufferData1");
             alSourceQueueBuffers(myAlSources[aSrcId], 1, &myAlBuffers[aSrcId][aQueued]);
             stalCheckErrors("alSourceQueueBuffers");
         }
-        toTryToPlay = ((aQueued + 1) == THE_NUM_AL_BUFFERS);
+        toTryToPlay = ((aQueued + 1) == aNbBuffers);
         isQueued = true;
     } else if(aProcessed != 0
            && (aState == AL_PLAYING
@@ -979,7 +1036,11 @@ bool StAudioQueue::stalQueue(const double thePts) {
 
         myPrevFormat    = myAlFormat;
         myPrevFrequency = myBufferOut.getFreq();
-        for(size_t aSrcId = 0; aSrcId < myBufferOut.getPlanesNb(); ++aSrcId) {
+        if(myAlIsAmbiSoft) {
+            stalDecodeAmbisonics();
+        }
+        const StPCMBuffer& anAlBuffer = myAlIsAmbiSoft ? myBufferAmbi : myBufferOut;
+        for(size_t aSrcId = 0; aSrcId < anAlBuffer.getPlanesNb(); ++aSrcId) {
 
             // wait other sources for processed buffers
             if(aSrcId != 0) {
@@ -1001,8 +1062,8 @@ bool StAudioQueue::stalQueue(const double thePts) {
             stalCheckErrors("alSourceUnqueueBuffers");
             if(alBuffIdToFill != 0) {
                 alBufferData(alBuffIdToFill, myAlFormat,
-                             myBufferOut.getPlane(aSrcId), (ALsizei )myBufferOut.getPlaneSize(),
-                             myBufferOut.getFreq());
+                             anAlBuffer.getPlane(aSrcId), (ALsizei )anAlBuffer.getPlaneSize(),
+                             anAlBuffer.getFreq());
                 stalCheckErrors("alBufferData2");
                 alSourceQueueBuffers(myAlSources[aSrcId], 1, &alBuffIdToFill);
                 stalCheckErrors("alSourceQueueBuffers");
@@ -1183,7 +1244,8 @@ void StAudioQueue::decodePacket(const StHandle<StAVPacket>& thePacket,
         #endif
 
             checkMoreFrames = true;
-            if(myBufferOut.addData(myBufferSrc)) {
+            if(!isOutBlockFull()
+            && myBufferOut.addData(myBufferSrc)) {
                 // 'big buffer' still not full
                 break;
             }
@@ -28,6 +28,7 @@
 
 #include "StAVPacketQueue.h"// StAVPacketQueue class
 #include "StPCMBuffer.h"    // audio PCM buffer class
+#include "StAmbisonicDecoder.h"
 #include "StALContext.h"
 
 // forward declarations
@@ -191,6 +192,12 @@ class StAudioQueue : public StAVPacketQueue {
     ST_LOCAL void stalResetHrtf();
     ST_LOCAL void stalOrientListener();
 
+    /**
+     * Decode B-Format block from myBufferOut into stereo myBufferAmbi
+     * using current head orientation.
+     */
+    ST_LOCAL void stalDecodeAmbisonics();
+
     ST_LOCAL void stalConfigureSources1();
     ST_LOCAL void stalConfigureSources2_0();
     ST_LOCAL void stalConfigureSources3_0();
@@ -246,6 +253,18 @@ class StAudioQueue : public StAVPacketQueue {
     //! Initialize 4.0 Ambisonics WXYZ stream using extension (AL_FORMAT_BFORMAT3D).
     ST_LOCAL bool initOut40BFormat(const bool theIsPlanar);
 
+    //! Initialize 4.0 Ambisonics WXYZ stream decoded into stereo in software.
+    ST_LOCAL bool initOut40BFormatSoft(const bool theIsPlanar);
+
+    /**
+     * Return TRUE if output block should be flushed before appending more data.
+     * Software Ambisonics decoding uses short blocks, because head orientation is applied per block.
+     */
+    ST_LOCAL bool isOutBlockFull() const {
+        return myAlIsAmbiSoft
+            && myBufferOut.getPlaneSize() >= myAmbiBlockSize;
+    }
+
     //! Initialize 5.0 stream by configuring 5 sources in 3D.
     ST_LOCAL bool initOut50Soft(const bool theIsPlanar);
 
@@ -289,8 +308,18 @@ class StAudioQueue : public StAVPacketQueue {
     // This constant sets count of OpenAL buffers, used in loop
     // for gapless playback
     #define THE_NUM_AL_BUFFERS 4
+    #define THE_NUM_AL_BUFFERS_AMBI 2
     #define THE_NUM_AL_SOURCES 8
 
+    /**
+     * Return number of OpenAL buffers to be queued.
+     * Software Ambisonics decoding keeps only one block queued ahead of the playing one,
+     * because already queued audio can not be rotated to follow the head.
+     */
+    ST_LOCAL ALint getNbAlBuffers() const {
+        return myAlIsAmbiSoft ? THE_NUM_AL_BUFFERS_AMBI : THE_NUM_AL_BUFFERS;
+    }
+
     /**
      * This is help class, used to store buffer-sizes
      * that was decoded last.
@@ -300,7 +329,8 @@ class StAudioQueue : public StAVPacketQueue {
             public:
 
         ST_LOCAL DataLoop()
-        : myLast(THE_NUM_AL_BUFFERS - 1) {
+        : myLast(THE_NUM_AL_BUFFERS - 1),
+          myNbBuffers(THE_NUM_AL_BUFFERS) {
             stMemSet(myDataSizes, 0, sizeof(myDataSizes));
         }
 
@@ -308,9 +338,21 @@ class StAudioQueue : public StAVPacketQueue {
             stMemSet(myDataSizes, 0, sizeof(myDataSizes));
         }
 
+        /**
+         * Setup the number of buffers in use (should not exceed THE_NUM_AL_BUFFERS).
+         */
+        ST_LOCAL void setNbBuffers(const size_t theNbBuffers) {
+            if(myNbBuffers == theNbBuffers) {
+                return;
+            }
+            myNbBuffers = theNbBuffers;
+            myLast      = theNbBuffers - 1;
+            clear();
+        }
+
         ST_LOCAL void push(const size_t theDataSize) {
             ++myLast;
-            if(myLast >= THE_NUM_AL_BUFFERS) {
+            if(myLast >= myNbBuffers) {
                myLast = 0;
             }
             myDataSizes[myLast] = theDataSize;
@@ -318,7 +360,7 @@ class StAudioQueue : public StAVPacketQueue {
 
         ST_LOCAL size_t summ() const {
             size_t aSumm = 0;
-            for(size_t aBuffIter = 0; aBuffIter < THE_NUM_AL_BUFFERS; ++aBuffIter) {
+            for(size_t aBuffIter = 0; aBuffIter < myNbBuffers; ++aBuffIter) {
                 aSumm += myDataSizes[aBuffIter];
             }
             return aSumm;
@@ -328,6 +370,7 @@ class StAudioQueue : public StAVPacketQueue {
 
         size_t myDataSizes[THE_NUM_AL_BUFFERS];
         size_t myLast;
+        size_t myNbBuffers;
 
     } myAlDataLoop;
 
@@ -346,6 +389,9 @@ class StAudioQueue : public StAVPacketQueue {
     int                myAvNbChannels;  //!< myCodecCtx->channels
     StPCMBuffer        myBufferSrc;     //!< decoded PCM audio buffer
     StPCMBuffer        myBufferOut;     //!< output  PCM audio buffer
+    StPCMBuffer        myBufferAmbi;    //!< stereo buffer decoded from B-Format in myBufferOut
+    StAmbisonicDecoder myAmbiDecoder;   //!< software B-Format decoder
+    size_t             myAmbiBlockSize; //!< plane size limit for software B-Format decoding
     StTimer            myLimitTimer;
     volatile IState_t  myIsAlValid;     //!< OpenAL initialization state
     StMutex            mySwitchMutex;   //!< switch audio device lock
@@ -372,6 +418,7 @@ class StAudioQueue : public StAVPacketQueue {
     bool               myAlIsListOrient;//!< flag indicating that listener orientation is not identity
     bool               myAlCanBFormat;  //!< flag indicating that B-Format can be forced (e.g. 4-channels input and extension is available)
     bool               myAlIsBFormat;   //!< flag indicating that using B-Format is enabled (forcibly) for 4-channels input
+    bool               myAlIsAmbiSoft;  //!< flag indicating that B-Format is decoded in software (extension is unavailable)
 
     StAlHrtfRequest    myAlHrtf;
     StAlHrtfRequest    myAlHrtfPrev;
@@ -176,7 +176,6 @@ void StSubtitleQueue::decodeLoop() {
                             }
 
                             StHandle<StSubItem> aNewSubItem = new StSubItem(aPts, aPts + aDuration);
-                            aNewSubItem->Image.initTrash(StImagePlane::ImgRGBA, aRect->w, aRect->h);
                         #if(LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(57, 9, 100))
                             uint8_t** anImgData = aRect->data;
                             int* anImgLineSizes = aRect->linesize;
@@ -185,26 +184,13 @@ void StSubtitleQueue::decodeLoop() {
                             int* anImgLineSizes = aRect->pict.linesize;
                         #endif
 
-                            SwsContext* aCtxToRgb = sws_getContext(aRect->w, aRect->h, stAV::PIX_FMT::PAL8,
-                                                                   aRect->w, aRect->h, stAV::PIX_FMT::RGBA32,
-                                                                   SWS_BICUBIC, NULL, NULL, NULL);
-                            if(aCtxToRgb == NULL) {
+                            // PAL8 -> RGBA is a plain palette lookup, no need in swscale context
+                            if(!aNewSubItem->Image.initFromPalette(anImgData[0], size_t(anImgLineSizes[0]),
+                                                                   (const uint32_t* )anImgData[1],
+                                                                   size_t(aRect->w), size_t(aRect->h))) {
                                 break;
                             }
 
-                            uint8_t* aDstData[4] = {
-                                (uint8_t* )aNewSubItem->Image.getData(), NULL, NULL, NULL
-                            };
-                            /*const*/ int aDstLinesize[4] = {
-                                (int )aNewSubItem->Image.getSizeRowBytes(), 0, 0, 0
-                            };
-
-                            sws_scale(aCtxToRgb,
-                                      anImgData, anImgLineSizes,
-                                      0, aRect->h,
-                                      aDstData, aDstLinesize);
-                            sws_freeContext(aCtxToRgb);
-
                             /*ST_DEBUG_LOG("  |" + aRectId + "/" + aSubtitle.num_rects + "| " //+ aRect->x + "x" + aRect->y + " WH= "
                                             + aRect->w + "x" + aRect->h + " c= " + aRect->nb_colors
                                             + " pts= " + aPts
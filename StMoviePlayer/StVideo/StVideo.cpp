@@ -28,6 +28,8 @@ namespace {
     static const char ST_AUDIOS_MIME_STRING[] = ST_VIDEO_PLUGIN_AUDIO_MIME_CHAR;
     static const char ST_SUBTIT_MIME_STRING[] = ST_VIDEO_PLUGIN_SUBTIT_MIME_CHAR;
 
+    static const size_t THE_READ_AHEAD_BYTES = 32 * 1024 * 1024; //!< read-ahead buffer size for each opened file
+
     static SV_THREAD_FUNCTION threadFunction(void* theStVideo) {
         StVideo* aStVideo  = (StVideo* )theStVideo;
         aStVideo->mainLoop();
@@ -108,6 +110,7 @@ StVideo::StVideo(const std::string&                 theALDeviceName,
   myMimesAudio(ST_AUDIOS_MIME_STRING),
   myMimesSubs(ST_SUBTIT_MIME_STRING),
   myResMgr(theResMgr),
+  myInfoIndex(new StMediaInfoIndex(theResMgr->getCacheFolder() + "movieinfo.idx")),
   myLangMap(theLangMap),
   mySlaveCtx(NULL),
   mySlaveStream(-1),
@@ -128,6 +131,7 @@ StVideo::StVideo(const std::string&                 theALDeviceName,
     stAV::init();
 
     myPlayList->setExtensions(myMimesVideo.getExtensionsList());
+    myPlayList->setInfoIndex(myInfoIndex);
     myTracksExt = myMimesSubs.getExtensionsList();
     StArrayList<StString> anAudioExt = myMimesAudio.getExtensionsList();
     for(size_t anExtIter = 0; anExtIter < anAudioExt.size(); ++anExtIter) {
@@ -262,9 +266,11 @@ StVideo::~StVideo() {
     myVideoMaster.nullify();
     aHangKiller.setDone();
     close(); // we must quit or flush video/audio threads before close()!
+    myInfoIndex->save();
 }
 
 void StVideo::close() {
+    stopDemuxers();
     if(!myVideoSlave.isNull())  myVideoSlave->deinit();
     if(!myVideoMaster.isNull()) myVideoMaster->deinit();
     if(!myAudio.isNull())       myAudio->deinit();
@@ -279,10 +285,21 @@ void StVideo::close() {
         #endif
         }
     }
+#ifdef ST_DEBUG
+    for(size_t anIoIter = 0; anIoIter < myFileIOList.size(); ++anIoIter) {
+        StHandle<StAVIOFileContext> aFileCtx = StHandle<StAVIOFileContext>::downcast(myFileIOList[anIoIter]);
+        if(!aFileCtx.isNull()) {
+            const StAVIOFileContext::Statistics aStats = aFileCtx->getStatistics();
+            ST_DEBUG_LOG("Read-ahead '" + myFileList[anIoIter] + "': " + aStats.BytesRead / 1024 + " KiB at "
+                       + int(aStats.getThroughput() / (1024.0 * 1024.0)) + " MiB/s, "
+                       + aStats.NbStalls + " stalls (" + aStats.StallSec + " s), "
+                       + aStats.NbDiscarded + " discarding seeks");
+        }
+    }
+#endif
     myFileList.clear();
     myCtxList.clear();
     myFileIOList.clear();
-    myPlayCtxList.clear();
     mySlaveCtx    = NULL;
     mySlaveStream = -1;
 
@@ -319,12 +336,22 @@ bool StVideo::addFile(const StString& theFileToLoad,
         int aFileDescriptor = myResMgr->openFileDescriptor(theFileToLoad);
         if(aFileDescriptor != -1) {
             StHandle<StAVIOFileContext> aFileCtx = new StAVIOFileContext();
+            aFileCtx->setReadAhead(THE_READ_AHEAD_BYTES);
             if(aFileCtx->openFromDescriptor(aFileDescriptor, "rb")) {
                 aFormatCtx = avformat_alloc_context();
                 aFormatCtx->pb = aFileCtx->getAvioContext();
                 anIOContext = aFileCtx;
             }
         }
+    } else if(!StFileNode::isRemoteProtocolPath(theFileToLoad)) {
+        // read local files (including network shares) in background to smooth out storage latency
+        StHandle<StAVIOFileContext> aFileCtx = new StAVIOFileContext();
+        aFileCtx->setReadAhead(THE_READ_AHEAD_BYTES);
+        if(aFileCtx->open(theFileToLoad)) {
+            aFormatCtx = avformat_alloc_context();
+            aFormatCtx->pb = aFileCtx->getAvioContext();
+            anIOContext = aFileCtx;
+        }
     }
 
 #if(LIBAVFORMAT_VERSION_INT >= AV_VERSION_INT(53, 2, 0))
@@ -685,6 +712,21 @@ bool StVideo::openSource(const StHandle<StFileNode>&     theNewSource,
     params.activeAudio    ->setList(aStreamsInfo.AudioList,    aStreamsInfo.LoadedAudio);
     params.activeSubtitles->setList(aStreamsInfo.SubtitleList, aStreamsInfo.LoadedSubtitles);
 
+    if(theNewSource->isEmpty()
+    && myVideoMaster->isInitialized()) {
+        // remember properties so that they can be retrieved without opening the file
+        StMediaInfoIndex::Entry anIndexEntry;
+        anIndexEntry.SizeX        = myVideoMaster->sizeX();
+        anIndexEntry.SizeY        = myVideoMaster->sizeY();
+        anIndexEntry.NbImages     = myVideoSlave->isInitialized() ? 2 : 1;
+        anIndexEntry.StereoFormat = myVideoMaster->getStereoFormatFromStream();
+        anIndexEntry.Duration     = aStreamsInfo.Duration;
+        anIndexEntry.StreamKinds  = StMediaInfoIndex::StreamKind_Video
+                                  | (!aStreamsInfo.AudioList->isEmpty()    ? StMediaInfoIndex::StreamKind_Audio     : 0)
+                                  | (!aStreamsInfo.SubtitleList->isEmpty() ? StMediaInfoIndex::StreamKind_Subtitles : 0);
+        myInfoIndex->update(theNewSource->getPath(), anIndexEntry);
+    }
+
     myEventMutex.lock();
         myDuration = aStreamsInfo.Duration;
         myFileInfo = myFileInfoTmp;
@@ -797,14 +839,43 @@ bool StVideo::doSeekStream(AVFormatContext* theFormatCtx,
     return isSeekDone;
 }
 
-bool StVideo::pushPacket(StHandle<StAVPacketQueue>& theAVPacketQueue,
-                         StAVPacket& thePacket) {
-    if(theAVPacketQueue->isFull()) {
-        return false;
+void StVideo::startDemuxers() {
+    stopDemuxers();
+
+    StArrayList< StHandle<StAVPacketQueue> > aQueues(4);
+    aQueues.add(myVideoMaster);
+    aQueues.add(myVideoSlave);
+    aQueues.add(myAudio);
+    aQueues.add(mySubtitles);
+    for(size_t aCtxId = 0; aCtxId < myCtxList.size(); ++aCtxId) {
+        AVFormatContext* aFormatCtx = myCtxList[aCtxId];
+        if(!myVideoMaster->isInContext(aFormatCtx)
+        && !myVideoSlave->isInContext(aFormatCtx)
+        && !myAudio->isInContext(aFormatCtx)
+        && !mySubtitles->isInContext(aFormatCtx)) {
+            continue;
+        }
+
+        myPlayCtxList.add(aFormatCtx);
+        myDemuxers.add(new StAVDemuxThread(aFormatCtx, aQueues, myCurrParams));
+    }
+}
+
+void StVideo::stopDemuxers() {
+    myDemuxers.clear();
+    myPlayCtxList.clear();
+}
+
+void StVideo::pauseDemuxers() {
+    for(size_t aDemuxIter = 0; aDemuxIter < myDemuxers.size(); ++aDemuxIter) {
+        myDemuxers[aDemuxIter]->pause();
+    }
+}
+
+void StVideo::resumeDemuxers(const bool theToReset) {
+    for(size_t aDemuxIter = 0; aDemuxIter < myDemuxers.size(); ++aDemuxIter) {
+        myDemuxers[aDemuxIter]->resume(theToReset);
     }
-    thePacket.setDurationSeconds(theAVPacketQueue->unitsToSeconds(thePacket.getDuration()));
-    theAVPacketQueue->push(thePacket);
-    return true;
 }
 
 void StVideo::checkInitVideoStreams() {
@@ -816,6 +887,7 @@ void StVideo::checkInitVideoStreams() {
                            || (myVideoSlave->isInitialized() && myVideoSlave->isGpuFailed());
     if(toUseGpu      != myVideoMaster->toUseGpu()
     || toDecodeSlave != myVideoSlave->isInitialized()) {
+        stopDemuxers();
         doFlush();
         if(myVideoMaster->isInitialized()) {
             const StString   aFileNameMaster = myVideoMaster->getFileName();
@@ -853,6 +925,8 @@ void StVideo::checkInitVideoStreams() {
             myVideoMaster->setUseGpu(toUseGpu);
             myVideoSlave ->setUseGpu(toUseGpu);
         }
+        // slave video might be stored in another file
+        startDemuxers();
     }
 }
 
@@ -890,72 +964,23 @@ void StVideo::packetsLoop() {
     // indicate new file opened
     signals.onLoaded();
 
-    StArrayList<StAVPacket> anAVPackets(myCtxList.size());
-    StArrayList<bool> aQueueIsFull(myCtxList.size());
-    myPlayCtxList.clear();
-    size_t anEmptyQueues = 0;
-    size_t aCtxId = 0;
-    for(aCtxId = 0; aCtxId < myCtxList.size(); ++aCtxId) {
-        aFormatCtx = myCtxList[aCtxId];
-        if(!myVideoMaster->isInContext(aFormatCtx)
-        && !myVideoSlave->isInContext(aFormatCtx)
-        && !myAudio->isInContext(aFormatCtx)
-        && !mySubtitles->isInContext(aFormatCtx)) {
-            continue;
-        }
-
-        myPlayCtxList.add(aFormatCtx);
-        anAVPackets.add(StAVPacket(myCurrParams));
-        aQueueIsFull.add(false);
-    }
+    // start demuxing threads
+    startDemuxers();
 
     // reset target FPS
     myEventMutex.lock();
     myTargetFps = 0.0;
     myEventMutex.unlock();
 
+    size_t aCtxId = 0;
     for(;;) {
-        anEmptyQueues = 0;
-        for(aCtxId = 0; aCtxId < myPlayCtxList.size(); ++aCtxId) {
-            aFormatCtx = myPlayCtxList[aCtxId];
-            StAVPacket& aPacket = anAVPackets[aCtxId];
-            if(!aQueueIsFull[aCtxId]) {
-                // read next packet
-                if(av_read_frame(aFormatCtx, aPacket.getAVpkt()) < 0) {
-                    ++anEmptyQueues;
-                    continue;
-                }
-            }
-
-            // push packet to appropriate queue
-            if(myVideoMaster->isInContext(aFormatCtx, aPacket.getStreamId())) {
-                aQueueIsFull[aCtxId] = !pushPacket(myVideoMaster, aPacket);
-                if(aQueueIsFull[aCtxId]) {
-                    continue;
-                }
-                const double aTagerFpsNew = myVideoTimer->getAverFps();
-                if(myTargetFps != aTagerFpsNew) {
-                    myEventMutex.lock();
-                    myTargetFps = aTagerFpsNew;
-                    myEventMutex.unlock();
-                }
-            } else if(myVideoSlave->isInContext(aFormatCtx, aPacket.getStreamId())) {
-                aQueueIsFull[aCtxId] = !pushPacket(myVideoSlave, aPacket);
-                if(aQueueIsFull[aCtxId]) {
-                    continue;
-                }
-            } else if(myAudio->isInContext(aFormatCtx, aPacket.getStreamId())) {
-                aQueueIsFull[aCtxId] = !pushPacket(myAudio, aPacket);
-                if(aQueueIsFull[aCtxId]) {
-                    continue;
-                }
-            } else if(mySubtitles->isInContext(aFormatCtx, aPacket.getStreamId())) {
-                aQueueIsFull[aCtxId] = !pushPacket(mySubtitles, aPacket);
-                if(aQueueIsFull[aCtxId]) {
-                    continue;
-                }
+        if(myVideoMaster->isInitialized()) {
+            const double aTagerFpsNew = myVideoTimer->getAverFps();
+            if(myTargetFps != aTagerFpsNew) {
+                myEventMutex.lock();
+                myTargetFps = aTagerFpsNew;
+                myEventMutex.unlock();
             }
-            aPacket.free();
         }
 
         // check events
@@ -989,6 +1014,7 @@ void StVideo::packetsLoop() {
                     myQuitEvent.set();
                 }
 
+                stopDemuxers();
                 doFlush();
                 if(myAudio->isInitialized()) {
                     myAudio->pushPlayEvent(ST_PLAYEVENT_SEEK, 0.0);
@@ -999,6 +1025,7 @@ void StVideo::packetsLoop() {
             }
         } else if(params.activeAudio->wasChanged()) {
             double aCurrPts = getPts();
+            stopDemuxers();
             doFlushSoft();
             const bool toPlayNewAudio = isPlaying();
             if(myAudio->isInitialized()) {
@@ -1034,22 +1061,7 @@ void StVideo::packetsLoop() {
             }
 
             // exclude inactive contexts
-            myPlayCtxList.clear();
-            anAVPackets.clear();
-            aQueueIsFull.clear();
-            anEmptyQueues = 0;
-            for(aCtxId = 0; aCtxId < myCtxList.size(); ++aCtxId) {
-                aFormatCtx = myCtxList[aCtxId];
-                if(!myVideoMaster->isInContext(aFormatCtx)
-                && !myVideoSlave->isInContext(aFormatCtx)
-                && !myAudio->isInContext(aFormatCtx)
-                && !mySubtitles->isInContext(aFormatCtx)) {
-                    continue;
-                }
-                myPlayCtxList.add(aFormatCtx);
-                anAVPackets.add(StAVPacket(myCurrParams));
-                aQueueIsFull.add(false);
-            }
+            startDemuxers();
 
             pushPlayEvent(ST_PLAYEVENT_SEEK, aCurrPts);
             if(toPlayNewAudio) {
@@ -1057,6 +1069,7 @@ void StVideo::packetsLoop() {
             }
         } else if(params.activeSubtitles->wasChanged()) {
             double aCurrPts = getPts();
+            stopDemuxers();
             doFlushSoft();
             if(mySubtitles->isInitialized()) {
                 mySubtitles->pushEnd();
@@ -1088,37 +1101,17 @@ void StVideo::packetsLoop() {
             }
 
             // exclude inactive contexts
-            myPlayCtxList.clear();
-            anAVPackets.clear();
-            aQueueIsFull.clear();
-            anEmptyQueues = 0;
-            for(aCtxId = 0; aCtxId < myCtxList.size(); ++aCtxId) {
-                aFormatCtx = myCtxList[aCtxId];
-                if(!myVideoMaster->isInContext(aFormatCtx)
-                && !myVideoSlave->isInContext(aFormatCtx)
-                && !myAudio->isInContext(aFormatCtx)
-                && !mySubtitles->isInContext(aFormatCtx)) {
-                    continue;
-                }
-                myPlayCtxList.add(aFormatCtx);
-                anAVPackets.add(StAVPacket(myCurrParams));
-                aQueueIsFull.add(false);
-            }
+            startDemuxers();
 
             pushPlayEvent(ST_PLAYEVENT_SEEK, aCurrPts);
         } else if(aPlayEvent == ST_PLAYEVENT_SEEK) {
+            // seek all contexts at once, ignoring current packets
+            pauseDemuxers();
             doSeek(aSeekPts, toSeekBack);
-            // ignore current packet
-            for(aCtxId = 0; aCtxId < myPlayCtxList.size(); ++aCtxId) {
-                aQueueIsFull[aCtxId] = false;
-                anAVPackets[aCtxId].free();
-            }
+            resumeDemuxers(true);
         }
 
-        ///
-        if(aQueueIsFull[0]) {
-            StThread::sleep(2);
-        }
+        StThread::sleep(2);
 
     #ifdef ST_DEBUG
         const double aPts = getPts();
@@ -1130,7 +1123,13 @@ void StVideo::packetsLoop() {
     #endif
 
         // All packets sent
-        if(anEmptyQueues == myPlayCtxList.size()) {
+        size_t anEmptyQueues = 0;
+        for(size_t aDemuxIter = 0; aDemuxIter < myDemuxers.size(); ++aDemuxIter) {
+            if(myDemuxers[aDemuxIter]->isEof()) {
+                ++anEmptyQueues;
+            }
+        }
+        if(anEmptyQueues == myDemuxers.size()) {
             bool areFlushed = false;
             // It seems FFmpeg fail to seek the stream after all packets were read...
             // Thus - we just wait until queues process all packets
@@ -1165,6 +1164,7 @@ void StVideo::packetsLoop() {
             break;
         }
     }
+    stopDemuxers();
 
     // now send 'end-packet'
     if(myVideoMaster->isInitialized()) myVideoMaster->pushEnd();
@@ -1294,6 +1294,39 @@ StHandle<StMovieInfo> StVideo::getFileInfo(const StHandle<StStereoParams>& thePa
     return anInfo;
 }
 
+StHandle<StMovieInfo> StVideo::getFileInfoFromIndex(const StHandle<StFileNode>&     theFile,
+                                                    const StHandle<StStereoParams>& theParams) const {
+    if(theFile.isNull()
+    || !theFile->isEmpty()) {
+        return NULL;
+    }
+
+    const StString aFilePath = theFile->getPath();
+    StMediaInfoIndex::Entry anEntry;
+    if(!myInfoIndex->scan(aFilePath, anEntry)) {
+        return NULL;
+    }
+
+    StHandle<StMovieInfo> anInfo = new StMovieInfo();
+    anInfo->Id           = theParams;
+    anInfo->Path         = aFilePath;
+    anInfo->StInfoStream = anEntry.StereoFormat;
+    anInfo->HasVideo     = (anEntry.StreamKinds & StMediaInfoIndex::StreamKind_Video) != 0;
+
+    StString aTitleString, aFolder;
+    StFileNode::getFolderAndFile(aFilePath, aFolder, aTitleString);
+    bool isAnamorphByName = false;
+    anInfo->StInfoFileName = st::formatFromName(aTitleString, isAnamorphByName);
+    anInfo->Info.add(StArgument(tr(INFO_FILE_NAME), aTitleString));
+    if(anInfo->HasVideo) {
+        anInfo->Info.add(StArgument(tr(INFO_DIMENSIONS), StString() + anEntry.SizeX + " x " + anEntry.SizeY));
+    }
+    if(anEntry.Duration > 0.0) {
+        anInfo->Info.add(StArgument(tr(INFO_DURATION), StFormatTime::formatSeconds(anEntry.Duration)));
+    }
+    return anInfo;
+}
+
 void StVideo::doRemovePhysically(const StHandle<StFileNode>& theFile) {
     if(theFile.isNull()
     || theFile->size() != 0) {
@@ -1320,6 +1353,7 @@ void StVideo::mainLoop() {
     StHandle<StStereoParams> aFileParams;
     double aDummy;
     bool aDummyBool;
+    myInfoIndex->load();
     for(;;) {
         // wait for initial message
         waitEvent();
@@ -1339,6 +1373,7 @@ void StVideo::mainLoop() {
 
     // initial play event
     for(;;) {
+        myTextureQueue->changeStatistics().reset();
 
         if(myVideoMaster->isInContext(myCtxList[0])) {
             myVideoTimer = new StVideoTimer(myVideoMaster, myAudio,
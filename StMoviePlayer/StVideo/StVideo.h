@@ -23,9 +23,11 @@
 #include "StAudioQueue.h"   // audio queue class
 #include "StSubtitleQueue.h"// subtitles queue class
 #include "StVideoTimer.h"   // video refresher class
+#include "StAVDemuxThread.h"// demuxing thread class
 #include "StParamActiveStream.h"
 
 #include <StAV/StAVIOFileContext.h>
+#include <StFile/StMediaInfoIndex.h>
 #include <StFile/StMIMEList.h>
 #include <StThreads/StProcess.h>
 #include <StThreads/StThread.h>
@@ -53,6 +55,7 @@ struct StMovieInfo {
 
 template<> inline void StArray< StHandle<StFileNode> >::sort() {}
 template<> inline void StArray< StHandle<StAVIOContext> >::sort() {}
+template<> inline void StArray< StHandle<StAVDemuxThread> >::sort() {}
 
 /**
  * Auxiliary structure.
@@ -176,6 +179,16 @@ class StVideo {
      */
     ST_LOCAL StHandle<StMovieInfo> getFileInfo(const StHandle<StStereoParams>& theParams) const;
 
+    /**
+     * Retrieve basic properties of not (yet) opened file from persistent index,
+     * probing only container header when file is not indexed.
+     * @param theFile   file node
+     * @param theParams file parameters to be used as info identifier
+     * @return NULL if properties are unavailable
+     */
+    ST_LOCAL StHandle<StMovieInfo> getFileInfoFromIndex(const StHandle<StFileNode>&     theFile,
+                                                        const StHandle<StStereoParams>& theParams) const;
+
         public: //! @name callback Slots
 
     /**
@@ -389,8 +402,27 @@ class StVideo {
                                 const signed int theStreamId,
                                 const double     theSeekPts,
                                 const bool       toSeekBack);
-    ST_LOCAL bool pushPacket(StHandle<StAVPacketQueue>& theAVPacketQueue,
-                             StAVPacket& thePacket);
+
+    /**
+     * Start demuxing thread for each format context with active streams.
+     */
+    ST_LOCAL void startDemuxers();
+
+    /**
+     * Stop all demuxing threads.
+     */
+    ST_LOCAL void stopDemuxers();
+
+    /**
+     * Pause all demuxing threads before seeking format contexts.
+     */
+    ST_LOCAL void pauseDemuxers();
+
+    /**
+     * Resume all demuxing threads.
+     * @param theToReset drop pending packets and EOF state
+     */
+    ST_LOCAL void resumeDemuxers(const bool theToReset);
 
     /**
      * Re-initialize video streams if needed (source format change, GPU decoding).
@@ -434,6 +466,7 @@ class StVideo {
     StMIMEList                    myMimesSubs;
     StHandle<StThread>            myThread;      //!< main loop thread
     StHandle<StResourceManager>   myResMgr;      //!< resource manager
+    StHandle<StMediaInfoIndex>    myInfoIndex;   //!< persistent index of media properties
     StHandle<StTranslations>      myLangMap;     //!< translations dictionary
 
     StArrayList<StString>         myFileList;    //!< file list
@@ -441,6 +474,8 @@ class StVideo {
     StArrayList< StHandle<StAVIOContext> >
                                   myFileIOList;  //!< associated IO context
     StArrayList<AVFormatContext*> myPlayCtxList; //!< currently played contexts
+    StArrayList< StHandle<StAVDemuxThread> >
+                                  myDemuxers;    //!< demuxing thread for each played context
 
     StHandle<StVideoQueue>        myVideoMaster;  //!< Master video decoding thread
     StHandle<StVideoQueue>        myVideoSlave;   //!< Slave  video decoding thread
@@ -0,0 +1,168 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StMoviePlayer program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StMoviePlayer program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StVideoQualityControl.h"
+
+#include <StStrings/StLogger.h>
+
+namespace {
+
+    static const double THE_WINDOW_SEC        = 1.0;  //!< window duration in stream time
+    static const size_t THE_WINDOW_MIN        = 8;    //!< minimal number of frames within window
+    static const double THE_LATE_SEC          = 0.1;  //!< frames later than this are considered as deadline misses
+    static const double THE_LATE_RATIO        = 0.25; //!< fraction of late frames to escalate
+    static const double THE_DECODE_LOAD_MAX   = 0.9;  //!< decoding time fraction to escalate
+    static const double THE_DECODE_LOAD_MIN   = 0.6;  //!< decoding time fraction allowing to relax
+    static const double THE_UPLOAD_LOAD_MAX   = 0.5;  //!< upload time fraction to escalate
+    static const double THE_MISSES_RATIO      = 0.1;  //!< fraction of vsync misses to escalate (when decoding is heavy)
+    static const int    THE_RELAX_WINDOWS     = 3;    //!< initial number of windows with headroom to relax
+    static const int    THE_RELAX_WINDOWS_MAX = 48;   //!< maximal number of windows with headroom to relax
+
+}
+
+const char* StVideoQualityControl::getLevelName(const Level theLevel) {
+    switch(theLevel) {
+        case Level_Full:           return "full";
+        case Level_SkipLoopFilter: return "skip loop filter";
+        case Level_SkipNonRef:     return "skip non-reference frames";
+        case Level_LowRes:         return "low resolution";
+        case Level_HalfRateEye:    return "half rate for second view";
+        case Level_NB:             break;
+    }
+    return "unknown";
+}
+
+StVideoQualityControl::StVideoQualityControl() {
+    for(int aLevelIter = 0; aLevelIter < Level_NB; ++aLevelIter) {
+        myIsSupported[aLevelIter] = true;
+    }
+    reset();
+}
+
+void StVideoQualityControl::reset() {
+    myLevel       = Level_Full;
+    myUploadPrev  = 0.0;
+    myUploadsPrev = 0;
+    myDroppedPrev = 0;
+    myMissesPrev  = 0;
+    myGoodWindows = 0;
+    myRelaxAfter  = THE_RELAX_WINDOWS;
+    myIsRelaxed   = false;
+    resetWindow();
+}
+
+void StVideoQualityControl::resetWindow() {
+    myWinDuration = 0.0;
+    myWinDecode   = 0.0;
+    myWinFrames   = 0;
+    myWinLate     = 0;
+}
+
+StVideoQualityControl::Level StVideoQualityControl::nextLevel(const Level theFrom,
+                                                              const int   theDir) const {
+    for(int aLevel = int(theFrom) + theDir; aLevel >= Level_Full && aLevel < Level_NB; aLevel += theDir) {
+        if(myIsSupported[aLevel]) {
+            return Level(aLevel);
+        }
+    }
+    return theFrom;
+}
+
+void StVideoQualityControl::changeLevel(const Level theLevel,
+                                        const char* theReason) {
+    StLogger::GetDefault().write(StString("Video quality: ") + getLevelName(myLevel)
+                               + " -> " + getLevelName(theLevel) + " (" + theReason + ")",
+                                 StLogger::ST_INFO);
+    myLevel = theLevel;
+}
+
+bool StVideoQualityControl::update(const Sample& theSample) {
+    ++myWinFrames;
+    myWinDuration += theSample.DurationSec;
+    myWinDecode   += theSample.DecodeSec;
+    if(theSample.LateSec > THE_LATE_SEC) {
+        ++myWinLate;
+    }
+    if(myWinDuration < THE_WINDOW_SEC
+    || myWinFrames   < THE_WINDOW_MIN) {
+        return false;
+    }
+
+    // counters might be reset on opening new file
+    const size_t aNbDropped = theSample.NbDropped     >= myDroppedPrev ? theSample.NbDropped     - myDroppedPrev : 0;
+    const size_t aNbMisses  = theSample.NbVsyncMisses >= myMissesPrev  ? theSample.NbVsyncMisses - myMissesPrev  : 0;
+    const size_t aNbUploads = theSample.NbUploads     >  myUploadsPrev ? theSample.NbUploads     - myUploadsPrev : 0;
+    const double anUploadSec = aNbUploads != 0 ? (theSample.UploadSec - myUploadPrev) / double(aNbUploads) : 0.0;
+    myUploadPrev  = theSample.UploadSec;
+    myUploadsPrev = theSample.NbUploads;
+    myDroppedPrev = theSample.NbDropped;
+    myMissesPrev  = theSample.NbVsyncMisses;
+
+    const double aFrameSec    = myWinDuration / double(myWinFrames);
+    const double aDecodeLoad  = myWinDecode / myWinDuration;
+    const double anUploadLoad = anUploadSec / aFrameSec;
+    const double aLateRatio   = double(myWinLate) / double(myWinFrames);
+    const double aMissRatio   = double(aNbMisses) / double(myWinFrames);
+
+    const char* anOverload = NULL;
+    if(aNbDropped != 0) {
+        anOverload = "frames dropped";
+    } else if(aLateRatio > THE_LATE_RATIO) {
+        anOverload = "frames late";
+    } else if(aDecodeLoad > THE_DECODE_LOAD_MAX) {
+        anOverload = "decoding too slow";
+    } else if(anUploadLoad > THE_UPLOAD_LOAD_MAX) {
+        anOverload = "upload too slow";
+    } else if(aMissRatio > THE_MISSES_RATIO
+           && aDecodeLoad > THE_DECODE_LOAD_MIN) {
+        anOverload = "vsync misses";
+    }
+    const bool hasHeadroom = anOverload  == NULL
+                          && myWinLate   == 0
+                          && aNbMisses   == 0
+                          && aDecodeLoad < THE_DECODE_LOAD_MIN;
+    resetWindow();
+
+    const Level aPrevLevel = myLevel;
+    if(anOverload != NULL) {
+        myGoodWindows = 0;
+        if(myIsRelaxed) {
+            // the level has been relaxed too early
+            myRelaxAfter = stMin(myRelaxAfter * 2, THE_RELAX_WINDOWS_MAX);
+        }
+        myIsRelaxed = false;
+        const Level aNext = nextLevel(myLevel, 1);
+        if(aNext != myLevel) {
+            changeLevel(aNext, anOverload);
+        }
+    } else if(hasHeadroom) {
+        myIsRelaxed = false;
+        if(++myGoodWindows >= myRelaxAfter) {
+            myGoodWindows = 0;
+            const Level aNext = nextLevel(myLevel, -1);
+            if(aNext != myLevel) {
+                changeLevel(aNext, "headroom");
+                myIsRelaxed = true;
+            }
+        }
+    } else {
+        myGoodWindows = 0;
+        myIsRelaxed   = false;
+    }
+    return myLevel != aPrevLevel;
+}
@@ -0,0 +1,148 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StMoviePlayer program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StMoviePlayer program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __StVideoQualityControl_h_
+#define __StVideoQualityControl_h_
+
+#include <stTypes.h>
+
+/**
+ * Feedback controller choosing the video decoding quality level.
+ * Timing samples (frame lateness relative to audio clock, decoding time, upload time,
+ * dropped frames and vsync misses) are accumulated within ~1 second windows of stream time.
+ * Overloaded window escalates degradation by one step,
+ * while several windows with enough headroom relax it back by one step.
+ * Relaxing is delayed twice longer each time it has been followed by immediate escalation,
+ * to avoid oscillation between two levels.
+ */
+class StVideoQualityControl {
+
+        public:
+
+    /**
+     * Degradation steps in order of escalation.
+     */
+    enum Level {
+        Level_Full = 0,       //!< decode everything
+        Level_SkipLoopFilter, //!< skip in-loop (deblocking) filter
+        Level_SkipNonRef,     //!< skip decoding of non-reference frames
+        Level_LowRes,         //!< decode at half resolution (if supported by codec)
+        Level_HalfRateEye,    //!< show second view of dual-stream video at half frame rate
+        Level_NB
+    };
+
+    /**
+     * Timing sample of single decoded frame.
+     */
+    struct Sample {
+        double LateSec;       //!< frame lateness relative to audio clock (negative when frame is early)
+        double DecodeSec;     //!< time spent on decoding the frame
+        double DurationSec;   //!< frame duration in stream time
+        double UploadSec;     //!< total time spent on texture uploads
+        size_t NbUploads;     //!< total number of texture uploads
+        size_t NbDropped;     //!< total number of decoded frames dropped by presentation
+        size_t NbVsyncMisses; //!< total number of displayed frames missed vsync
+
+        Sample() : LateSec(0.0), DecodeSec(0.0), DurationSec(0.0), UploadSec(0.0), NbUploads(0), NbDropped(0), NbVsyncMisses(0) {}
+    };
+
+        public:
+
+    /**
+     * @return level name for logging
+     */
+    ST_LOCAL static const char* getLevelName(const Level theLevel);
+
+    /**
+     * Empty constructor.
+     */
+    ST_LOCAL StVideoQualityControl();
+
+    /**
+     * Reset to full quality and forget accumulated statistics (e.g. on opening new stream).
+     */
+    ST_LOCAL void reset();
+
+    /**
+     * Mark degradation step as (un)supported by current stream, unsupported steps are skipped.
+     */
+    ST_LOCAL void setSupported(const Level theLevel,
+                               const bool  theIsSupported) {
+        myIsSupported[theLevel] = theIsSupported;
+    }
+
+    /**
+     * @return current level
+     */
+    ST_LOCAL Level getLevel() const {
+        return myLevel;
+    }
+
+    /**
+     * @return true if there are no more degradation steps
+     */
+    ST_LOCAL bool isExhausted() const {
+        return nextLevel(myLevel, 1) == myLevel;
+    }
+
+    /**
+     * Process timing sample of decoded frame.
+     * @return true if level has been changed
+     */
+    ST_LOCAL bool update(const Sample& theSample);
+
+        private:
+
+    /**
+     * @return next supported level in specified direction or the same level if none
+     */
+    ST_LOCAL Level nextLevel(const Level theFrom,
+                             const int   theDir) const;
+
+    /**
+     * Switch to new level and log the decision.
+     */
+    ST_LOCAL void changeLevel(const Level theLevel,
+                              const char* theReason);
+
+    /**
+     * Reset window accumulators.
+     */
+    ST_LOCAL void resetWindow();
+
+        private:
+
+    bool   myIsSupported[Level_NB]; //!< supported degradation steps
+    Level  myLevel;                 //!< current level
+
+    double myWinDuration;           //!< stream time within current window
+    double myWinDecode;             //!< decoding time within current window
+    size_t myWinFrames;             //!< number of frames within current window
+    size_t myWinLate;               //!< number of late frames within current window
+    double myUploadPrev;            //!< upload time counter at the beginning of window
+    size_t myUploadsPrev;           //!< uploads counter at the beginning of window
+    size_t myDroppedPrev;           //!< dropped frames counter at the beginning of window
+    size_t myMissesPrev;            //!< vsync misses counter at the beginning of window
+
+    int    myGoodWindows;           //!< number of consecutive windows with headroom
+    int    myRelaxAfter;            //!< number of windows with headroom required to relax the level
+    bool   myIsRelaxed;             //!< flag indicating that previous decision has relaxed the level
+
+};
+
+#endif // __StVideoQualityControl_h_
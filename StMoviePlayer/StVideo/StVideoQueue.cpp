@@ -54,6 +54,18 @@ namespace {
     }
 #endif
 
+    /**
+     * Return nominal frame duration of the stream.
+     */
+    static double stFrameDurationNominal(const AVStream* theStream) {
+        if(theStream == NULL
+        || theStream->avg_frame_rate.num <= 0
+        || theStream->avg_frame_rate.den <= 0) {
+            return 0.04;
+        }
+        return av_q2d(av_inv_q(theStream->avg_frame_rate));
+    }
+
     /**
      * Thread function just call decodeLoop() function.
      */
@@ -155,6 +167,7 @@ StVideoQueue::StVideoQueue(const StHandle<StGLTextureQueue>& theTextureQueue,
   myDowntimeState(true),
   myTextureQueue(theTextureQueue),
   myHasDataState(false),
+  myNoDataState(true),
   myMaster(theMaster),
 #if defined(__APPLE__)
   myCodecH264HW(avcodec_find_decoder_by_name("h264_vda")),
@@ -170,7 +183,12 @@ StVideoQueue::StVideoQueue(const StHandle<StGLTextureQueue>& theTextureQueue,
   myToRgbPixFmt(stAV::PIX_FMT::NONE),
   myToRgbIsBroken(false),
   //
-  myAvDiscard(AVDISCARD_DEFAULT),
+  myLowResTarget(0),
+  myLowResNext(0),
+  myLowResSwitchPts(0.0),
+  myIsHalfRate(false),
+  myIsQualityExhausted(false),
+  myDecodeSecLast(0.0f),
   myFramePts(0.0),
   myPixelRatio(1.0f),
   myHParallax(0),
@@ -252,6 +270,31 @@ namespace {
 
 }
 
+int StVideoQueue::getNbDecodeThreads() const {
+    const int aNbThreads = StThread::countLogicalProcessors();
+    if(myMaster.isNull()
+    && mySlave.isNull()) {
+        return aNbThreads;
+    }
+    return stMax(aNbThreads / 2, 1);
+}
+
+void StVideoQueue::setSlave(const StHandle<StVideoQueue>& theSlave) {
+    mySlave = theSlave;
+    if(myCodec == NULL
+    || myCodecCtx->thread_count <= 1 // decoding on GPU or attached picture
+    || myCodecCtx->thread_count == getNbDecodeThreads()) {
+        return;
+    }
+
+    // thread count can not be changed for opened codec
+    AVCodec* aCodec = myCodec;
+    if(!initCodec(aCodec, false)) {
+        signals.onError(stCString("FFmpeg: Could not re-open video codec"));
+        deinit();
+    }
+}
+
 bool StVideoQueue::initCodec(AVCodec*   theCodec,
                              const bool theToUseGpu) {
     // close previous codec
@@ -271,7 +314,7 @@ bool StVideoQueue::initCodec(AVCodec*   theCodec,
     // attached pics are sparse, therefore we would not want to delay their decoding till EOF
     int aNbThreads = theToUseGpu || isAttachedPicture()
                    ? 1
-                   : StThread::countLogicalProcessors();
+                   : getNbDecodeThreads();
     myCodecCtx->thread_count = aNbThreads;
 #if(LIBAVCODEC_VERSION_INT < AV_VERSION_INT(52, 112, 0))
     avcodec_thread_init(myCodecCtx, aNbThreads);
@@ -515,6 +558,17 @@ void StVideoQueue::deinit() {
     myFramesCounter = 1;
     myCachedFrame.nullify();
 
+    myQualityCtrl.reset();
+    myLowResTarget       = 0;
+    myLowResNext         = 0;
+    myLowResSwitchPts    = 0.0;
+    myIsHalfRate         = false;
+    myIsQualityExhausted = false;
+    myDecodeSecLast      = 0.0f;
+
+    if(myCodecCtx != NULL) {
+        myCodecCtx->lowres = 0;
+    }
     if(myCodecCtx  != NULL
     && myCodecAuto != NULL) {
         myCodecCtx->codec_id = myCodecAuto->id;
@@ -552,8 +606,14 @@ void StVideoQueue::prepareFrame(const StFormat theSrcFormat) {
     int           aFrameSizeY = 0;
     AVPixelFormat aPixFmt     = stAV::PIX_FMT::NONE;
     stAV::dimYUV  aDimsYUV;
+    int           aGbrBits    = 8;
+    bool          aGbrAlpha   = false;
     myFrame.getImageInfo(myCodecCtx, aFrameSizeX, aFrameSizeY, aPixFmt);
     myDataAdp.setBufferCounter(NULL);
+    // planes are assigned per frame depending on pixel format
+    myDataAdp.changePlane(1).nullify();
+    myDataAdp.changePlane(2).nullify();
+    myDataAdp.changePlane(3).nullify();
     if(aPixFmt == stAV::PIX_FMT::XYZ12) {
         myDataAdp.setColorModel(StImage::ImgColor_XYZ);
         myDataAdp.setColorScale(StImage::ImgScale_Full);
@@ -603,10 +663,13 @@ void StVideoQueue::prepareFrame(const StFormat theSrcFormat) {
         } else if(aDimsYUV.bitsPerComp == 10) {
             aPlaneFrmt = StImagePlane::ImgGray16;
             myDataAdp.setColorScale(aDimsYUV.isFullScale ? StImage::ImgScale_Jpeg10 : StImage::ImgScale_Mpeg10);
+        } else if(aDimsYUV.bitsPerComp == 12) {
+            aPlaneFrmt = StImagePlane::ImgGray16;
+            myDataAdp.setColorScale(aDimsYUV.isFullScale ? StImage::ImgScale_Jpeg12 : StImage::ImgScale_Mpeg12);
         } else if(aDimsYUV.bitsPerComp == 16) {
             aPlaneFrmt = StImagePlane::ImgGray16;
         }
-        myDataAdp.setColorModel(StImage::ImgColor_YUV);
+        myDataAdp.setColorModel(aDimsYUV.hasAlpha ? StImage::ImgColor_YUVA : StImage::ImgColor_YUV);
         myDataAdp.setPixelRatio(getPixelRatio());
         myDataAdp.changePlane(0).initWrapper(aPlaneFrmt, myFrame.getPlane(0),
                                              size_t(aDimsYUV.widthY), size_t(aDimsYUV.heightY), myFrame.getLineSize(0));
@@ -614,10 +677,34 @@ void StVideoQueue::prepareFrame(const StFormat theSrcFormat) {
                                              size_t(aDimsYUV.widthU), size_t(aDimsYUV.heightU), myFrame.getLineSize(1));
         myDataAdp.changePlane(2).initWrapper(aPlaneFrmt, myFrame.getPlane(2),
                                              size_t(aDimsYUV.widthV), size_t(aDimsYUV.heightV), myFrame.getLineSize(2));
+        if(aDimsYUV.hasAlpha) {
+            myDataAdp.changePlane(3).initWrapper(aPlaneFrmt, myFrame.getPlane(3),
+                                                 size_t(aDimsYUV.widthY), size_t(aDimsYUV.heightY), myFrame.getLineSize(3));
+        }
 
         myFrameBufRef->moveReferenceFrom(myFrame.Frame);
         myDataAdp.setBufferCounter(myFrameBufRef);
-    } else if(aPixFmt == stAV::PIX_FMT::NV12) {
+    } else if(stAV::isFormatGBRPlanar(aPixFmt, aGbrBits, aGbrAlpha)) {
+        StImagePlane::ImgFormat aPlaneFrmt = aGbrBits > 8 ? StImagePlane::ImgGray16 : StImagePlane::ImgGray;
+        switch(aGbrBits) {
+            case 9:  myDataAdp.setColorScale(StImage::ImgScale_Jpeg9);  break;
+            case 10: myDataAdp.setColorScale(StImage::ImgScale_Jpeg10); break;
+            case 12: myDataAdp.setColorScale(StImage::ImgScale_Jpeg12); break;
+            default: myDataAdp.setColorScale(StImage::ImgScale_Full);   break;
+        }
+        myDataAdp.setColorModel(aGbrAlpha ? StImage::ImgColor_GBRA : StImage::ImgColor_GBR);
+        myDataAdp.setPixelRatio(getPixelRatio());
+        for(size_t aPlaneId = 0; aPlaneId < (aGbrAlpha ? 4 : 3); ++aPlaneId) {
+            myDataAdp.changePlane(aPlaneId).initWrapper(aPlaneFrmt, myFrame.getPlane(aPlaneId),
+                                                        size_t(aFrameSizeX), size_t(aFrameSizeY), myFrame.getLineSize(aPlaneId));
+        }
+
+        myFrameBufRef->moveReferenceFrom(myFrame.Frame);
+        myDataAdp.setBufferCounter(myFrameBufRef);
+    } else if(aPixFmt == stAV::PIX_FMT::NV12
+           || aPixFmt == stAV::PIX_FMT::P010
+           || aPixFmt == stAV::PIX_FMT::P016) {
+        const bool is16bit = aPixFmt != stAV::PIX_FMT::NV12;
         aDimsYUV.isFullScale = false;
     #if(LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(52, 29, 0))
         if(myCodecCtx->color_range == AVCOL_RANGE_JPEG) {
@@ -625,14 +712,43 @@ void StVideoQueue::prepareFrame(const StFormat theSrcFormat) {
             aDimsYUV.isFullScale = true;
         }
     #endif
-        myDataAdp.setColorScale(aDimsYUV.isFullScale ? StImage::ImgScale_NvFull : StImage::ImgScale_NvMpeg);
+        if(aPixFmt == stAV::PIX_FMT::P010) {
+            myDataAdp.setColorScale(aDimsYUV.isFullScale ? StImage::ImgScale_Nv10Full : StImage::ImgScale_Nv10Mpeg);
+        } else {
+            myDataAdp.setColorScale(aDimsYUV.isFullScale ? StImage::ImgScale_NvFull   : StImage::ImgScale_NvMpeg);
+        }
         myDataAdp.setColorModel(StImage::ImgColor_YUV);
         myDataAdp.setPixelRatio(getPixelRatio());
-        myDataAdp.changePlane(0).initWrapper(StImagePlane::ImgGray, myFrame.getPlane(0),
+        myDataAdp.changePlane(0).initWrapper(is16bit ? StImagePlane::ImgGray16 : StImagePlane::ImgGray, myFrame.getPlane(0),
                                              size_t(aFrameSizeX), size_t(aFrameSizeY), myFrame.getLineSize(0));
-        myDataAdp.changePlane(1).initWrapper(StImagePlane::ImgUV, myFrame.getPlane(1),
+        myDataAdp.changePlane(1).initWrapper(is16bit ? StImagePlane::ImgUV16 : StImagePlane::ImgUV, myFrame.getPlane(1),
                                              size_t(aFrameSizeX / 2), size_t(aFrameSizeY / 2), myFrame.getLineSize(1));
 
+        myFrameBufRef->moveReferenceFrom(myFrame.Frame);
+        myDataAdp.setBufferCounter(myFrameBufRef);
+    } else if(aPixFmt == stAV::PIX_FMT::YUYV422
+           || aPixFmt == stAV::PIX_FMT::UYVY422) {
+        const bool isYuyv = aPixFmt == stAV::PIX_FMT::YUYV422;
+        aDimsYUV.isFullScale = false;
+    #if(LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(52, 29, 0))
+        if(myCodecCtx->color_range == AVCOL_RANGE_JPEG) {
+            aDimsYUV.isFullScale = true;
+        }
+    #endif
+        if(isYuyv) {
+            myDataAdp.setColorScale(aDimsYUV.isFullScale ? StImage::ImgScale_YuyvFull : StImage::ImgScale_YuyvMpeg);
+        } else {
+            myDataAdp.setColorScale(aDimsYUV.isFullScale ? StImage::ImgScale_UyvyFull : StImage::ImgScale_UyvyMpeg);
+        }
+        myDataAdp.setColorModel(StImage::ImgColor_YUV);
+        myDataAdp.setPixelRatio(getPixelRatio());
+        // the same packed data is wrapped twice - as 2-component plane of full width for luma
+        // and as 4-component plane of half width for chroma shared by pixel pairs
+        myDataAdp.changePlane(0).initWrapper(StImagePlane::ImgUV, myFrame.getPlane(0),
+                                             size_t(aFrameSizeX), size_t(aFrameSizeY), myFrame.getLineSize(0));
+        myDataAdp.changePlane(1).initWrapper(StImagePlane::ImgRGBA, myFrame.getPlane(0),
+                                             size_t(aFrameSizeX / 2), size_t(aFrameSizeY), myFrame.getLineSize(0));
+
         myFrameBufRef->moveReferenceFrom(myFrame.Frame);
         myDataAdp.setBufferCounter(myFrameBufRef);
     } else if(!myToRgbIsBroken) {
@@ -690,19 +806,20 @@ void StVideoQueue::prepareFrame(const StFormat theSrcFormat) {
     }
 }
 
-void StVideoQueue::pushFrame(const StImage&     theSrcDataLeft,
+bool StVideoQueue::pushFrame(const StImage&     theSrcDataLeft,
                              const StImage&     theSrcDataRight,
                              const StHandle<StStereoParams>& theStParams,
                              const StFormat     theSrcFormat,
                              const StCubemap    theCubemapFormat,
-                             const double       theSrcPTS) {
+                             const double       theSrcPTS,
+                             const bool         theIsRightRepeated) {
     while(!myToFlush && myTextureQueue->isFull()) {
         StThread::sleep(10);
     }
 
     if(myToFlush) {
         myToFlush = false;
-        return;
+        return false;
     }
 
     if(!theSrcDataLeft.isNull()) {
@@ -730,13 +847,76 @@ void StVideoQueue::pushFrame(const StImage&     theSrcDataLeft,
                                  : StViewSurface_Sphere;
     }
 
-    myTextureQueue->push(theSrcDataLeft, theSrcDataRight, theStParams, theSrcFormat, theCubemapFormat, theSrcPTS);
+    myTextureQueue->push(theSrcDataLeft, theSrcDataRight, theStParams, theSrcFormat, theCubemapFormat, theSrcPTS, theIsRightRepeated);
     myTextureQueue->setConnectedStream(true);
     if(myWasFlushed) {
         // force frame update after seeking regardless playback timer
         myTextureQueue->stglSwapFB(0);
         myWasFlushed = false;
     }
+    return true;
+}
+
+void StVideoQueue::applyQuality() {
+    const StVideoQualityControl::Level aLevel = myQualityCtrl.getLevel();
+    const AVDiscard aLoopFilter = aLevel >= StVideoQualityControl::Level_SkipLoopFilter ? AVDISCARD_ALL    : AVDISCARD_DEFAULT;
+    const AVDiscard aSkipFrame  = aLevel >= StVideoQualityControl::Level_SkipNonRef     ? AVDISCARD_NONREF : AVDISCARD_DEFAULT;
+    const int       aLowRes     = aLevel >= StVideoQualityControl::Level_LowRes         ? 1 : 0;
+    myCodecCtx->skip_loop_filter = aLoopFilter;
+    myCodecCtx->skip_frame       = aSkipFrame;
+    myLowResTarget               = aLowRes; // slave switches together with master, see scheduleLowRes()
+    if(!mySlave.isNull()) {
+        // at half rate, non-reference frames of second view are never decoded
+        const bool isHalfRate = aLevel >= StVideoQualityControl::Level_HalfRateEye;
+        mySlave->myCodecCtx->skip_loop_filter = aLoopFilter;
+        mySlave->myCodecCtx->skip_frame       = isHalfRate ? AVDISCARD_NONREF : aSkipFrame;
+        mySlave->myIsHalfRate                 = isHalfRate;
+    }
+    myIsQualityExhausted = myQualityCtrl.isExhausted();
+}
+
+void StVideoQueue::scheduleLowRes(const double thePktPts,
+                                  const double theFrameDurSec) {
+    if(myLowResTarget == myLowResNext) {
+        return;
+    }
+
+    if(mySlave.isNull()) {
+        myLowResNext      = myLowResTarget;
+        myLowResSwitchPts = thePktPts;
+        return;
+    }
+
+    // slave might be already one frame ahead - postpone the switch to the next key frame
+    // (streams with aligned groups of pictures switch simultaneously)
+    const double aSwitchPts = thePktPts + 2.5 * theFrameDurSec;
+    mySlave->myLowResNext      = myLowResTarget;
+    mySlave->myLowResSwitchPts = aSwitchPts;
+    myLowResNext      = myLowResTarget;
+    myLowResSwitchPts = aSwitchPts;
+}
+
+void StVideoQueue::updateLowRes() {
+    if(myCodec == NULL) {
+        return;
+    }
+
+    const int aLowRes = stMin(int(myLowResNext), int(myCodec->max_lowres));
+    if(myCodecCtx->lowres == aLowRes) {
+        return;
+    }
+
+    // decoder state is reset, thus the switch is done only on key frame
+    AVCodec* aCodec = myCodec;
+    myCodecCtx->lowres = aLowRes;
+    if(!initCodec(aCodec, false)) {
+        ST_ERROR_LOG("FFmpeg: Could not re-open video codec with lowres= " + aLowRes);
+        myCodecCtx->lowres = 0;
+        myLowResNext       = 0;
+        initCodec(aCodec, false);
+        return;
+    }
+    ST_DEBUG_LOG("FFmpeg: Video codec re-opened with lowres= " + aLowRes);
 }
 
 void StVideoQueue::decodeLoop() {
@@ -746,10 +926,14 @@ void StVideoQueue::decodeLoop() {
     double aSlavePts = 0.0;
     myFramePts = 0.0;
     StImage* aSlaveData = NULL;
+    bool isSlaveDataShown = false; // slave frame has been already pushed together with previous master frame
     StHandle<StAVPacket> aPacket;
     StImage anEmptyImg;
     StString aTagValue;
     bool isStarted = false;
+    double aHalfRatePts = 0.0;
+    double aDecodeSec = 0.0;
+    StTimer aDecodeTimer;
     for(;;) {
         if(isEmpty()) {
             myDowntimeState.set();
@@ -782,6 +966,7 @@ void StVideoQueue::decodeLoop() {
                 myAudioClock = 0.0;
                 myVideoClock = 0.0;
                 myHasDataState.reset();
+                myNoDataState.set();
                 isStarted = true;
                 continue;
             }
@@ -792,6 +977,7 @@ void StVideoQueue::decodeLoop() {
                     }
                     // wake up Master
                     myDataAdp.nullify();
+                    myNoDataState.reset();
                     myHasDataState.set();
                 } else {
                     if(!mySlave.isNull()) {
@@ -813,12 +999,36 @@ void StVideoQueue::decodeLoop() {
             }
         }
 
-        // wait master retrieve previous data
-        while(!myMaster.isNull() && myHasDataState.check()) {
-            //
+        // wait master retrieve previous data, so that slave is never more than one frame ahead
+        while(!myMaster.isNull() && myHasDataState.check() && !myToQuit) {
+            myNoDataState.wait(10);
+        }
+
+        // second view at half rate - frames which are not referenced by others are not decoded at all
+    #ifdef AV_PKT_FLAG_DISPOSABLE
+        if(!myMaster.isNull()
+        && myIsHalfRate
+        && (aPacket->getAVpkt()->flags & AV_PKT_FLAG_DISPOSABLE) != 0) {
+            aPacket.nullify();
+            continue;
+        }
+    #endif
+
+        // low resolution decoding can be switched only on key frame
+        if(aPacket->isKeyFrame()
+        && myHWAccelCtx.isNull()) {
+            const int64_t aPktPtsU = aPacket->getPts() != stAV::NOPTS_VALUE ? aPacket->getPts() : aPacket->getDts();
+            const double  aPktPts  = aPktPtsU != stAV::NOPTS_VALUE ? (unitsToSeconds(aPktPtsU) - myPtsStartBase) : myFramePts;
+            if(myMaster.isNull()) {
+                scheduleLowRes(aPktPts, anAverageDelaySec < 1.0 ? anAverageDelaySec : stFrameDurationNominal(myStream));
+            }
+            if(aPktPts >= myLowResSwitchPts) {
+                updateLowRes();
+            }
         }
 
         // decode video frame
+        aDecodeTimer.restart();
     #if(LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(52, 23, 0))
         bool toTryGpu  = myUseGpu && !myIsGpuFailed;
         avcodec_decode_video2(myCodecCtx, myFrame.Frame, &isFrameFinished, aPacket->getAVpkt());
@@ -837,6 +1047,7 @@ void StVideoQueue::decodeLoop() {
         avcodec_decode_video(myCodecCtx, myFrame.Frame, &isFrameFinished,
                              aPacket->getData(), aPacket->getSize());
     #endif
+        aDecodeSec += aDecodeTimer.getElapsedTimeInSec();
         if(isFrameFinished == 0) {
             // need more packets to decode whole frame
             aPacket.nullify();
@@ -888,37 +1099,47 @@ void StVideoQueue::decodeLoop() {
         }
         aPrevPts = myFramePts;
 
-        // do we need to skip frames or not
-        static const double OVERR_LIMIT = 0.2;
+        myDecodeSecLast = float(aDecodeSec);
+        myTextureQueue->changeStatistics().addDecodeTime(myMaster.isNull() ? 0 : 1, aDecodeSec * 1000.0);
+
+        // adjust decoding quality to keep up with the playback
         static const double GREATER_LIMIT = 100.0;
         if(myMaster.isNull()) {
             const double anAudioClock = getAClock() + double(myAudioDelayMSec) * 0.001;
-            double diff = anAudioClock - myFramePts;
-            if(diff > OVERR_LIMIT && diff < GREATER_LIMIT) {
-                if(myAvDiscard != AVDISCARD_NONREF) {
-                    ST_DEBUG_LOG("skip frames: AVDISCARD_NONREF (on)"
-                        + " (aClock " + anAudioClock
-                        + " vClock " + myFramePts
-                        + " diff " + diff + ")"
-                    );
-                    myAvDiscard = AVDISCARD_NONREF;
-                    ///myCodecCtx->skip_frame = AVDISCARD_NONKEY;
-                    myCodecCtx->skip_frame = myAvDiscard;
-                    if(!mySlave.isNull()) {
-                        mySlave->myCodecCtx->skip_frame = myAvDiscard;
-                    }
-                }
-            } else {
-                if(myAvDiscard != AVDISCARD_DEFAULT) {
-                    ST_DEBUG_LOG("skip frames: AVDISCARD_DEFAULT (off)");
-                    myAvDiscard = AVDISCARD_DEFAULT;
-                    myCodecCtx->skip_frame = myAvDiscard;
-                    if(!mySlave.isNull()) {
-                        mySlave->myCodecCtx->skip_frame = myAvDiscard;
-                    }
-                }
+            const double aDiff = anAudioClock - myFramePts;
+            const StFrameStatistics::Snapshot aStats = myTextureQueue->changeStatistics().getSnapshot();
+            StVideoQualityControl::Sample aSample;
+            aSample.LateSec       = aDiff < GREATER_LIMIT ? aDiff : 0.0;
+            // streams are decoded in lockstep, thus the slowest one limits the pair
+            aSample.DecodeSec     = mySlave.isNull() ? aDecodeSec : stMax(aDecodeSec, mySlave->getDecodeTime());
+            aSample.DurationSec   = anAverageDelaySec < 1.0 ? anAverageDelaySec : 0.04;
+            aSample.UploadSec     = aStats.Upload.SumMs * 0.001;
+            aSample.NbUploads     = aStats.Upload.Count;
+            aSample.NbDropped     = aStats.NbDropped;
+            aSample.NbVsyncMisses = aStats.NbVsyncMisses;
+            const bool hasLowRes      = myCodec != NULL && myCodec->max_lowres > 0 && myHWAccelCtx.isNull();
+            const bool hasLowResSlave = mySlave.isNull()
+                                    || (mySlave->myCodec != NULL && mySlave->myCodec->max_lowres > 0 && mySlave->myHWAccelCtx.isNull());
+            myQualityCtrl.setSupported(StVideoQualityControl::Level_LowRes,      hasLowRes && hasLowResSlave);
+            myQualityCtrl.setSupported(StVideoQualityControl::Level_HalfRateEye, !mySlave.isNull());
+            if(myQualityCtrl.update(aSample)) {
+                applyQuality();
             }
         }
+        aDecodeSec = 0.0;
+
+        // show second view at half rate - skip frames of slave stream closer than two frames to the previous one,
+        // before conversion and uploading (frames already discarded by decoder are taken into account)
+        if(!myMaster.isNull()
+        && myIsHalfRate) {
+            if(myFramePts > aHalfRatePts
+            && myFramePts < aHalfRatePts + 1.5 * stFrameDurationNominal(myStream)) {
+                myFrame.reset();
+                aPacket.nullify();
+                continue;
+            }
+            aHalfRatePts = myFramePts;
+        }
 
         // copy frame back from GPU to CPU memory
         if(!myHWAccelCtx.isNull()) {
@@ -994,10 +1215,10 @@ void StVideoQueue::decodeLoop() {
                 if(aSlaveData != NULL) {
                     const double aPtsDiff = myFramePts - aSlavePts;
                     if(aPtsDiff > 0.5 * anAverageDelaySec) {
-                        // wait for more recent frame from slave thread
+                        // wait for more recent frame from slave thread (waitData() blocks till it is decoded)
                         mySlave->unlockData();
                         aSlaveData = NULL;
-                        StThread::sleep(10);
+                        isSlaveDataShown = false;
                         continue;
                     } else if(aPtsDiff < -0.5 * anAverageDelaySec) {
                         // too far...
@@ -1005,13 +1226,21 @@ void StVideoQueue::decodeLoop() {
                             // result of seeking?
                             mySlave->unlockData();
                             aSlaveData = NULL;
+                            isSlaveDataShown = false;
+                        } else if(aPtsDiff > -1.5 * anAverageDelaySec
+                               && myQualityCtrl.getLevel() >= StVideoQualityControl::Level_HalfRateEye) {
+                            // second view is decoded at half rate - show the next slave frame twice,
+                            // it remains locked till the next master frame
+                            isSlaveDataShown = pushFrame(myDataAdp, *aSlaveData, aPacket->getSource(), StFormat_SeparateFrames, aCubemapFormat, myFramePts, isSlaveDataShown);
                         }
                         break;
                     }
 
-                    pushFrame(myDataAdp, *aSlaveData, aPacket->getSource(), StFormat_SeparateFrames, aCubemapFormat, myFramePts);
+                    // the texture of right view is kept instead of uploading the same slave frame again
+                    pushFrame(myDataAdp, *aSlaveData, aPacket->getSource(), StFormat_SeparateFrames, aCubemapFormat, myFramePts, isSlaveDataShown);
 
                     aSlaveData = NULL;
+                    isSlaveDataShown = false;
                     mySlave->unlockData();
                 } else {
                     pushFrame(myDataAdp, anEmptyImg, aPacket->getSource(), aSrcFormat, aCubemapFormat, myFramePts);
@@ -1020,6 +1249,7 @@ void StVideoQueue::decodeLoop() {
             }
         } else if(!myMaster.isNull()) {
             // push data to Master
+            myNoDataState.reset();
             myHasDataState.set();
         } else {
             if(isStarted) {
@@ -22,6 +22,7 @@
 #include <StGLStereo/StGLTextureQueue.h>
 
 #include "StAVPacketQueue.h"
+#include "StVideoQualityControl.h"
 #include <StAV/StAVImage.h>
 
 // forward declarations
@@ -134,8 +135,17 @@ class StVideoQueue : public StAVPacketQueue {
         return myDowntimeState.check();
     }
 
-    ST_LOCAL void setSlave(const StHandle<StVideoQueue>& theSlave) {
-        mySlave = theSlave;
+    /**
+     * Setup slave stream decoded in lockstep with this (master) stream.
+     * The codec is re-opened when the thread budget should be changed.
+     */
+    ST_LOCAL void setSlave(const StHandle<StVideoQueue>& theSlave);
+
+    /**
+     * @return true if decoding quality can not be reduced anymore and late frames should be dropped
+     */
+    ST_LOCAL bool isQualityExhausted() const {
+        return myIsQualityExhausted;
     }
 
     ST_LOCAL StImage* waitData(double& thePts) {
@@ -149,6 +159,14 @@ class StVideoQueue : public StAVPacketQueue {
 
     ST_LOCAL void unlockData() {
         myHasDataState.reset();
+        myNoDataState.set();
+    }
+
+    /**
+     * @return decoding time of the last frame in seconds
+     */
+    ST_LOCAL double getDecodeTime() const {
+        return double(myDecodeSecLast);
     }
 
     ST_LOCAL void setAClock(const double thePts) {
@@ -323,6 +341,13 @@ class StVideoQueue : public StAVPacketQueue {
     ST_LOCAL bool initCodec(AVCodec*   theCodec,
                             const bool theToUseGpu);
 
+    /**
+     * Return the number of decoding threads.
+     * Logical processors are shared between master and slave streams,
+     * so that two high-resolution streams do not oversubscribe CPU.
+     */
+    ST_LOCAL int getNbDecodeThreads() const;
+
     /**
      * Select frame format from the list.
      */
@@ -346,12 +371,39 @@ private:
      */
     ST_LOCAL void prepareFrame(const StFormat theSrcFormat);
 
-    ST_LOCAL void pushFrame(const StImage&     theSrcDataLeft,
+    /**
+     * Apply decoding quality level chosen by controller to this (master) and slave decoders.
+     */
+    ST_LOCAL void applyQuality();
+
+    /**
+     * Schedule switching of low resolution factor (master stream).
+     * The switch is done by master and slave on the same key frame,
+     * so that views within a pair never have different sizes.
+     * @param thePktPts      PTS of the key frame to be decoded
+     * @param theFrameDurSec frame duration
+     */
+    ST_LOCAL void scheduleLowRes(const double thePktPts,
+                                 const double theFrameDurSec);
+
+    /**
+     * Re-open the codec when scheduled low resolution factor differs from the current one.
+     * Should be called before decoding a key frame.
+     */
+    ST_LOCAL void updateLowRes();
+
+    /**
+     * Push decoded frame into textures queue.
+     * @param theIsRightRepeated right view has been already pushed within previous frame
+     * @return false if frame has been skipped due to flushing
+     */
+    ST_LOCAL bool pushFrame(const StImage&     theSrcDataLeft,
                             const StImage&     theSrcDataRight,
                             const StHandle<StStereoParams>& theStParams,
                             const StFormat     theSrcFormat,
                             const StCubemap    theCubemapFormat,
-                            const double       theSrcPTS);
+                            const double       theSrcPTS,
+                            const bool         theIsRightRepeated = false);
 
         private:
 
@@ -359,7 +411,8 @@ private:
     StCondition                myDowntimeState;   //!< event to indicate downtime state
     StHandle<StGLTextureQueue> myTextureQueue;    //!< decoded frames queue
 
-    StCondition                myHasDataState;
+    StCondition                myHasDataState;    //!< event signaling that slave frame is ready for master
+    StCondition                myNoDataState;     //!< event signaling that master has taken the slave frame
     StHandle<StVideoQueue>     myMaster;          //!< handle to Master decoding thread
     StHandle<StVideoQueue>     mySlave;           //!< handle to Slave  decoding thread
 
@@ -381,7 +434,13 @@ private:
     StAVFrame                  myFrame;           //!< original decoded video frame
     StHandle<StAVFrameCounter> myFrameBufRef;
     StImage                    myDataAdp;         //!< buffer data adaptor
-    AVDiscard                  myAvDiscard;       //!< discard parameter (to skip or not frames)
+    StVideoQualityControl      myQualityCtrl;     //!< decoding quality controller (master stream)
+    volatile int               myLowResTarget;    //!< requested low resolution factor (master stream)
+    volatile int               myLowResNext;      //!< low resolution factor scheduled for switching
+    volatile double            myLowResSwitchPts; //!< key frames starting from this PTS are decoded with myLowResNext factor
+    volatile bool              myIsHalfRate;      //!< decode only every second frame (slave stream)
+    volatile bool              myIsQualityExhausted; //!< flag indicating that all degradation steps are in use
+    volatile float             myDecodeSecLast;   //!< decoding time of the last frame in seconds
 
     double                     myFramePts;
     GLfloat                    myPixelRatio;      //!< pixel aspect ratio
@@ -111,6 +111,7 @@ void StVideoTimer::mainLoop() {
                 StThread::sleep(1);
             }
 
+            myVideo->getTextureQueue()->changeStatistics().setDecoderQueue(myVideo->getSize());
             myDelayVV = getDelayMsec(myVideoPtsNextSec, myVideoPtsCurrSec);
             if(myDelayVV > 0.0 && myDelayVV < 201.0) {
                 myInfoLock.lock();
@@ -126,6 +127,7 @@ void StVideoTimer::mainLoop() {
                         myVideo->setAClock(myAudioPtsCurrSec);
                         myDiffVA = getDelayMsec(myVideoPtsNextSec, myAudioPtsCurrSec);
                         myDelayTimer = myDiffVA - double(myDelayVAFixed);
+                        myVideo->getTextureQueue()->changeStatistics().setSyncDiff(myDiffVA);
                     }
                 } else if(myVideoPtsCurrSec < 0.0) {
                     // empty video queue or first frame
@@ -138,8 +140,10 @@ void StVideoTimer::mainLoop() {
                 // fix values out from range
                 if(mySpeedSlow * myDelayTimer > myDelayVVAver) {
                     myDelayTimer = mySpeedSlowRev * myDelayVVAver;
-                } else if(mySpeedFastSkip * myDelayTimer < myDelayVVAver) {
-                    //myVideo->getTextureQueue()->drop(2);
+                } else if(mySpeedFastSkip * myDelayTimer < myDelayVVAver
+                       && myVideo->isQualityExhausted()) {
+                    // dropping already decoded frames is the last resort,
+                    // decoding quality is reduced by video queue first
                     myVideo->getTextureQueue()->drop(1);
                     myDelayTimer = mySpeedFastRev * myDelayVVAver;
                 } else if(mySpeedFast * myDelayTimer < myDelayVVAver) {
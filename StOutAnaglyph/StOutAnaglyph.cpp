@@ -53,6 +53,7 @@ namespace {
         STTR_ANAGLYPH_AMBERBLUE_MENU   = 1103,
         STTR_ANAGLYPH_AMBERBLUE_SIMPLE = 1130,
         STTR_ANAGLYPH_AMBERBLUE_DUBIOS = 1131,
+        STTR_ANAGLYPH_DIRECT           = 1104,
 
         // about info
         STTR_PLUGIN_TITLE       = 2000,
@@ -86,6 +87,7 @@ void StOutAnaglyph::getOptions(StParamsList& theList) const {
     theList.add(params.Glasses);
     theList.add(params.RedCyan);
     theList.add(params.AmberBlue);
+    theList.add(params.ToDirect);
 }
 
 void StOutAnaglyph::updateStrings() {
@@ -109,6 +111,8 @@ void StOutAnaglyph::updateStrings() {
     params.AmberBlue->defineOption(AMBERBLUE_MODE_SIMPLE, aLangMap.changeValueId(STTR_ANAGLYPH_AMBERBLUE_SIMPLE, "Simple"));
     params.AmberBlue->defineOption(AMBERBLUE_MODE_DUBOIS, aLangMap.changeValueId(STTR_ANAGLYPH_AMBERBLUE_DUBIOS, "Dubios"));
 
+    params.ToDirect->setName(aLangMap.changeValueId(STTR_ANAGLYPH_DIRECT, "Direct rendering (simple filters)"));
+
     // about string
     StString& aTitle     = aLangMap.changeValueId(STTR_PLUGIN_TITLE,   "sView - Anaglyph Output module");
     StString& aVerString = aLangMap.changeValueId(STTR_VERSION_STRING, "version");
@@ -131,6 +135,7 @@ StOutAnaglyph::StOutAnaglyph(const StHandle<StResourceManager>& theResMgr,
   myYellowAnaglyph("Anaglyph Yellow"),
   myYellowDubiosAnaglyph("Anaglyph Yellow Dubios"),
   myGreenAnaglyph("Anaglyph Green"),
+  myHasMask(false),
   myToCompressMem(myInstancesNb.increment() > 1),
   myIsBroken(false) {
     myStereoProgram = &mySimpleAnaglyph;
@@ -155,6 +160,9 @@ StOutAnaglyph::StOutAnaglyph(const StHandle<StResourceManager>& theResMgr,
     params.AmberBlue = new StEnumParam(AMBERBLUE_MODE_SIMPLE, stCString("optionAmberBlue"), stCString("optionAmberBlue"));
     params.AmberBlue->signals.onChanged.connect(this, &StOutAnaglyph::doSetShader);
 
+    // draw simple filters without intermediate buffers
+    params.ToDirect = new StBoolParamNamed(true, stCString("directRender"), stCString("directRender"));
+
     // load window position
     if(isMovable()) {
         StRect<int32_t> aRect;
@@ -170,6 +178,8 @@ StOutAnaglyph::StOutAnaglyph(const StHandle<StResourceManager>& theResMgr,
     mySettings->loadParam(params.Glasses);
     mySettings->loadParam(params.RedCyan);
     mySettings->loadParam(params.AmberBlue);
+    mySettings->loadParam(params.ToDirect);
+    doSetShader(0);
 }
 
 void StOutAnaglyph::releaseResources() {
@@ -200,6 +210,7 @@ void StOutAnaglyph::beforeClose() {
     mySettings->saveParam(params.Glasses);
     mySettings->saveParam(params.RedCyan);
     mySettings->saveParam(params.AmberBlue);
+    mySettings->saveParam(params.ToDirect);
     mySettings->flush();
 }
 
@@ -335,6 +346,17 @@ void StOutAnaglyph::stglDraw() {
         return;
     }
 
+    if(myHasMask && params.ToDirect->getValue()) {
+        // simple filters just drop color channels - no need in intermediate buffers
+        myFrBuffer->release(*myContext);
+        stglDrawDirect(aVPort);
+
+        myFPSControl.sleepToTarget(); // decrease FPS to target by thread sleeps
+        StWindow::stglSwap(ST_WIN_MASTER);
+        ++myFPSControl;
+        return;
+    }
+
     // resize FBO
     if(!myFrBuffer->initLazy(*myContext, aVPort.width(), aVPort.height(), StWindow::hasDepthBuffer())) {
         myMsgQueue->pushError(stCString("Anaglyph output - critical error:\nFrame Buffer Object resize failed!"));
@@ -366,6 +388,19 @@ void StOutAnaglyph::stglDraw() {
     ++myFPSControl;
 }
 
+void StOutAnaglyph::stglDrawDirect(const StGLBoxPx& theVPort) {
+    myContext->stglResizeViewport(theVPort);
+    myContext->core20fwd->glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    myContext->core20fwd->glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    // glClear() respects color write mask, so that each view clears only own channels
+    myContext->core20fwd->glColorMask(myMaskLeft[0], myMaskLeft[1], myMaskLeft[2], GL_FALSE);
+        StWindow::signals.onRedraw(ST_DRAW_LEFT);
+    myContext->core20fwd->glColorMask(myMaskRight[0], myMaskRight[1], myMaskRight[2], GL_FALSE);
+        StWindow::signals.onRedraw(ST_DRAW_RIGHT);
+    myContext->core20fwd->glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+}
+
 void StOutAnaglyph::doSetShader(const int32_t ) {
     switch(params.Glasses->getValue()) {
         case GLASSES_TYPE_REDCYAN: {
@@ -388,6 +423,21 @@ void StOutAnaglyph::doSetShader(const int32_t ) {
         }
         case GLASSES_TYPE_GREEN: myStereoProgram = &myGreenAnaglyph; break;
     }
+
+    // define color write masks equivalent to simple filters
+    myHasMask = true;
+    if(myStereoProgram == &mySimpleAnaglyph) {
+        myMaskLeft [0] = GL_TRUE;  myMaskLeft [1] = GL_FALSE; myMaskLeft [2] = GL_FALSE;
+        myMaskRight[0] = GL_FALSE; myMaskRight[1] = GL_TRUE;  myMaskRight[2] = GL_TRUE;
+    } else if(myStereoProgram == &myYellowAnaglyph) {
+        myMaskLeft [0] = GL_TRUE;  myMaskLeft [1] = GL_TRUE;  myMaskLeft [2] = GL_FALSE;
+        myMaskRight[0] = GL_FALSE; myMaskRight[1] = GL_FALSE; myMaskRight[2] = GL_TRUE;
+    } else if(myStereoProgram == &myGreenAnaglyph) {
+        myMaskLeft [0] = GL_FALSE; myMaskLeft [1] = GL_TRUE;  myMaskLeft [2] = GL_FALSE;
+        myMaskRight[0] = GL_TRUE;  myMaskRight[1] = GL_FALSE; myMaskRight[2] = GL_TRUE;
+    } else {
+        myHasMask = false;
+    }
 }
 
 void StOutAnaglyph::doSwitchVSync(const int32_t theValue) {
@@ -130,6 +130,12 @@ class StOutAnaglyph : public StWindow {
      */
     ST_LOCAL void doSwitchVSync(const int32_t theValue);
 
+    /**
+     * Draw left and right views directly into the window buffer using color write masks.
+     * Only applicable to simple filters which just drop color channels.
+     */
+    ST_LOCAL void stglDrawDirect(const StGLBoxPx& theVPort);
+
     /**
      * Release GL resources before window closing.
      */
@@ -148,9 +154,10 @@ class StOutAnaglyph : public StWindow {
 
     struct {
 
-        StHandle<StEnumParam> Glasses;   //!< glasses type
-        StHandle<StEnumParam> RedCyan;   //!< Red-Cyan   filter
-        StHandle<StEnumParam> AmberBlue; //!< Amber-Blue filter
+        StHandle<StEnumParam>      Glasses;   //!< glasses type
+        StHandle<StEnumParam>      RedCyan;   //!< Red-Cyan   filter
+        StHandle<StEnumParam>      AmberBlue; //!< Amber-Blue filter
+        StHandle<StBoolParamNamed> ToDirect;  //!< draw simple filters directly, without intermediate FBO
 
     } params;
 
@@ -172,6 +179,9 @@ class StOutAnaglyph : public StWindow {
     StStereoProgram_t               myYellowAnaglyph;
     StStereoProgram_t               myYellowDubiosAnaglyph;
     StStereoProgram_t               myGreenAnaglyph;
+    GLboolean                       myMaskLeft [3];         //!< color write mask for left  view (valid when myHasMask is set)
+    GLboolean                       myMaskRight[3];         //!< color write mask for right view (valid when myHasMask is set)
+    bool                            myHasMask;              //!< current program can be replaced by color write masks
 
     StFPSControl                    myFPSControl;
     bool                            myToCompressMem;        //!< reduce memory usage
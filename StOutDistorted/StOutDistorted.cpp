@@ -1202,6 +1202,9 @@ void StOutDistorted::stglDraw() {
 
     const GLfloat aLensDisp = getLensDist() * 0.5f;
 
+    // orientation cached by processEvents() and used by application for rendering this frame
+    const StQuaternion<double> aRenderOrient = StWindow::getDeviceOrientation();
+
     // draw Left View into virtual frame buffer
     myFrBuffer->setupViewPort(*myContext); // we set TEXTURE sizes here
     myFrBuffer->bindBuffer(*myContext);
@@ -1209,6 +1212,34 @@ void StOutDistorted::stglDraw() {
         stglDrawCursor(aCursorPos, ST_DRAW_LEFT);
     myFrBuffer->unbindBuffer(*myContext);
 
+    // late-latch head orientation right before composition
+    // and rotate eye buffers by the head movement made since the frame has been rendered;
+    // both views are composed with the same rotation to keep them consistent.
+    // Eye buffers are reprojected as a whole, so that reprojection is skipped
+    // while head-locked GUI (reported by application via zero FOV) or cursor are drawn on top of the scene
+    const GLfloat  aReprojTanFov = StWindow::getReprojectionFov();
+    const bool     hasCursor     = myDevice != DEVICE_S3DV
+                                && myToShowCursor
+                                && myCursor->isValid();
+    StGLMatrix aReprojMat;
+    if(StWindow::toTrackOrientation()
+    && aReprojTanFov > 0.0f
+    && !hasCursor) {
+        const StQuaternion<double> aLatchOrient = StWindow::latchDeviceOrientation();
+        const StGLMatrix aRenderMat(StGLQuaternion((float )aRenderOrient.x(), (float )aRenderOrient.y(),
+                                                   (float )aRenderOrient.z(), (float )aRenderOrient.w()));
+        const StGLMatrix aLatchMat (StGLQuaternion((float )aLatchOrient.x(),  (float )aLatchOrient.y(),
+                                                   (float )aLatchOrient.z(),  (float )aLatchOrient.w()));
+        StGLMatrix aLatchMatInv;
+        if(aLatchMat.inverted(aLatchMatInv)) {
+            aReprojMat = StGLMatrix::multiply(aRenderMat, aLatchMatInv);
+        }
+    }
+    const GLfloat  aFrAspect = GLfloat(myFrBuffer->getVPSizeX()) / GLfloat(myFrBuffer->getVPSizeY());
+    const GLfloat  aReprojTanFovY = aReprojTanFov > 0.0f ? aReprojTanFov : 1.0f; // any non-zero value for identity matrix
+    const StGLVec2 aReprojFov(aReprojTanFovY * aFrAspect, aReprojTanFovY);
+    const StGLVec2 aReprojSize(aDX, aDY);
+
     // now draw to real screen buffer
     // clear the screen and the depth buffer
     myContext->stglResizeViewport(aVPBoth);
@@ -1228,6 +1259,9 @@ void StOutDistorted::stglDraw() {
         aTexCrdLoc = myProgramBarrel->getVTexCoordLoc();
         myProgramBarrel->setScaleIn(*myContext, StGLVec2(2.0f / aDX, 2.0f / aDY));
         myProgramBarrel->setScale  (*myContext, StGLVec2(0.4f * aDX, 0.4f * aDY));
+        myProgramBarrel->setReprojection(*myContext, aReprojMat, aReprojFov, aReprojSize);
+    } else {
+        myProgramFlat->setReprojection(*myContext, aReprojMat, aReprojFov, aReprojSize);
     }
 
     myFrBuffer->bindTexture(*myContext);
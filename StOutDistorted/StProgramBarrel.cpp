@@ -35,6 +35,21 @@ bool StProgramBarrel::init(StGLContext& theCtx) {
        "uniform vec2 uScale;\n"
        "uniform vec2 uScaleIn;\n"
        "\n"
+       "uniform mat4 uReprojMat;\n"
+       "uniform vec2 uReprojFov;\n"
+       "uniform vec2 uReprojSize;\n"
+       "\n"
+       // rotate the view ray into the orientation used for rendering;
+       // returns coordinates out of [0, 1] range for rays behind the eye
+       "vec2 reproject(in vec2 theTCrds) {\n"
+       "  vec2 aNdc = (theTCrds / uReprojSize) * 2.0 - 1.0;\n"
+       "  vec3 aDir = (uReprojMat * vec4(aNdc * uReprojFov, -1.0, 0.0)).xyz;\n"
+       "  if(aDir.z >= 0.0) {\n"
+       "    return vec2(-1.0, -1.0);\n"
+       "  }\n"
+       "  return (aDir.xy / (-aDir.z * uReprojFov) * 0.5 + 0.5) * uReprojSize;\n"
+       "}\n"
+       "\n"
        "void main(void) {\n"
        "  vec2 aTheta = (fTexCoord - uLensCenter) * uScaleIn;\n" // scales to [-1, 1]
        "  float rSq = aTheta.x * aTheta.x + aTheta.y * aTheta.y;\n"
@@ -42,15 +57,15 @@ bool StProgramBarrel::init(StGLContext& theCtx) {
        "                           uWarpCoef.z * rSq * rSq +\n"
        "                           uWarpCoef.w * rSq * rSq * rSq);\n"
        "  vec2 aThetaBlue = aTheta1 * (uChromAb.z + uChromAb.w * rSq);\n"
-       "  vec2 aTCrdsBlue = uLensCenter + uScale * aThetaBlue;\n"
+       "  vec2 aTCrdsBlue = reproject(uLensCenter + uScale * aThetaBlue);\n"
        "  if(any(bvec2(clamp(aTCrdsBlue, vec2(0.0, 0.0), vec2(1.0, 1.0)) - aTCrdsBlue))) {\n"
        "    gl_FragColor = vec4(0.0, 0.0, 0.0, 1.0);\n"
        "    return;\n"
        "  }\n"
        "\n"
-       "  vec2 aTCrdsGreen = uLensCenter + uScale * aTheta1;\n"
+       "  vec2 aTCrdsGreen = reproject(uLensCenter + uScale * aTheta1);\n"
        "  vec2 aThetaRed = aTheta1 * (uChromAb.x + uChromAb.y * rSq);\n"
-       "  vec2 aTCrdsRed = uLensCenter + uScale * aThetaRed;\n"
+       "  vec2 aTCrdsRed = reproject(uLensCenter + uScale * aThetaRed);\n"
        "  gl_FragColor = vec4(texture2D(texR, aTCrdsRed  ).r,\n"
        "                      texture2D(texR, aTCrdsGreen).g,\n"
        "                      texture2D(texR, aTCrdsBlue ).b, 1.0);\n"
@@ -77,6 +92,10 @@ bool StProgramBarrel::init(StGLContext& theCtx) {
     uniLensCenterLoc = StGLProgram::getUniformLocation(theCtx, "uLensCenter");
     uniScaleLoc      = StGLProgram::getUniformLocation(theCtx, "uScale");
     uniScaleInLoc    = StGLProgram::getUniformLocation(theCtx, "uScaleIn");
+    uniReprojMatLoc  = StGLProgram::getUniformLocation(theCtx, "uReprojMat");
+    uniReprojFovLoc  = StGLProgram::getUniformLocation(theCtx, "uReprojFov");
+    uniReprojSizeLoc = StGLProgram::getUniformLocation(theCtx, "uReprojSize");
+    setReprojection(theCtx, StGLMatrix(), StGLVec2(1.0f, 1.0f), StGLVec2(1.0f, 1.0f));
     return true;
 }
 
@@ -114,3 +133,14 @@ void StProgramBarrel::setScaleIn(StGLContext&    theCtx,
     theCtx.core20fwd->glUniform2fv(uniScaleInLoc, 1, theVec);
     unuse(theCtx);
 }
+
+void StProgramBarrel::setReprojection(StGLContext&      theCtx,
+                                      const StGLMatrix& theRotMat,
+                                      const StGLVec2&   theTanHalfFov,
+                                      const StGLVec2&   theDataSize) {
+    use(theCtx);
+    theCtx.core20fwd->glUniformMatrix4fv(uniReprojMatLoc, 1, GL_FALSE, theRotMat);
+    theCtx.core20fwd->glUniform2fv(uniReprojFovLoc,  1, theTanHalfFov);
+    theCtx.core20fwd->glUniform2fv(uniReprojSizeLoc, 1, theDataSize);
+    unuse(theCtx);
+}
@@ -11,6 +11,7 @@
 #define __StProgramBarrel_h_
 
 #include <StGL/StGLProgram.h>
+#include <StGL/StGLMatrix.h>
 #include <StGL/StGLVec.h>
 
 /**
@@ -61,6 +62,17 @@ class StProgramBarrel : public StGLProgram {
     ST_LOCAL void setScaleIn(StGLContext&    theCtx,
                              const StGLVec2& theVec);
 
+    /**
+     * Setup rotational reprojection of the eye buffer applied after distortion.
+     * @param theRotMat     rotation from the latest head orientation into the orientation used for rendering
+     * @param theTanHalfFov tangents of horizontal and vertical half field of view
+     * @param theDataSize   texture coordinates of the top-right corner of the data within texture
+     */
+    ST_LOCAL void setReprojection(StGLContext&      theCtx,
+                                  const StGLMatrix& theRotMat,
+                                  const StGLVec2&   theTanHalfFov,
+                                  const StGLVec2&   theDataSize);
+
         private:
 
     StGLVarLocation uniChromAbLoc;
@@ -68,6 +80,9 @@ class StProgramBarrel : public StGLProgram {
     StGLVarLocation uniLensCenterLoc;
     StGLVarLocation uniScaleLoc;
     StGLVarLocation uniScaleInLoc;
+    StGLVarLocation uniReprojMatLoc;
+    StGLVarLocation uniReprojFovLoc;
+    StGLVarLocation uniReprojSizeLoc;
 
 };
 
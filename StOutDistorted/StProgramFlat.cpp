@@ -28,8 +28,22 @@ bool StProgramFlat::init(StGLContext& theCtx) {
     const char FRAGMENT_SHADER[] =
        "uniform sampler2D texR, texL;\n"
        "varying vec2 fTexCoord;\n"
+       "\n"
+       "uniform mat4 uReprojMat;\n"
+       "uniform vec2 uReprojFov;\n"
+       "uniform vec2 uReprojSize;\n"
+       "\n"
        "void main(void) {\n"
-       "  gl_FragColor = texture2D(texR, fTexCoord);\n"
+       // rotate the view ray of this pixel into the orientation used for rendering
+       "  vec2 aNdc = (fTexCoord / uReprojSize) * 2.0 - 1.0;\n"
+       "  vec3 aDir = (uReprojMat * vec4(aNdc * uReprojFov, -1.0, 0.0)).xyz;\n"
+       "  vec2 aTCrds = (aDir.xy / (-aDir.z * uReprojFov) * 0.5 + 0.5) * uReprojSize;\n"
+       "  if(aDir.z >= 0.0\n"
+       "  || any(bvec2(clamp(aTCrds, vec2(0.0, 0.0), uReprojSize) - aTCrds))) {\n"
+       "    gl_FragColor = vec4(0.0, 0.0, 0.0, 1.0);\n"
+       "    return;\n"
+       "  }\n"
+       "  gl_FragColor = texture2D(texR, aTCrds);\n"
        "}\n";
 
     StGLVertexShader aVertexShader(StGLProgram::getTitle());
@@ -47,5 +61,21 @@ bool StProgramFlat::init(StGLContext& theCtx) {
        .link(theCtx)) {
         return false;
     }
+
+    uniReprojMatLoc  = StGLProgram::getUniformLocation(theCtx, "uReprojMat");
+    uniReprojFovLoc  = StGLProgram::getUniformLocation(theCtx, "uReprojFov");
+    uniReprojSizeLoc = StGLProgram::getUniformLocation(theCtx, "uReprojSize");
+    setReprojection(theCtx, StGLMatrix(), StGLVec2(1.0f, 1.0f), StGLVec2(1.0f, 1.0f));
     return true;
 }
+
+void StProgramFlat::setReprojection(StGLContext&      theCtx,
+                                    const StGLMatrix& theRotMat,
+                                    const StGLVec2&   theTanHalfFov,
+                                    const StGLVec2&   theDataSize) {
+    use(theCtx);
+    theCtx.core20fwd->glUniformMatrix4fv(uniReprojMatLoc, 1, GL_FALSE, theRotMat);
+    theCtx.core20fwd->glUniform2fv(uniReprojFovLoc,  1, theTanHalfFov);
+    theCtx.core20fwd->glUniform2fv(uniReprojSizeLoc, 1, theDataSize);
+    unuse(theCtx);
+}
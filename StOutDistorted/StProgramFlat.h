@@ -11,6 +11,7 @@
 #define __StProgramFlat_h_
 
 #include <StGL/StGLProgram.h>
+#include <StGL/StGLMatrix.h>
 
 /**
  * Flat GLSL program.
@@ -36,6 +37,23 @@ class StProgramFlat : public StGLProgram {
      */
     ST_LOCAL virtual bool init(StGLContext& theCtx) ST_ATTR_OVERRIDE;
 
+    /**
+     * Setup rotational reprojection of the eye buffer.
+     * @param theRotMat     rotation from the latest head orientation into the orientation used for rendering
+     * @param theTanHalfFov tangents of horizontal and vertical half field of view
+     * @param theDataSize   texture coordinates of the top-right corner of the data within texture
+     */
+    ST_LOCAL void setReprojection(StGLContext&      theCtx,
+                                  const StGLMatrix& theRotMat,
+                                  const StGLVec2&   theTanHalfFov,
+                                  const StGLVec2&   theDataSize);
+
+        private:
+
+    StGLVarLocation uniReprojMatLoc;
+    StGLVarLocation uniReprojFovLoc;
+    StGLVarLocation uniReprojSizeLoc;
+
 };
 
 #endif // __StProgramFlat_h_
@@ -1,5 +1,5 @@
 /**
- * Copyright © 2016 Kirill Gavrilov <kirill@sview.ru>
+ * Copyright © 2016-2017 Kirill Gavrilov <kirill@sview.ru>
  *
  * Distributed under the Boost Software License, Version 1.0.
  * See accompanying file license-boost.txt or copy at
@@ -8,12 +8,35 @@
 
 #include <StAV/StAVIOFileContext.h>
 
+#include <StThreads/StTimer.h>
+
 extern "C" {
     #include <libavutil/error.h>
 };
 
+namespace {
+
+    static const size_t THE_CHUNK_SIZE = 256 * 1024;  //!< maximal size of single read request
+    static const size_t THE_AHEAD_MIN  = 1024 * 1024; //!< initial read-ahead depth after seek
+
+}
+
 StAVIOFileContext::StAVIOFileContext()
-: myFile(NULL) {
+: myFile(NULL),
+  myEventData(false),
+  myEventSpace(false),
+  myRing(NULL),
+  myRingSize(0),
+  myRingHead(0),
+  myRingFill(0),
+  myAheadLimit(THE_AHEAD_MIN),
+  myPosition(0),
+  myFilePos(0),
+  myFileSize(-1),
+  myGeneration(0),
+  myIsEof(false),
+  myIsError(false),
+  myToQuit(false) {
     //
 }
 
@@ -22,10 +45,46 @@ StAVIOFileContext::~StAVIOFileContext() {
 }
 
 void StAVIOFileContext::close() {
+    if(!myThread.isNull()) {
+        myMutex.lock();
+        myToQuit = true;
+        myEventSpace.set();
+        myMutex.unlock();
+        myThread->wait();
+        myThread.nullify();
+    }
+
     if(myFile != NULL) {
         fclose(myFile);
         myFile = NULL;
     }
+
+    stMemFreeAligned(myRing);
+    myRing     = NULL;
+    myRingHead = 0;
+    myRingFill = 0;
+    myToQuit   = false;
+}
+
+void StAVIOFileContext::setReadAhead(const size_t theNbBytes) {
+    myRingSize = theNbBytes;
+}
+
+bool StAVIOFileContext::open(const StString& thePath) {
+    close();
+#ifdef _WIN32
+    StStringUtfWide aPathWide;
+    aPathWide.fromUnicode(thePath);
+    myFile = ::_wfopen(aPathWide.toCString(), L"rb");
+#else
+    myFile =    ::fopen(thePath.toCString(),  "rb");
+#endif
+    if(myFile == NULL) {
+        return false;
+    }
+
+    initFile();
+    return true;
 }
 
 bool StAVIOFileContext::openFromDescriptor(int theFD, const char* theMode) {
@@ -35,7 +94,124 @@ bool StAVIOFileContext::openFromDescriptor(int theFD, const char* theMode) {
 #else
     myFile =  ::fdopen(theFD, theMode);
 #endif
-    return myFile != NULL;
+    if(myFile == NULL) {
+        return false;
+    }
+
+    initFile();
+    return true;
+}
+
+void StAVIOFileContext::initFile() {
+    myFilePos  = tellFile();
+    myFileSize = -1;
+    if(myFilePos >= 0
+    && seekFile(0, SEEK_END)) {
+        myFileSize = tellFile();
+        if(!seekFile(myFilePos, SEEK_SET)) {
+            myFileSize = -1;
+        }
+    }
+    if(myFilePos < 0) {
+        myFilePos = 0;
+    }
+
+    myPosition   = myFilePos;
+    myAheadLimit = THE_AHEAD_MIN;
+    myIsEof      = false;
+    myIsError    = false;
+    myStats      = Statistics();
+    if(myRingSize != 0) {
+        myRing = (uint8_t* )stMemAllocAligned(myRingSize);
+    }
+}
+
+bool StAVIOFileContext::seekFile(int64_t theOffset,
+                                 int     theWhence) {
+#ifdef _WIN32
+    return ::_fseeki64(myFile, theOffset, theWhence) == 0;
+#else
+    return    ::fseeko(myFile, theOffset, theWhence) == 0;
+#endif
+}
+
+int64_t StAVIOFileContext::tellFile() {
+#ifdef _WIN32
+    return ::_ftelli64(myFile);
+#else
+    return ::ftello(myFile);
+#endif
+}
+
+StAVIOFileContext::Statistics StAVIOFileContext::getStatistics() const {
+    myMutex.lock();
+    const Statistics aStats = myStats;
+    myMutex.unlock();
+    return aStats;
+}
+
+SV_THREAD_FUNCTION StAVIOFileContext::readThreadFunction(void* theCtx) {
+    StAVIOFileContext* aCtx = (StAVIOFileContext* )theCtx;
+    aCtx->readLoop();
+    return SV_THREAD_RETURN 0;
+}
+
+void StAVIOFileContext::readLoop() {
+    StTimer aTimer;
+    for(;;) {
+        myMutex.lock();
+        if(myToQuit) {
+            myMutex.unlock();
+            return;
+        }
+
+        const size_t aLimit = stMin(myAheadLimit, myRingSize);
+        if(myIsEof
+        || myIsError
+        || myRingFill >= aLimit) {
+            myEventSpace.reset();
+            myMutex.unlock();
+            myEventSpace.wait();
+            continue;
+        }
+
+        // the reader writes only into the free part of the ring, thus ring itself is not locked
+        const int64_t      aFetchPos = myPosition + int64_t(myRingFill);
+        const size_t       aTail     = (myRingHead + myRingFill) % myRingSize;
+        const size_t       aChunk    = stMin(stMin(aLimit - myRingFill, myRingSize - aTail), THE_CHUNK_SIZE);
+        const unsigned int aGen      = myGeneration;
+        myMutex.unlock();
+
+        aTimer.restart();
+        bool   isOk    = true;
+        size_t aNbRead = 0;
+        if(myFilePos != aFetchPos) {
+            isOk = seekFile(aFetchPos, SEEK_SET);
+            myFilePos = isOk ? aFetchPos : -1;
+        }
+        if(isOk) {
+            aNbRead = ::fread(myRing + aTail, 1, aChunk, myFile);
+            myFilePos += int64_t(aNbRead);
+        }
+        const bool isEof = isOk && aNbRead == 0 && ::feof(myFile) != 0;
+        const double aReadSec = aTimer.getElapsedTimeInSec();
+
+        myMutex.lock();
+        myStats.BytesRead += int64_t(aNbRead);
+        myStats.ReadSec   += aReadSec;
+        if(aGen == myGeneration) {
+            myRingFill += aNbRead;
+            if(aNbRead == 0) {
+                if(isEof) {
+                    myIsEof = true;
+                } else {
+                    myIsError = true;
+                }
+            }
+            myEventData.set();
+        } // otherwise the data has been fetched for discarded position
+        myMutex.unlock();
+    }
 }
 
 int StAVIOFileContext::read(uint8_t* theBuf,
@@ -45,43 +221,118 @@ int StAVIOFileContext::read(uint8_t* theBuf,
         return -1;
     }
 
-    int aNbRead = (int )::fread(theBuf, 1, theBufSize, myFile);
-    if(aNbRead == 0
-    && feof(myFile) != 0) {
-        return AVERROR_EOF;
+    if(myRing == NULL) {
+        int aNbRead = (int )::fread(theBuf, 1, theBufSize, myFile);
+        if(aNbRead == 0
+        && feof(myFile) != 0) {
+            return AVERROR_EOF;
+        }
+        return aNbRead;
+    }
+
+    myMutex.lock();
+    if(myThread.isNull()) {
+        myThread = new StThread(readThreadFunction, this, "StAVIOFile");
+    }
+
+    if(myRingFill == 0
+    && !myIsEof
+    && !myIsError) {
+        StTimer aStallTimer(true);
+        ++myStats.NbStalls;
+        while(myRingFill == 0
+          && !myIsEof
+          && !myIsError) {
+            myEventData.reset();
+            myEventSpace.set();
+            myMutex.unlock();
+            myEventData.wait();
+            myMutex.lock();
+        }
+        myStats.StallSec += aStallTimer.getElapsedTimeInSec();
+    }
+
+    if(myRingFill == 0) {
+        const int aResult = myIsEof ? AVERROR_EOF : -1;
+        myMutex.unlock();
+        return aResult;
+    }
+
+    const size_t aNbCopy  = stMin(myRingFill, size_t(theBufSize));
+    const size_t aNbFirst = stMin(aNbCopy, myRingSize - myRingHead);
+    stMemCpy(theBuf, myRing + myRingHead, aNbFirst);
+    if(aNbCopy > aNbFirst) {
+        stMemCpy(theBuf + aNbFirst, myRing, aNbCopy - aNbFirst);
     }
+    myRingHead  = (myRingHead + aNbCopy) % myRingSize;
+    myRingFill -= aNbCopy;
+    myPosition += int64_t(aNbCopy);
 
-    return aNbRead;
+    // sequential access - read further ahead
+    myAheadLimit = stMin(myAheadLimit + aNbCopy * 2, myRingSize);
+    myEventSpace.set();
+    myMutex.unlock();
+    return int(aNbCopy);
 }
 
 int StAVIOFileContext::write(uint8_t* theBuf,
                              int      theBufSize) {
-    if(myFile == NULL) {
+    if(myFile == NULL
+    || !myThread.isNull()) {
         return -1;
     }
 
     return (int )::fwrite(theBuf, 1, theBufSize, myFile);
 }
 
+int64_t StAVIOFileContext::seekAhead(int64_t theOffset,
+                                     int     theWhence) {
+    myMutex.lock();
+    int64_t aTarget = -1;
+    switch(theWhence) {
+        case SEEK_SET: aTarget = theOffset; break;
+        case SEEK_CUR: aTarget = myPosition + theOffset; break;
+        case SEEK_END: aTarget = myFileSize >= 0 ? myFileSize + theOffset : -1; break;
+    }
+    if(aTarget < 0) {
+        myMutex.unlock();
+        return -1;
+    }
+
+    if(aTarget >= myPosition
+    && aTarget <= myPosition + int64_t(myRingFill)) {
+        // target is already buffered
+        const size_t aSkip = size_t(aTarget - myPosition);
+        myRingHead  = (myRingHead + aSkip) % myRingSize;
+        myRingFill -= aSkip;
+    } else {
+        // discard buffered data and data being fetched right now
+        ++myGeneration;
+        ++myStats.NbDiscarded;
+        myRingHead   = 0;
+        myRingFill   = 0;
+        myAheadLimit = THE_AHEAD_MIN;
+        myIsEof      = false;
+        myIsError    = false;
+    }
+    myPosition = aTarget;
+    myEventSpace.set();
+    myMutex.unlock();
+    return aTarget;
+}
+
 int64_t StAVIOFileContext::seek(int64_t theOffset,
                                 int     theWhence) {
-    if(theWhence == AVSEEK_SIZE
-    || myFile == NULL) {
+    if(myFile == NULL) {
         return -1;
+    } else if(theWhence == AVSEEK_SIZE) {
+        return myFileSize;
+    } else if(myRing != NULL) {
+        return seekAhead(theOffset, theWhence);
     }
 
-#ifdef _WIN32
-    bool isOk = ::_fseeki64(myFile, theOffset, theWhence) == 0;
-#else
-    bool isOk =    ::fseeko(myFile, theOffset, theWhence) == 0;
-#endif
-    if(!isOk) {
+    if(!seekFile(theOffset, theWhence)) {
         return -1;
     }
-
-#ifdef _WIN32
-    return ::_ftelli64(myFile);
-#else
-    return ::ftello(myFile);
-#endif
+    return tellFile();
 }
@@ -46,11 +46,50 @@ int StAVImage::getAVPixelFormat(const StImage& theImage) {
         }
     }
     switch(theImage.getColorModel()) {
+        case StImage::ImgColor_GBR:
+        case StImage::ImgColor_GBRA: {
+            const bool hasAlpha = theImage.getColorModel() == StImage::ImgColor_GBRA;
+            if(aPlane0.getFormat() == StImagePlane::ImgGray) {
+                return hasAlpha ? stAV::PIX_FMT::GBRAP : stAV::PIX_FMT::GBRP;
+            } else if(hasAlpha) {
+                return stAV::PIX_FMT::GBRAP16;
+            }
+            switch(theImage.getColorScale()) {
+                case StImage::ImgScale_Jpeg9:  return stAV::PIX_FMT::GBRP9;
+                case StImage::ImgScale_Jpeg10: return stAV::PIX_FMT::GBRP10;
+                case StImage::ImgScale_Jpeg12: return stAV::PIX_FMT::GBRP12;
+                default:                       return stAV::PIX_FMT::GBRP16;
+            }
+        }
+        case StImage::ImgColor_YUVA: {
+            size_t aDelimX = (theImage.getPlane(1).getSizeX() > 0) ? (aPlane0.getSizeX() / theImage.getPlane(1).getSizeX()) : 1;
+            size_t aDelimY = (theImage.getPlane(1).getSizeY() > 0) ? (aPlane0.getSizeY() / theImage.getPlane(1).getSizeY()) : 1;
+            const bool is10bit = theImage.getColorScale() == StImage::ImgScale_Mpeg10
+                              || theImage.getColorScale() == StImage::ImgScale_Jpeg10;
+            const bool is16bit = aPlane0.getFormat() == StImagePlane::ImgGray16;
+            if(aDelimX == 1 && aDelimY == 1) {
+                return !is16bit ? stAV::PIX_FMT::YUVA444P : (is10bit ? stAV::PIX_FMT::YUVA444P10 : stAV::PIX_FMT::YUVA444P16);
+            } else if(aDelimX == 2 && aDelimY == 2) {
+                return !is16bit ? stAV::PIX_FMT::YUVA420P : (is10bit ? stAV::PIX_FMT::YUVA420P10 : stAV::PIX_FMT::YUVA420P16);
+            } else if(aDelimX == 2 && aDelimY == 1) {
+                return !is16bit ? stAV::PIX_FMT::YUVA422P : (is10bit ? stAV::PIX_FMT::YUVA422P10 : stAV::PIX_FMT::YUVA422P16);
+            }
+            return stAV::PIX_FMT::NONE;
+        }
         case StImage::ImgColor_YUV: {
             size_t aDelimX = (theImage.getPlane(1).getSizeX() > 0) ? (aPlane0.getSizeX() / theImage.getPlane(1).getSizeX()) : 1;
             size_t aDelimY = (theImage.getPlane(1).getSizeY() > 0) ? (aPlane0.getSizeY() / theImage.getPlane(1).getSizeY()) : 1;
             if(theImage.getPlane(1).getFormat() == StImagePlane::ImgUV) {
                 return stAV::PIX_FMT::NV12;
+            } else if(theImage.getPlane(1).getFormat() == StImagePlane::ImgUV16) {
+                // P010 stores significant bits in high bits, so that it can be read as P016
+                return stAV::PIX_FMT::P016;
+            } else if(theImage.getPlane(1).getFormat() == StImagePlane::ImgRGBA) {
+                // packed 4:2:2 wrapped by two planes
+                return theImage.getColorScale() == StImage::ImgScale_UyvyFull
+                    || theImage.getColorScale() == StImage::ImgScale_UyvyMpeg
+                     ? stAV::PIX_FMT::UYVY422
+                     : stAV::PIX_FMT::YUYV422;
             } else if(aDelimX == 1 && aDelimY == 1) {
                 switch(theImage.getColorScale()) {
                     case StImage::ImgScale_Mpeg:
@@ -61,6 +100,8 @@ int StAVImage::getAVPixelFormat(const StImage& theImage) {
                     case StImage::ImgScale_Jpeg9:  return stAV::PIX_FMT::YUV444P9;
                     case StImage::ImgScale_Mpeg10:
                     case StImage::ImgScale_Jpeg10: return stAV::PIX_FMT::YUV444P10;
+                    case StImage::ImgScale_Mpeg12:
+                    case StImage::ImgScale_Jpeg12: return stAV::PIX_FMT::YUV444P12;
                     case StImage::ImgScale_Full:
                     default:
                         return aPlane0.getFormat() == StImagePlane::ImgGray16
@@ -77,6 +118,8 @@ int StAVImage::getAVPixelFormat(const StImage& theImage) {
                     case StImage::ImgScale_Jpeg9:  return stAV::PIX_FMT::YUV420P9;
                     case StImage::ImgScale_Mpeg10:
                     case StImage::ImgScale_Jpeg10: return stAV::PIX_FMT::YUV420P10;
+                    case StImage::ImgScale_Mpeg12:
+                    case StImage::ImgScale_Jpeg12: return stAV::PIX_FMT::YUV420P12;
                     case StImage::ImgScale_Full:
                     default:
                         return aPlane0.getFormat() == StImagePlane::ImgGray16
@@ -93,6 +136,8 @@ int StAVImage::getAVPixelFormat(const StImage& theImage) {
                     case StImage::ImgScale_Jpeg9:  return stAV::PIX_FMT::YUV422P9;
                     case StImage::ImgScale_Mpeg10:
                     case StImage::ImgScale_Jpeg10: return stAV::PIX_FMT::YUV422P10;
+                    case StImage::ImgScale_Mpeg12:
+                    case StImage::ImgScale_Jpeg12: return stAV::PIX_FMT::YUV422P12;
                     case StImage::ImgScale_Full:
                     default:
                         return aPlane0.getFormat() == StImagePlane::ImgGray16
@@ -472,7 +517,7 @@ bool StAVImage::loadExtra(const StString& theFilePath,
             aDimsYUV.isFullScale = true;
         }
     #endif
-        setColorModel(StImage::ImgColor_YUV);
+        setColorModel(aDimsYUV.hasAlpha ? StImage::ImgColor_YUVA : StImage::ImgColor_YUV);
         setColorScale(aDimsYUV.isFullScale ? StImage::ImgScale_Full : StImage::ImgScale_Mpeg);
         StImagePlane::ImgFormat aPlaneFrmt = StImagePlane::ImgGray;
         if(aDimsYUV.bitsPerComp == 9) {
@@ -481,6 +526,9 @@ bool StAVImage::loadExtra(const StString& theFilePath,
         } else if(aDimsYUV.bitsPerComp == 10) {
             aPlaneFrmt = StImagePlane::ImgGray16;
             setColorScale(aDimsYUV.isFullScale ? StImage::ImgScale_Jpeg10 : StImage::ImgScale_Mpeg10);
+        } else if(aDimsYUV.bitsPerComp == 12) {
+            aPlaneFrmt = StImagePlane::ImgGray16;
+            setColorScale(aDimsYUV.isFullScale ? StImage::ImgScale_Jpeg12 : StImage::ImgScale_Mpeg12);
         } else if(aDimsYUV.bitsPerComp == 16) {
             aPlaneFrmt = StImagePlane::ImgGray16;
         }
@@ -491,6 +539,10 @@ bool StAVImage::loadExtra(const StString& theFilePath,
                                    size_t(aDimsYUV.widthU), size_t(aDimsYUV.heightU), myFrame.getLineSize(1));
         changePlane(2).initWrapper(aPlaneFrmt, myFrame.getPlane(2),
                                    size_t(aDimsYUV.widthV), size_t(aDimsYUV.heightV), myFrame.getLineSize(2));
+        if(aDimsYUV.hasAlpha) {
+            changePlane(3).initWrapper(aPlaneFrmt, myFrame.getPlane(3),
+                                       size_t(aDimsYUV.widthY), size_t(aDimsYUV.heightY), myFrame.getLineSize(3));
+        }
     } else {
         ///ST_DEBUG_LOG("StAVImage, perform conversion from Pixel format '" + avcodec_get_pix_fmt_name(myCodecCtx->pix_fmt) + "' to RGB");
         // initialize software scaler/converter
@@ -100,6 +100,16 @@ void StAVPacket::setAVpkt(const AVPacket& theCopy) {
         return;
     }
 
+#if(LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(57, 12, 100))
+    if(theCopy.buf != NULL) {
+        // share reference-counted payload
+        if(av_packet_ref(&myPacket, &theCopy) == 0) {
+            return;
+        }
+        avInitPacket();
+    }
+#endif
+
     // copy values
     myIsOwn  = true;
     myPacket = theCopy;
@@ -128,3 +138,29 @@ void StAVPacket::setAVpkt(const AVPacket& theCopy) {
     }
 #endif
 }
+
+void StAVPacket::moveFrom(StAVPacket& theSource) {
+    free();
+    myStParams    = theSource.myStParams;
+    myDurationSec = theSource.myDurationSec;
+    myType        = theSource.myType;
+    if(theSource.myIsOwn) {
+        // take ownership over own allocated data
+        myPacket = theSource.myPacket;
+        myIsOwn  = true;
+        theSource.myIsOwn = false;
+        theSource.avInitPacket();
+        return;
+    }
+
+#if(LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(57, 12, 100))
+    if(theSource.myPacket.buf != NULL) {
+        av_packet_move_ref(&myPacket, &theSource.myPacket);
+        return;
+    }
+#endif
+
+    // data is owned by demuxer
+    setAVpkt(theSource.myPacket);
+    theSource.free();
+}
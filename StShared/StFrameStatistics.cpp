@@ -0,0 +1,188 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file license-boost.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+
+#include <StThreads/StFrameStatistics.h>
+
+namespace {
+
+    /**
+     * Upper limits of histogram bins in milliseconds (240, 120, 60, 40, 30, 24 and 20 FPS).
+     */
+    static const double THE_BIN_LIMITS_MS[StFrameStatistics::NB_BINS - 1] = {
+        4.2, 8.4, 16.7, 25.0, 33.4, 41.7, 50.0
+    };
+
+    /**
+     * Frames displayed later than this fraction of expected interval are considered as vsync misses.
+     */
+    static const double THE_VSYNC_MISS_RATIO = 1.5;
+
+    /**
+     * Longer intervals between frames are considered as pause.
+     */
+    static const double THE_PAUSE_MS = 1000.0;
+
+    /**
+     * Format milliseconds value with fixed precision independently from C locale.
+     */
+    inline StString formatMs(const double theMs) {
+        const long long aValue = (long long )(theMs * 100.0 + (theMs >= 0.0 ? 0.5 : -0.5));
+        const long long anAbs  = aValue >= 0 ? aValue : -aValue;
+        char aBuffer[64];
+        stsprintf(aBuffer, sizeof(aBuffer), "%s%lld.%02d",
+                  aValue < 0 ? "-" : "", anAbs / 100, int(anAbs % 100));
+        return StString(aBuffer);
+    }
+
+    /**
+     * Format histogram as JSON object.
+     */
+    inline StString formatHistogram(const StFrameStatistics::Histogram& theHist) {
+        StString aBins;
+        for(int aBinIter = 0; aBinIter < StFrameStatistics::NB_BINS; ++aBinIter) {
+            if(aBinIter != 0) {
+                aBins += ",";
+            }
+            aBins += theHist.Bins[aBinIter];
+        }
+        return StString("{\"count\":") + theHist.Count
+             + ",\"avg_ms\":" + formatMs(theHist.getAverageMs())
+             + ",\"max_ms\":" + formatMs(theHist.MaxMs)
+             + ",\"bins\":[" + aBins + "]}";
+    }
+
+}
+
+double StFrameStatistics::getBinLimitMs(const int theBin) {
+    return theBin >= 0 && theBin < NB_BINS - 1
+         ? THE_BIN_LIMITS_MS[theBin]
+         : 1.0e100;
+}
+
+void StFrameStatistics::Histogram::reset() {
+    for(int aBinIter = 0; aBinIter < NB_BINS; ++aBinIter) {
+        Bins[aBinIter] = 0;
+    }
+    Count = 0;
+    SumMs = 0.0;
+    MaxMs = 0.0;
+}
+
+void StFrameStatistics::Histogram::add(const double theMs) {
+    int aBin = 0;
+    for(; aBin < NB_BINS - 1 && theMs > THE_BIN_LIMITS_MS[aBin]; ++aBin) {}
+    ++Bins[aBin];
+    ++Count;
+    SumMs += theMs;
+    MaxMs  = stMax(MaxMs, theMs);
+}
+
+StFrameStatistics::StFrameStatistics()
+: myRenderMs(0.0) {
+    //
+}
+
+void StFrameStatistics::reset() {
+    myMutex.lock();
+    myStats = Snapshot();
+    myFrameTimer.stop();
+    myRenderMs = 0.0;
+    myMutex.unlock();
+}
+
+void StFrameStatistics::nextFrame(const double theTargetFps) {
+    myMutex.lock();
+    const double aFrameMs = myFrameTimer.getElapsedTimeInMilliSec();
+    if(myFrameTimer.isOn()
+    && aFrameMs < THE_PAUSE_MS) {
+        myStats.Frame .add(aFrameMs);
+        myStats.Render.add(myRenderMs);
+        myStats.Swap  .add(stMax(aFrameMs - myRenderMs, 0.0));
+        if(theTargetFps > 0.0
+        && aFrameMs > THE_VSYNC_MISS_RATIO * 1000.0 / theTargetFps) {
+            ++myStats.NbVsyncMisses;
+        }
+    }
+    myStats.TargetFps = theTargetFps;
+    myFrameTimer.restart();
+    myRenderMs = 0.0;
+    myMutex.unlock();
+}
+
+void StFrameStatistics::addRenderTime(const double theMs) {
+    myMutex.lock();
+    myRenderMs += theMs;
+    myMutex.unlock();
+}
+
+void StFrameStatistics::addUploadTime(const double theMs) {
+    myMutex.lock();
+    myStats.Upload.add(theMs);
+    myMutex.unlock();
+}
+
+void StFrameStatistics::addDecodeTime(const int    theStream,
+                                      const double theMs) {
+    if(theStream < 0 || theStream > 1) {
+        return;
+    }
+
+    myMutex.lock();
+    myStats.Decode[theStream].add(theMs);
+    myMutex.unlock();
+}
+
+void StFrameStatistics::addDropped(const size_t theNbFrames) {
+    myMutex.lock();
+    myStats.NbDropped += theNbFrames;
+    myMutex.unlock();
+}
+
+void StFrameStatistics::setSyncDiff(const double theDiffMs) {
+    myMutex.lock();
+    myStats.DiffVAMs    = theDiffMs;
+    myStats.DiffVAMaxMs = stMax(myStats.DiffVAMaxMs, std::abs(theDiffMs));
+    myMutex.unlock();
+}
+
+void StFrameStatistics::setDecoderQueue(const size_t theNbPackets) {
+    myMutex.lock();
+    myStats.DecoderQueue = theNbPackets;
+    myMutex.unlock();
+}
+
+StFrameStatistics::Snapshot StFrameStatistics::getSnapshot() const {
+    myMutex.lock();
+    const Snapshot aStats = myStats;
+    myMutex.unlock();
+    return aStats;
+}
+
+StString StFrameStatistics::formatJson(const Snapshot& theStats) {
+    StString aLimits;
+    for(int aBinIter = 0; aBinIter < NB_BINS - 1; ++aBinIter) {
+        if(aBinIter != 0) {
+            aLimits += ",";
+        }
+        aLimits += formatMs(THE_BIN_LIMITS_MS[aBinIter]);
+    }
+
+    return StString("{\"target_fps\":") + formatMs(theStats.TargetFps)
+         + ",\"bin_limits_ms\":[" + aLimits + "]"
+         + ",\"frame\":"  + formatHistogram(theStats.Frame)
+         + ",\"render\":" + formatHistogram(theStats.Render)
+         + ",\"swap\":"   + formatHistogram(theStats.Swap)
+         + ",\"upload\":" + formatHistogram(theStats.Upload)
+         + ",\"decode\":[" + formatHistogram(theStats.Decode[0]) + "," + formatHistogram(theStats.Decode[1]) + "]"
+         + ",\"vsync_misses\":"   + theStats.NbVsyncMisses
+         + ",\"dropped\":"        + theStats.NbDropped
+         + ",\"av_diff_ms\":"     + formatMs(theStats.DiffVAMs)
+         + ",\"av_diff_max_ms\":" + formatMs(theStats.DiffVAMaxMs)
+         + ",\"decoder_queue\":"  + theStats.DecoderQueue
+         + "}";
+}
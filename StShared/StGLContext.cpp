@@ -57,11 +57,15 @@ StGLContext::StGLContext(const StHandle<StResourceManager>& theResMgr)
   hasHighp(false),
   hasTexRGBA8(false),
   extTexBGRA8(false),
+  hasTexHalfFloat(false),
+  hasTexRGB10A2(false),
 #else
   hasUnpack(true),
   hasHighp(true),
   hasTexRGBA8(true), // always available on desktop
   extTexBGRA8(true),
+  hasTexHalfFloat(false),
+  hasTexRGB10A2(true),
 #endif
   extAll(NULL),
   extSwapTear(false),
@@ -110,11 +114,15 @@ StGLContext::StGLContext(const bool theToInitialize)
   hasHighp(false),
   hasTexRGBA8(false),
   extTexBGRA8(false),
+  hasTexHalfFloat(false),
+  hasTexRGB10A2(false),
 #else
   hasUnpack(true), // always available on desktop
   hasHighp(true),
   hasTexRGBA8(true),
   extTexBGRA8(true),
+  hasTexHalfFloat(false),
+  hasTexRGB10A2(true),
 #endif
   extAll(NULL),
   extSwapTear(false),
@@ -759,6 +767,8 @@ bool StGLContext::stglInit() {
     const bool hasFBO = isGlGreaterEqual(2, 0)
                      || stglCheckExtension("GL_OES_framebuffer_object");
     hasUnpack = isGlGreaterEqual(3, 0);
+    hasTexHalfFloat = isGlGreaterEqual(3, 0);
+    hasTexRGB10A2   = isGlGreaterEqual(3, 0);
 
     if(isGlGreaterEqual(2, 0)) {
         // enable compatible functions
@@ -803,6 +813,8 @@ bool StGLContext::stglInit() {
     extTexBGRA8 = true;
     arbNPTW     = stglCheckExtension("GL_ARB_texture_non_power_of_two");
     arbTexRG    = stglCheckExtension("GL_ARB_texture_rg");
+    hasTexHalfFloat = stglCheckExtension("GL_ARB_half_float_pixel")
+                   && stglCheckExtension("GL_ARB_texture_float");
 
     // load OpenGL 1.2 new functions
     has12 = isGlGreaterEqual(1, 2)
@@ -1117,6 +1129,7 @@ bool StGLContext::stglInit() {
         // but doesn't hardware accellerated by some ancient OpenGL 2.1 hardware (GeForce FX, RadeOn 9700 etc.)
         arbNPTW  = true;
         arbTexRG = true;
+        hasTexHalfFloat = true;
     }
 
     // load OpenGL 3.1 new functions
@@ -13,6 +13,8 @@
 
 #include <stAssert.h>
 
+#include <vector>
+
 StGLMeshProgram::StGLMeshProgram(const StString& theTitle)
 : StGLProgram(theTitle) {
     //
@@ -223,54 +225,210 @@ void StGLMesh::clearVRAM(StGLContext& theCtx) {
     myIndexBuf.release(theCtx);
 }
 
-bool StGLMesh::computeNormals(size_t theDelta) {
-    ST_ASSERT(theDelta > 0, "StGLMesh::computeNormals() - wrong delta");
-    myNormals.initArray(myVertices.size());
-    if(myVertices.isEmpty()) {
-        return false;
-    }
+namespace {
+
+    /**
+     * Meshes with smaller number of vertices are processed within single thread.
+     */
+    static const size_t THE_PARALLEL_NORMALS_MIN_VERTICES = 65536;
+
+    /**
+     * Job computing normals for the range of vertices.
+     * Triangles are distributed among vertex ranges in advance (triangle sharing vertices of several ranges
+     * is listed in each of them), so that every chunk reads only its own triangles,
+     * accumulates the normals of its own vertices without synchronization
+     * and keeps the same summation order as in serial loop.
+     */
+    class StNormalsJob : public StThreadPool::Job {
+
+            public:
 
-    // iterate over each triangle
-    // for each node we compute summary of normals for all triangles where this node used
-    // normals are NOT normalized per triangle - this allows to interpolate result normal
-    // with respect to each triangle dimensions
-    GLuint aV1, aV2, aV3;
-    StGLVec3 aNorm;
-    if(myIndices.size() >= 3) {
-        size_t aLimit = myIndices.size() - 3;
-        for(size_t anIndexId = 0; anIndexId <= aLimit; anIndexId += theDelta) {
-            aV1 = myIndices[anIndexId];
-            aV2 = myIndices[anIndexId + 1];
-            aV3 = myIndices[anIndexId + 2];
-            const StGLVec3& aVert1 = myVertices[aV1];
-            const StGLVec3& aVert2 = myVertices[aV2];
-            const StGLVec3& aVert3 = myVertices[aV3];
-            aNorm = StGLVec3::cross(aVert2 - aVert1, aVert3 - aVert1);
-            myNormals.changeValue(aV1) += aNorm;
-            myNormals.changeValue(aV2) += aNorm;
-            myNormals.changeValue(aV3) += aNorm;
+        StNormalsJob(StGLVec3*       theNormals,
+                     const StGLVec3* theVertices,
+                     const size_t    theNbVertices,
+                     const GLuint*   theIndices,
+                     const size_t    theNbIndices,
+                     const size_t    theDelta,
+                     const size_t    theNbChunks)
+        : myNormals(theNormals),
+          myVertices(theVertices),
+          myNbVertices(theNbVertices),
+          myIndices(theIndices),
+          myNbIndices(theIndices != NULL ? theNbIndices : theNbVertices),
+          myDelta(theDelta),
+          myChunkSize((theNbVertices + theNbChunks - 1) / theNbChunks) {
+            if(theNbChunks > 1) {
+                distributeTriangles(theNbChunks);
+            }
         }
-    } else if(myVertices.size() >= 3) {
-        size_t aLimit = myVertices.size() - 3;
-        for(size_t aVertId = 0; aVertId <= aLimit; aVertId += theDelta) {
-            aV1 = GLuint(aVertId);
-            aV2 = GLuint(aVertId + 1);
-            aV3 = GLuint(aVertId + 2);
-            const StGLVec3& aVert1 = myVertices[aV1];
-            const StGLVec3& aVert2 = myVertices[aV2];
-            const StGLVec3& aVert3 = myVertices[aV3];
-            aNorm = StGLVec3::cross(aVert2 - aVert1, aVert3 - aVert1);
-            myNormals.changeValue(aV1) += aNorm;
-            myNormals.changeValue(aV2) += aNorm;
-            myNormals.changeValue(aV3) += aNorm;
+
+        virtual void perform(const size_t theChunk,
+                             const size_t ) ST_ATTR_OVERRIDE {
+            const size_t aVertFrom = stMin(myChunkSize *  theChunk,      myNbVertices);
+            const size_t aVertTo   = stMin(myChunkSize * (theChunk + 1), myNbVertices);
+            for(size_t aVertIter = aVertFrom; aVertIter < aVertTo; ++aVertIter) {
+                myNormals[aVertIter] = StGLVec3(0.0f, 0.0f, 0.0f);
+            }
+
+            // iterate over each triangle
+            // for each node we compute summary of normals for all triangles where this node used
+            // normals are NOT normalized per triangle - this allows to interpolate result normal
+            // with respect to each triangle dimensions
+            size_t aV[3];
+            if(myTriStarts.empty()) {
+                const size_t aLimit = myNbIndices - 3;
+                for(size_t anIndexId = 0; anIndexId <= aLimit; anIndexId += myDelta) {
+                    if(!getTriangle(anIndexId, aV)) {
+                        continue;
+                    }
+                    const StGLVec3 aNorm = triangleNormal(aV);
+                    myNormals[aV[0]] += aNorm;
+                    myNormals[aV[1]] += aNorm;
+                    myNormals[aV[2]] += aNorm;
+                }
+            } else {
+                const size_t aNbRange = aVertTo - aVertFrom;
+                for(size_t aTriIter = myTriStarts[theChunk]; aTriIter < myTriStarts[theChunk + 1]; ++aTriIter) {
+                    getTriangle(size_t(myTriList[aTriIter]) * myDelta, aV);
+                    const StGLVec3 aNorm = triangleNormal(aV);
+                    for(int aNodeIter = 0; aNodeIter < 3; ++aNodeIter) {
+                        // unsigned comparison checks both range bounds at once
+                        if((aV[aNodeIter] - aVertFrom) < aNbRange) {
+                            myNormals[aV[aNodeIter]] += aNorm;
+                        }
+                    }
+                }
+            }
+
+            // normalize normals (important for OpenGL)
+            for(size_t aVertIter = aVertFrom; aVertIter < aVertTo; ++aVertIter) {
+                myNormals[aVertIter].normalize();
+            }
         }
-    } else {
+
+            private:
+
+        /**
+         * Fill the lists of triangles (in original order) touching vertices of each chunk.
+         */
+        void distributeTriangles(const size_t theNbChunks) {
+            myTriStarts.assign(theNbChunks + 1, 0);
+            std::vector<size_t> aFillPos;
+            const size_t aLimit = myNbIndices - 3;
+            size_t aV[3], aChunks[3];
+            for(int aPass = 0; aPass < 2; ++aPass) {
+                for(size_t anIndexId = 0, aTriId = 0; anIndexId <= aLimit; anIndexId += myDelta, ++aTriId) {
+                    if(!getTriangle(anIndexId, aV)) {
+                        continue;
+                    }
+                    aChunks[0] = aV[0] / myChunkSize;
+                    aChunks[1] = aV[1] / myChunkSize;
+                    aChunks[2] = aV[2] / myChunkSize;
+                    for(int aNodeIter = 0; aNodeIter < 3; ++aNodeIter) {
+                        const size_t aChunk = aChunks[aNodeIter];
+                        if((aNodeIter > 0 && aChunk == aChunks[0])
+                        || (aNodeIter > 1 && aChunk == aChunks[1])) {
+                            continue;
+                        }
+                        if(aPass == 0) {
+                            ++myTriStarts[aChunk + 1];
+                        } else {
+                            myTriList[aFillPos[aChunk]++] = GLuint(aTriId);
+                        }
+                    }
+                }
+                if(aPass == 0) {
+                    for(size_t aChunkIter = 0; aChunkIter < theNbChunks; ++aChunkIter) {
+                        myTriStarts[aChunkIter + 1] += myTriStarts[aChunkIter];
+                    }
+                    myTriList.resize(myTriStarts[theNbChunks]);
+                    aFillPos.assign(myTriStarts.begin(), myTriStarts.end() - 1);
+                }
+            }
+        }
+
+        /**
+         * Fetch vertex indices of the triangle.
+         * @return FALSE if triangle refers to out of range vertex
+         */
+        bool getTriangle(const size_t theIndexId,
+                         size_t       theV[3]) const {
+            if(myIndices != NULL) {
+                theV[0] = myIndices[theIndexId];
+                theV[1] = myIndices[theIndexId + 1];
+                theV[2] = myIndices[theIndexId + 2];
+            } else {
+                theV[0] = theIndexId;
+                theV[1] = theIndexId + 1;
+                theV[2] = theIndexId + 2;
+            }
+            return theV[0] < myNbVertices
+                && theV[1] < myNbVertices
+                && theV[2] < myNbVertices;
+        }
+
+        /**
+         * Compute not normalized triangle normal.
+         */
+        StGLVec3 triangleNormal(const size_t theV[3]) const {
+            const StGLVec3& aVert1 = myVertices[theV[0]];
+            const StGLVec3& aVert2 = myVertices[theV[1]];
+            const StGLVec3& aVert3 = myVertices[theV[2]];
+            return StGLVec3::cross(aVert2 - aVert1, aVert3 - aVert1);
+        }
+
+            private:
+
+        StGLVec3*           myNormals;
+        const StGLVec3*     myVertices;
+        size_t              myNbVertices;
+        const GLuint*       myIndices;
+        size_t              myNbIndices;
+        size_t              myDelta;
+        size_t              myChunkSize;  //!< number of vertices within one chunk
+        std::vector<size_t> myTriStarts;  //!< offsets of chunk triangles within myTriList
+        std::vector<GLuint> myTriList;    //!< triangle numbers grouped by chunks
+
+    };
+
+}
+
+bool StGLMesh::computeNormals(StGLVec3*       theNormals,
+                              const StGLVec3* theVertices,
+                              const size_t    theNbVertices,
+                              const GLuint*   theIndices,
+                              const size_t    theNbIndices,
+                              const size_t    theDelta,
+                              StThreadPool*   thePool) {
+    ST_ASSERT(theDelta > 0, "StGLMesh::computeNormals() - wrong delta");
+    if(theNbVertices < 3
+    || (theIndices != NULL && theNbIndices < 3)) {
         return false;
     }
 
-    // normalize normals (important for OpenGL)
-    for(size_t aNormId = 0; aNormId < myNormals.size(); ++aNormId) {
-        myNormals.changeValue(aNormId).normalize();
+    const size_t aNbChunks = (thePool != NULL && theNbVertices >= THE_PARALLEL_NORMALS_MIN_VERTICES)
+                           ? thePool->getNbThreads()
+                           : 1;
+    StNormalsJob aJob(theNormals, theVertices, theNbVertices, theIndices, theNbIndices, theDelta, aNbChunks);
+    if(aNbChunks > 1) {
+        thePool->perform(aJob, aNbChunks);
+    } else {
+        aJob.perform(0, 1);
     }
     return true;
 }
+
+bool StGLMesh::computeNormals(size_t theDelta,
+                              const StHandle<StThreadPool>& thePool) {
+    ST_ASSERT(theDelta > 0, "StGLMesh::computeNormals() - wrong delta");
+    myNormals.initArray(myVertices.size());
+    if(myVertices.isEmpty()) {
+        return false;
+    }
+
+    const bool hasIndices = myIndices.size() >= 3;
+    StThreadPool* aPool = !thePool.isNull() ? thePool.operator->() : NULL;
+    return computeNormals(&myNormals.changeValue(0), &myVertices.getValue(0), myVertices.size(),
+                          hasIndices ? &myIndices.getValue(0) : NULL, myIndices.size(),
+                          theDelta, aPool);
+}
@@ -116,9 +116,9 @@ void StGLQuadTexture::setMinMagFilter(StGLContext& theCtx,
     myTextures[BACK_TEXTURE  + RIGHT_TEXTURE].setMinMagFilter(theCtx, theMinMagFilter);
 }
 
-StGLQuadTexture::StGLQuadTexture()
-: myActive(true) {
-    //
+StGLQuadTexture::StGLQuadTexture() {
+    myActive[LEFT_TEXTURE]  = true;
+    myActive[RIGHT_TEXTURE] = true;
 }
 
 StGLQuadTexture::~StGLQuadTexture() {
@@ -38,6 +38,15 @@ bool StGLTexture::getInternalFormat(const StGLContext&  theCtx,
             theInternalFormat = GL_RGB32F;
         #endif
             return true;
+        case StImagePlane::ImgRGBAHalf:
+            theInternalFormat = GL_RGBA16F; // OpenGL 3.0+ or OpenGL ES 3.0+
+            return true;
+        case StImagePlane::ImgRGBHalf:
+            theInternalFormat = GL_RGB16F;  // OpenGL 3.0+ or OpenGL ES 3.0+
+            return true;
+        case StImagePlane::ImgRGB10A2:
+            theInternalFormat = GL_RGB10_A2;
+            return true;
         case StImagePlane::ImgRGBA:
         case StImagePlane::ImgBGRA:
         #if defined(GL_ES_VERSION_2_0)
@@ -125,6 +134,14 @@ bool StGLTexture::getInternalFormat(const StGLContext&  theCtx,
             //theInternalFormat = GL_RG8;   // OpenGL3+ hardware
             theInternalFormat = GL_LUMINANCE_ALPHA;
             return true;
+        case StImagePlane::ImgUV16:
+        #if defined(GL_ES_VERSION_2_0)
+            theInternalFormat = GL_LUMINANCE_ALPHA;
+        #else
+            //theInternalFormat = GL_RG16;            // OpenGL3+ hardware
+            theInternalFormat = GL_LUMINANCE16_ALPHA16; // backward compatibility
+        #endif
+            return true;
         default:
             return false;
     }
@@ -160,6 +177,12 @@ bool StGLTexture::getDataFormat(const StGLContext&  theCtx,
             theDataType = GL_UNSIGNED_BYTE;
             return true;
         }
+        case StImagePlane::ImgUV16: {
+            //thePixelFormat = GL_RG;
+            thePixelFormat = GL_LUMINANCE_ALPHA;
+            theDataType = GL_UNSIGNED_SHORT;
+            return true;
+        }
         case StImagePlane::ImgRGB: {
             thePixelFormat = GL_RGB;
             theDataType = GL_UNSIGNED_BYTE;
@@ -228,6 +251,21 @@ bool StGLTexture::getDataFormat(const StGLContext&  theCtx,
             theDataType = GL_FLOAT;
             return true;
         }
+        case StImagePlane::ImgRGBHalf: {
+            thePixelFormat = GL_RGB;
+            theDataType = GL_HALF_FLOAT;
+            return true;
+        }
+        case StImagePlane::ImgRGBAHalf: {
+            thePixelFormat = GL_RGBA;
+            theDataType = GL_HALF_FLOAT;
+            return true;
+        }
+        case StImagePlane::ImgRGB10A2: {
+            thePixelFormat = GL_RGBA;
+            theDataType = GL_UNSIGNED_INT_2_10_10_10_REV;
+            return true;
+        }
         case StImagePlane::ImgBGRAF: {
         #if defined(GL_ES_VERSION_2_0)
             return false;
@@ -694,6 +732,69 @@ bool StGLTexture::fillPatch(StGLContext&        theCtx,
     return true;
 }
 
+bool StGLTexture::fillSubImage(StGLContext&        theCtx,
+                               const StImagePlane& theData,
+                               GLenum              theTarget,
+                               const GLsizei       theOffsetX,
+                               const GLsizei       theOffsetY) {
+    if(theTarget == 0) {
+        theTarget = myTarget;
+    }
+    if(theData.isNull() || !isValid()) {
+        return false;
+    }
+    GLenum aPixelFormat, aDataType;
+    if(!getDataFormat(theCtx, theData, aPixelFormat, aDataType)) {
+        return false;
+    }
+
+    const GLsizei aSizeX = stMin(GLsizei(theData.getSizeX()), getSizeX() - theOffsetX);
+    const GLsizei aSizeY = stMin(GLsizei(theData.getSizeY()), getSizeY() - theOffsetY);
+    if(aSizeX <= 0 || aSizeY <= 0) {
+        // out of range
+        return false;
+    }
+
+    bind(theCtx);
+    const size_t anAligment = stMin(theData.getMaxRowAligment(), size_t(8)); // limit to 8 bytes for OpenGL
+    theCtx.core20fwd->glPixelStorei(GL_UNPACK_ALIGNMENT, GLint(anAligment));
+
+    const size_t aPixelBytes  = theData.getSizePixelBytes();
+    const size_t aPixelsWidth = theData.getSizeRowBytes() / aPixelBytes;
+    const bool   isPacked     = size_t(aSizeX) == theData.getSizeX()
+                             && getAligned(aPixelBytes * theData.getSizeX(), anAligment) == theData.getSizeRowBytes();
+    if(isPacked
+    || (theCtx.hasUnpack && aPixelsWidth * aPixelBytes == theData.getSizeRowBytes())) {
+        // copy sub-region in single call
+        if(!isPacked) {
+            theCtx.core20fwd->glPixelStorei(GL_UNPACK_ROW_LENGTH, GLint(aPixelsWidth));
+        }
+        theCtx.core20fwd->glTexSubImage2D(theTarget, 0,
+                                          theOffsetX, theOffsetY,
+                                          aSizeX, aSizeY,
+                                          aPixelFormat, aDataType,
+                                          theData.getData());
+        if(!isPacked) {
+            theCtx.core20fwd->glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        }
+    } else {
+        // copy row by row
+        for(GLsizei aRow = 0; aRow < aSizeY; ++aRow) {
+            theCtx.core20fwd->glTexSubImage2D(theTarget, 0,
+                                              theOffsetX, theOffsetY + aRow,
+                                              aSizeX, 1,
+                                              aPixelFormat, aDataType,
+                                              theData.getData(aRow, 0));
+        }
+    }
+
+    // turn back safe alignment...
+    theCtx.core20fwd->glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    unbind(theCtx);
+    return true;
+}
+
 StGLNamedTexture::StGLNamedTexture() {
     //
 }
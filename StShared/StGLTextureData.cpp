@@ -7,10 +7,31 @@
  */
 
 #include <StGLStereo/StGLTextureData.h>
+
+#include <StGL/StGLContext.h>
+#include <StImage/StImageBufferPool.h>
 #include <StStrings/StLogger.h>
+#include <StThreads/StThreadPool.h>
 
 #include <StGLCore/StGLCore11.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define ST_HAVE_SSE_SPLIT
+    #define ST_HAVE_SSE2_SPLIT
+#elif defined(__SSE__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+    #include <xmmintrin.h>
+    #define ST_HAVE_SSE_SPLIT
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+    #include <arm_neon.h>
+    #define ST_HAVE_NEON_SPLIT
+#endif
+
+/**
+ * Frames smaller than this are copied within single thread.
+ */
+static const size_t THE_PARALLEL_COPY_MIN_BYTES = 1024 * 1024;
+
 StGLTextureData::StGLTextureData()
 : myPrev(NULL),
   myNext(NULL),
@@ -21,7 +42,8 @@ StGLTextureData::StGLTextureData()
   mySrcFormat(StFormat_AUTO),
   myCubemapFormat(StCubemap_OFF),
   myFillFromRow(0),
-  myFillRows(0) {
+  myFillRows(0),
+  myIsRightRepeated(false) {
     //
 }
 
@@ -34,7 +56,7 @@ void StGLTextureData::reset() {
     myDataL.nullify();
     myDataR.nullify();
     if(myDataPtr != NULL) {
-        stMemFreeAligned(myDataPtr);
+        StImageBufferPool::GetDefault().release(myDataPtr);
         myDataPtr = NULL;
     }
     myDataSizeBytes = 0;
@@ -49,7 +71,7 @@ bool StGLTextureData::reAllocate(const size_t theSizeBytes) {
     if(myDataSizeBytes != theSizeBytes) {
         reset();
         myDataSizeBytes = theSizeBytes;
-        myDataPtr       = stMemAllocAligned<GLubyte*>(myDataSizeBytes);
+        myDataPtr       = (GLubyte* )StImageBufferPool::GetDefault().allocate(myDataSizeBytes);
 
         // reset the buffer (make black)
         /// this is probably useless and wrong in case of non RGB image data
@@ -60,226 +82,846 @@ bool StGLTextureData::reAllocate(const size_t theSizeBytes) {
     return false;
 }
 
+namespace {
+
+    /**
+     * Split one row of column-interlaced pixels into even and odd columns.
+     */
+    template<size_t thePixelBytes>
+    inline void splitColumnsGeneric(const GLubyte* theSrc,
+                                    GLubyte*       theEven,
+                                    GLubyte*       theOdd,
+                                    const size_t   theNbPixels) {
+        for(size_t aPixel = 0; aPixel < theNbPixels; ++aPixel) {
+            stMemCpy(theEven, theSrc,                 thePixelBytes);
+            stMemCpy(theOdd,  theSrc + thePixelBytes, thePixelBytes);
+            theSrc  += 2 * thePixelBytes;
+            theEven += thePixelBytes;
+            theOdd  += thePixelBytes;
+        }
+    }
+
+    /**
+     * Split 1-byte pixels.
+     */
+    inline void splitColumns8(const GLubyte* theSrc,
+                              GLubyte*       theEven,
+                              GLubyte*       theOdd,
+                              const size_t   theNbPixels) {
+        size_t aPixel = 0;
+    #if defined(ST_HAVE_SSE2_SPLIT)
+        const __m128i aMask = _mm_set1_epi16(0x00FF);
+        for(; aPixel + 16 <= theNbPixels; aPixel += 16) {
+            const __m128i aLo = _mm_loadu_si128((const __m128i* )(theSrc + aPixel * 2));
+            const __m128i aHi = _mm_loadu_si128((const __m128i* )(theSrc + aPixel * 2 + 16));
+            _mm_storeu_si128((__m128i* )(theEven + aPixel),
+                             _mm_packus_epi16(_mm_and_si128(aLo, aMask), _mm_and_si128(aHi, aMask)));
+            _mm_storeu_si128((__m128i* )(theOdd + aPixel),
+                             _mm_packus_epi16(_mm_srli_epi16(aLo, 8), _mm_srli_epi16(aHi, 8)));
+        }
+    #elif defined(ST_HAVE_NEON_SPLIT)
+        for(; aPixel + 16 <= theNbPixels; aPixel += 16) {
+            const uint8x16x2_t aPair = vld2q_u8(theSrc + aPixel * 2);
+            vst1q_u8(theEven + aPixel, aPair.val[0]);
+            vst1q_u8(theOdd  + aPixel, aPair.val[1]);
+        }
+    #endif
+        for(; aPixel < theNbPixels; ++aPixel) {
+            theEven[aPixel] = theSrc[aPixel * 2];
+            theOdd [aPixel] = theSrc[aPixel * 2 + 1];
+        }
+    }
+
+    /**
+     * Split 2-byte pixels.
+     */
+    inline void splitColumns16(const GLubyte* theSrc,
+                               GLubyte*       theEven,
+                               GLubyte*       theOdd,
+                               const size_t   theNbPixels) {
+        size_t aPixel = 0;
+    #if defined(ST_HAVE_SSE2_SPLIT)
+        for(; aPixel + 8 <= theNbPixels; aPixel += 8) {
+            const __m128i aLo = _mm_loadu_si128((const __m128i* )(theSrc + aPixel * 4));
+            const __m128i aHi = _mm_loadu_si128((const __m128i* )(theSrc + aPixel * 4 + 16));
+            // sign extension keeps the bit pattern after signed saturation
+            _mm_storeu_si128((__m128i* )(theEven + aPixel * 2),
+                             _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(aLo, 16), 16),
+                                             _mm_srai_epi32(_mm_slli_epi32(aHi, 16), 16)));
+            _mm_storeu_si128((__m128i* )(theOdd + aPixel * 2),
+                             _mm_packs_epi32(_mm_srai_epi32(aLo, 16), _mm_srai_epi32(aHi, 16)));
+        }
+    #elif defined(ST_HAVE_NEON_SPLIT)
+        for(; aPixel + 8 <= theNbPixels; aPixel += 8) {
+            const uint16x8x2_t aPair = vld2q_u16((const uint16_t* )(theSrc + aPixel * 4));
+            vst1q_u16((uint16_t* )(theEven + aPixel * 2), aPair.val[0]);
+            vst1q_u16((uint16_t* )(theOdd  + aPixel * 2), aPair.val[1]);
+        }
+    #endif
+        splitColumnsGeneric<2>(theSrc + aPixel * 4, theEven + aPixel * 2, theOdd + aPixel * 2, theNbPixels - aPixel);
+    }
+
+    /**
+     * Split 4-byte pixels.
+     */
+    inline void splitColumns32(const GLubyte* theSrc,
+                               GLubyte*       theEven,
+                               GLubyte*       theOdd,
+                               const size_t   theNbPixels) {
+        size_t aPixel = 0;
+    #if defined(ST_HAVE_SSE_SPLIT)
+        for(; aPixel + 4 <= theNbPixels; aPixel += 4) {
+            const __m128 aLo = _mm_loadu_ps((const float* )(theSrc + aPixel * 8));
+            const __m128 aHi = _mm_loadu_ps((const float* )(theSrc + aPixel * 8 + 16));
+            _mm_storeu_ps((float* )(theEven + aPixel * 4), _mm_shuffle_ps(aLo, aHi, _MM_SHUFFLE(2, 0, 2, 0)));
+            _mm_storeu_ps((float* )(theOdd  + aPixel * 4), _mm_shuffle_ps(aLo, aHi, _MM_SHUFFLE(3, 1, 3, 1)));
+        }
+    #elif defined(ST_HAVE_NEON_SPLIT)
+        for(; aPixel + 4 <= theNbPixels; aPixel += 4) {
+            const uint32x4x2_t aPair = vld2q_u32((const uint32_t* )(theSrc + aPixel * 8));
+            vst1q_u32((uint32_t* )(theEven + aPixel * 4), aPair.val[0]);
+            vst1q_u32((uint32_t* )(theOdd  + aPixel * 4), aPair.val[1]);
+        }
+    #endif
+        splitColumnsGeneric<4>(theSrc + aPixel * 8, theEven + aPixel * 4, theOdd + aPixel * 4, theNbPixels - aPixel);
+    }
+
+    /**
+     * Split one row of column-interlaced pixels of arbitrary size.
+     */
+    inline void splitColumns(const GLubyte* theSrc,
+                             GLubyte*       theEven,
+                             GLubyte*       theOdd,
+                             const size_t   theNbPixels,
+                             const size_t   thePixelBytes) {
+        switch(thePixelBytes) {
+            case 1:  splitColumns8 (theSrc, theEven, theOdd, theNbPixels); return;
+            case 2:  splitColumns16(theSrc, theEven, theOdd, theNbPixels); return;
+            case 3:  splitColumnsGeneric<3> (theSrc, theEven, theOdd, theNbPixels); return;
+            case 4:  splitColumns32(theSrc, theEven, theOdd, theNbPixels); return;
+            case 6:  splitColumnsGeneric<6> (theSrc, theEven, theOdd, theNbPixels); return;
+            case 8:  splitColumnsGeneric<8> (theSrc, theEven, theOdd, theNbPixels); return;
+            case 12: splitColumnsGeneric<12>(theSrc, theEven, theOdd, theNbPixels); return;
+            case 16: splitColumnsGeneric<16>(theSrc, theEven, theOdd, theNbPixels); return;
+        }
+        for(size_t aPixel = 0; aPixel < theNbPixels; ++aPixel) {
+            stMemCpy(theEven + aPixel * thePixelBytes, theSrc + (aPixel * 2)     * thePixelBytes, thePixelBytes);
+            stMemCpy(theOdd  + aPixel * thePixelBytes, theSrc + (aPixel * 2 + 1) * thePixelBytes, thePixelBytes);
+        }
+    }
+
+    /**
+     * Convert single float into half-float with rounding
+     * (denormals, infinity and NaN are preserved, overflow is clamped to infinity).
+     */
+    inline uint16_t floatToHalf(const float theValue) {
+        union { float Float; uint32_t Bits; } aValue;
+        aValue.Float = theValue;
+        const uint32_t aSign = aValue.Bits & 0x80000000u;
+        aValue.Bits ^= aSign;
+
+        uint16_t aHalf = 0;
+        if(aValue.Bits >= (255u << 23)) {
+            // Inf or NaN
+            aHalf = (aValue.Bits > (255u << 23)) ? 0x7E00 : 0x7C00;
+        } else {
+            // scale into half-float exponent range, so that FPU handles rounding and denormals
+            union { float Float; uint32_t Bits; } aMagic;
+            aMagic.Bits  = 15u << 23;
+            aValue.Bits &= ~0xFFFu;
+            aValue.Float *= aMagic.Float;
+            aValue.Bits -= ~0xFFFu;
+            if(aValue.Bits > (31u << 23)) {
+                aValue.Bits = 31u << 23;
+            }
+            aHalf = uint16_t(aValue.Bits >> 13);
+        }
+        return uint16_t(aHalf | (aSign >> 16));
+    }
+
+#if defined(ST_HAVE_SSE2_SPLIT)
+    /**
+     * SSE2 version of floatToHalf() for 4 values, results are in lower 16 bits of 32-bit lanes.
+     */
+    inline __m128i floatToHalf4(const __m128 theValues) {
+        const __m128i aMaskRound = _mm_set1_epi32(~0xFFF);
+        const __m128i aF32Infty  = _mm_set1_epi32(255 << 23);
+        const __m128  aSignBits  = _mm_and_ps(theValues, _mm_castsi128_ps(_mm_set1_epi32(0x80000000)));
+        const __m128  anAbs      = _mm_xor_ps(theValues, aSignBits);
+        const __m128i anAbsInt   = _mm_castps_si128(anAbs);
+        const __m128i isNan      = _mm_cmpgt_epi32(anAbsInt, aF32Infty);
+        const __m128i isNormal   = _mm_cmpgt_epi32(aF32Infty, anAbsInt);
+        const __m128i anInfOrNan = _mm_or_si128(_mm_and_si128(isNan, _mm_set1_epi32(0x200)), _mm_set1_epi32(0x7C00));
+
+        const __m128  aRounded = _mm_and_ps(anAbs, _mm_castsi128_ps(aMaskRound));
+        const __m128  aScaled  = _mm_mul_ps(aRounded, _mm_castsi128_ps(_mm_set1_epi32(15 << 23)));
+        const __m128  aClamped = _mm_min_ps(aScaled, _mm_castsi128_ps(_mm_set1_epi32((31 << 23) - 0x1000)));
+        const __m128i aBiased  = _mm_sub_epi32(_mm_castps_si128(aClamped), aMaskRound);
+        const __m128i aNormal  = _mm_and_si128(_mm_srli_epi32(aBiased, 13), isNormal);
+        const __m128i aJoined  = _mm_or_si128(aNormal, _mm_andnot_si128(isNormal, anInfOrNan));
+        return _mm_or_si128(aJoined, _mm_srli_epi32(_mm_castps_si128(aSignBits), 16));
+    }
+#endif
+
+    /**
+     * Convert array of floats into half-floats.
+     */
+    inline void convertFloatToHalf(const float* theSrc,
+                                   uint16_t*    theDst,
+                                   const size_t theNbValues) {
+        size_t aValIter = 0;
+    #if defined(ST_HAVE_SSE2_SPLIT)
+        for(; aValIter + 8 <= theNbValues; aValIter += 8) {
+            const __m128i aLo = floatToHalf4(_mm_loadu_ps(theSrc + aValIter));
+            const __m128i aHi = floatToHalf4(_mm_loadu_ps(theSrc + aValIter + 4));
+            // sign extension keeps the bit pattern after signed saturation
+            _mm_storeu_si128((__m128i* )(theDst + aValIter),
+                             _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(aLo, 16), 16),
+                                             _mm_srai_epi32(_mm_slli_epi32(aHi, 16), 16)));
+        }
+    #elif defined(ST_HAVE_NEON_SPLIT) && defined(__aarch64__)
+        for(; aValIter + 4 <= theNbValues; aValIter += 4) {
+            vst1_u16(theDst + aValIter, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(theSrc + aValIter))));
+        }
+    #endif
+        for(; aValIter < theNbValues; ++aValIter) {
+            theDst[aValIter] = floatToHalf(theSrc[aValIter]);
+        }
+    }
+
+    /**
+     * Move 10-bit samples from low bits into high bits of 16-bit values (P010 layout).
+     */
+    inline void shiftGray10ToHigh(const uint16_t* theSrc,
+                                  uint16_t*       theDst,
+                                  const size_t    theNbValues) {
+        size_t aValIter = 0;
+    #if defined(ST_HAVE_SSE2_SPLIT)
+        for(; aValIter + 8 <= theNbValues; aValIter += 8) {
+            _mm_storeu_si128((__m128i* )(theDst + aValIter),
+                             _mm_slli_epi16(_mm_loadu_si128((const __m128i* )(theSrc + aValIter)), 6));
+        }
+    #elif defined(ST_HAVE_NEON_SPLIT)
+        for(; aValIter + 8 <= theNbValues; aValIter += 8) {
+            vst1q_u16(theDst + aValIter, vshlq_n_u16(vld1q_u16(theSrc + aValIter), 6));
+        }
+    #endif
+        for(; aValIter < theNbValues; ++aValIter) {
+            theDst[aValIter] = uint16_t(theSrc[aValIter] << 6);
+        }
+    }
+
+    /**
+     * Interleave 10-bit U and V samples into UV pairs with samples moved into high bits (P010 layout).
+     */
+    inline void interleaveUV10ToHigh(const uint16_t* theSrcU,
+                                     const uint16_t* theSrcV,
+                                     uint16_t*       theDst,
+                                     const size_t    theNbPixels) {
+        size_t aPixel = 0;
+    #if defined(ST_HAVE_SSE2_SPLIT)
+        for(; aPixel + 8 <= theNbPixels; aPixel += 8) {
+            const __m128i aU = _mm_slli_epi16(_mm_loadu_si128((const __m128i* )(theSrcU + aPixel)), 6);
+            const __m128i aV = _mm_slli_epi16(_mm_loadu_si128((const __m128i* )(theSrcV + aPixel)), 6);
+            _mm_storeu_si128((__m128i* )(theDst + aPixel * 2),     _mm_unpacklo_epi16(aU, aV));
+            _mm_storeu_si128((__m128i* )(theDst + aPixel * 2 + 8), _mm_unpackhi_epi16(aU, aV));
+        }
+    #elif defined(ST_HAVE_NEON_SPLIT)
+        for(; aPixel + 8 <= theNbPixels; aPixel += 8) {
+            uint16x8x2_t aUV;
+            aUV.val[0] = vshlq_n_u16(vld1q_u16(theSrcU + aPixel), 6);
+            aUV.val[1] = vshlq_n_u16(vld1q_u16(theSrcV + aPixel), 6);
+            vst2q_u16(theDst + aPixel * 2, aUV);
+        }
+    #endif
+        for(; aPixel < theNbPixels; ++aPixel) {
+            theDst[aPixel * 2]     = uint16_t(theSrcU[aPixel] << 6);
+            theDst[aPixel * 2 + 1] = uint16_t(theSrcV[aPixel] << 6);
+        }
+    }
+
+    /**
+     * Pack 16-bit RGB pixels into 10-bit RGB with opaque 2-bit alpha
+     * (GL_UNSIGNED_INT_2_10_10_10_REV layout).
+     */
+    inline void packRgb48To10A2(const uint16_t* theSrc,
+                                uint32_t*       theDst,
+                                const size_t    theNbPixels) {
+        for(size_t aPixel = 0; aPixel < theNbPixels; ++aPixel, theSrc += 3) {
+            theDst[aPixel] = (uint32_t(theSrc[0]) >> 6)
+                          | ((uint32_t(theSrc[1]) >> 6) << 10)
+                          | ((uint32_t(theSrc[2]) >> 6) << 20)
+                          | (3u << 30);
+        }
+    }
+
+    /**
+     * Pixel conversion applied while copying the plane.
+     */
+    enum StSplitConvert {
+        StConvert_None,         //!< plain copy
+        StConvert_FloatToHalf,  //!< RGB(A) floats to half-floats
+        StConvert_BgrToRgbHalf, //!< BGR(A) floats to RGB(A) half-floats
+        StConvert_Rgb48To10A2,  //!< 16-bit RGB to packed 10-bit RGB
+        StConvert_Gray10ToHigh, //!< 10-bit samples moved into high bits
+        StConvert_UV10ToHigh,   //!< 10-bit U and V planes interleaved into UV pairs with samples in high bits
+    };
+
+    /**
+     * Copy (and convert) pixels.
+     * @param theConvert   conversion
+     * @param theNbComps   number of components per pixel
+     * @param theDst       destination
+     * @param theSrc       source
+     * @param theSrc2      second source (V plane for StConvert_UV10ToHigh)
+     * @param theNbPixels  number of pixels to copy
+     * @param thePixelBytes destination pixel size
+     */
+    inline void copyPixels(const StSplitConvert theConvert,
+                           const size_t         theNbComps,
+                           GLubyte*             theDst,
+                           const GLubyte*       theSrc,
+                           const GLubyte*       theSrc2,
+                           const size_t         theNbPixels,
+                           const size_t         thePixelBytes) {
+        switch(theConvert) {
+            case StConvert_None: {
+                stMemCpy(theDst, theSrc, theNbPixels * thePixelBytes);
+                return;
+            }
+            case StConvert_FloatToHalf: {
+                convertFloatToHalf((const float* )theSrc, (uint16_t* )theDst, theNbPixels * theNbComps);
+                return;
+            }
+            case StConvert_BgrToRgbHalf: {
+                uint16_t* aDst = (uint16_t* )theDst;
+                convertFloatToHalf((const float* )theSrc, aDst, theNbPixels * theNbComps);
+                for(size_t aPixel = 0; aPixel < theNbPixels; ++aPixel, aDst += theNbComps) {
+                    std::swap(aDst[0], aDst[2]);
+                }
+                return;
+            }
+            case StConvert_Rgb48To10A2: {
+                packRgb48To10A2((const uint16_t* )theSrc, (uint32_t* )theDst, theNbPixels);
+                return;
+            }
+            case StConvert_Gray10ToHigh: {
+                shiftGray10ToHigh((const uint16_t* )theSrc, (uint16_t* )theDst, theNbPixels);
+                return;
+            }
+            case StConvert_UV10ToHigh: {
+                interleaveUV10ToHigh((const uint16_t* )theSrc, (const uint16_t* )theSrc2, (uint16_t* )theDst, theNbPixels);
+                return;
+            }
+        }
+    }
+
+    /**
+     * Stereo layout of the source plane.
+     */
+    enum StSplitLayout {
+        StSplit_Mono,      //!< plain copy
+        StSplit_Parallel,  //!< side-by-side
+        StSplit_OverUnder, //!< top-bottom
+        StSplit_Rows,      //!< row-interlaced
+        StSplit_Columns,   //!< column-interlaced
+        StSplit_Tiled4X,   //!< tiled 4X
+    };
+
+    /**
+     * Copy task for one image plane.
+     */
+    struct StSplitPlane {
+        const StImagePlane* Src;     //!< source plane
+        const StImagePlane* Src2;    //!< second source plane of the same layout merged into output (NULL if unused)
+        StImagePlane*       DstL;    //!< first output plane
+        StImagePlane*       DstR;    //!< second output plane (NULL for mono)
+        StSplitLayout       Layout;  //!< source layout
+        StSplitConvert      Convert; //!< pixel conversion
+        size_t              NbComps; //!< number of components per pixel (for conversion)
+    };
+
+    /**
+     * Splitting job over all planes of the frame.
+     * Output rows are processed in chunks which can be executed in parallel.
+     */
+    class StSplitJob : public StThreadPool::Job {
+
+            public:
+
+        /**
+         * Main constructor.
+         * @param theDeviceCaps device capabilities
+         * @param theToCompact  use compact texture formats (half-float instead of float, 10-bit instead of 16-bit RGB)
+         *                      and repack 10-bit planar YUV into semi-planar layout
+         */
+        StSplitJob(const StGLDeviceCaps& theDeviceCaps,
+                   const bool            theToCompact)
+        : myNbPlanes(0),
+          myNbBytes(0),
+          myToHalfFloat(theToCompact && theDeviceCaps.hasHalfFloat),
+          myToRGB10A2  (theToCompact && theDeviceCaps.hasRGB10A2),
+          myToNv10     (theToCompact) {
+            myNv10Images[0] = NULL;
+            myNv10Images[1] = NULL;
+        }
+
+        /**
+         * Register the image to be repacked from 10-bit planar YUV into semi-planar P010 layout,
+         * so that it is uploaded into two 16-bit textures (luma and interleaved chroma) instead of three.
+         * @return true if image has been registered
+         */
+        bool setupNv10(const StImage& theImage) {
+            if(!myToNv10
+            || theImage.isNull()
+            || theImage.getColorModel() != StImage::ImgColor_YUV
+            || (theImage.getColorScale() != StImage::ImgScale_Mpeg10
+             && theImage.getColorScale() != StImage::ImgScale_Jpeg10)
+            || theImage.getPlane(0).getFormat() != StImagePlane::ImgGray16
+            || theImage.getPlane(1).getFormat() != StImagePlane::ImgGray16
+            || theImage.getPlane(2).getFormat() != StImagePlane::ImgGray16
+            || theImage.getPlane(1).getSizeX()  != theImage.getPlane(2).getSizeX()
+            || theImage.getPlane(1).getSizeY()  != theImage.getPlane(2).getSizeY()
+            || theImage.getPlane(1).isTopDown() != theImage.getPlane(2).isTopDown()
+            || !theImage.getPlane(3).isNull()) {
+                return false;
+            }
+
+            for(size_t anImgIter = 0; anImgIter < 2; ++anImgIter) {
+                if(myNv10Images[anImgIter] == NULL
+                || myNv10Images[anImgIter] == &theImage) {
+                    myNv10Images[anImgIter] = &theImage;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @return true if plane of specified format is copied with conversion
+         */
+        bool isConverted(const StImagePlane::ImgFormat theFormat) const {
+            return getOutFormat(theFormat) != theFormat;
+        }
+
+        /**
+         * @return true if any plane of the image is copied with conversion
+         */
+        bool isConverted(const StImage& theImage) const {
+            if(&theImage == myNv10Images[0]
+            || &theImage == myNv10Images[1]) {
+                return true;
+            }
+            for(size_t aPlaneId = 0; aPlaneId < 4; ++aPlaneId) {
+                const StImagePlane& aPlane = theImage.getPlane(aPlaneId);
+                if(!aPlane.isNull()
+                 && isConverted(aPlane.getFormat())) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @return format of output plane
+         */
+        StImagePlane::ImgFormat getOutFormat(const StImagePlane::ImgFormat theFormat) const {
+            switch(theFormat) {
+                case StImagePlane::ImgRGBF:
+                case StImagePlane::ImgBGRF:
+                    return myToHalfFloat ? StImagePlane::ImgRGBHalf  : theFormat;
+                case StImagePlane::ImgRGBAF:
+                case StImagePlane::ImgBGRAF:
+                    return myToHalfFloat ? StImagePlane::ImgRGBAHalf : theFormat;
+                case StImagePlane::ImgRGB48:
+                    return myToRGB10A2   ? StImagePlane::ImgRGB10A2  : theFormat;
+                default:
+                    return theFormat;
+            }
+        }
+
+        /**
+         * @return format of output plane
+         */
+        StImagePlane::ImgFormat getOutFormat(const StImagePlane& theSrc) const {
+            size_t aPlaneId = 0;
+            if(findNv10Plane(theSrc, aPlaneId)) {
+                return aPlaneId == 1 ? StImagePlane::ImgUV16 : StImagePlane::ImgGray16;
+            }
+            return getOutFormat(theSrc.getFormat());
+        }
+
+        /**
+         * @return true if plane is merged into another output plane and should be skipped
+         */
+        bool isMerged(const StImagePlane& theSrc) const {
+            size_t aPlaneId = 0;
+            return findNv10Plane(theSrc, aPlaneId)
+                && aPlaneId == 2;
+        }
+
+        /**
+         * Add plane to the job. Output planes should be already initialized.
+         */
+        void add(const StImagePlane& theSrc,
+                 StImagePlane&       theDstL,
+                 StImagePlane*       theDstR,
+                 const StSplitLayout theLayout) {
+            if(myNbPlanes >= 8) {
+                return;
+            }
+            StSplitPlane& aPlane = myPlanes[myNbPlanes++];
+            aPlane.Src     = &theSrc;
+            aPlane.Src2    = NULL;
+            aPlane.DstL    = &theDstL;
+            aPlane.DstR    = theDstR;
+            aPlane.Layout  = theLayout;
+            aPlane.Convert = StConvert_None;
+            aPlane.NbComps = 1;
+            const StImage* aNv10Image = NULL;
+            size_t aPlaneId = 0;
+            if(findNv10Plane(theSrc, aPlaneId, &aNv10Image)) {
+                aPlane.Convert = aPlaneId == 1 ? StConvert_UV10ToHigh : StConvert_Gray10ToHigh;
+                aPlane.Src2    = aPlaneId == 1 ? &aNv10Image->getPlane(2) : NULL;
+            } else if(theSrc.getFormat() != theDstL.getFormat()) {
+                switch(theSrc.getFormat()) {
+                    case StImagePlane::ImgRGBF:  aPlane.Convert = StConvert_FloatToHalf;  aPlane.NbComps = 3; break;
+                    case StImagePlane::ImgRGBAF: aPlane.Convert = StConvert_FloatToHalf;  aPlane.NbComps = 4; break;
+                    case StImagePlane::ImgBGRF:  aPlane.Convert = StConvert_BgrToRgbHalf; aPlane.NbComps = 3; break;
+                    case StImagePlane::ImgBGRAF: aPlane.Convert = StConvert_BgrToRgbHalf; aPlane.NbComps = 4; break;
+                    case StImagePlane::ImgRGB48: aPlane.Convert = StConvert_Rgb48To10A2;  aPlane.NbComps = 3; break;
+                    default: break;
+                }
+            }
+            myNbBytes += theDstL.getSizeBytes() * (theDstR != NULL ? 2 : 1);
+        }
+
+        /**
+         * @return amount of data to be copied
+         */
+        size_t getNbBytes() const {
+            return myNbBytes;
+        }
+
+        virtual void perform(const size_t theChunk,
+                             const size_t theNbChunks) ST_ATTR_OVERRIDE {
+            for(size_t aPlaneIter = 0; aPlaneIter < myNbPlanes; ++aPlaneIter) {
+                const StSplitPlane& aPlane = myPlanes[aPlaneIter];
+                const size_t aNbRows  = aPlane.DstL->getSizeY();
+                const size_t aRowFrom = aNbRows *  theChunk      / theNbChunks;
+                const size_t aRowTo   = aNbRows * (theChunk + 1) / theNbChunks;
+                copyRows(aPlane, aRowFrom, aRowTo);
+            }
+        }
+
+            private:
+
+        /**
+         * Find the plane within images registered by setupNv10().
+         */
+        bool findNv10Plane(const StImagePlane& theSrc,
+                           size_t&             thePlaneId,
+                           const StImage**     theImage = NULL) const {
+            for(size_t anImgIter = 0; anImgIter < 2; ++anImgIter) {
+                const StImage* anImage = myNv10Images[anImgIter];
+                if(anImage == NULL) {
+                    continue;
+                }
+                for(size_t aPlaneId = 0; aPlaneId < 3; ++aPlaneId) {
+                    if(&anImage->getPlane(aPlaneId) == &theSrc) {
+                        thePlaneId = aPlaneId;
+                        if(theImage != NULL) {
+                            *theImage = anImage;
+                        }
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        /**
+         * Return source row in top-down order.
+         */
+        static const GLubyte* srcRow(const StImagePlane& theSrc,
+                                     const size_t        theRow,
+                                     const size_t        theCol) {
+            return theSrc.getData(theSrc.isTopDown() ? theRow : (theSrc.getSizeY() - 1 - theRow), theCol);
+        }
+
+        /**
+         * Copy pixels of the row.
+         */
+        static void copyRow(const StSplitPlane& thePlane,
+                            GLubyte*            theDst,
+                            const GLubyte*      theSrc,
+                            const size_t        theNbPixels) {
+            const GLubyte* aSrc2 = NULL;
+            if(thePlane.Src2 != NULL) {
+                // second plane has the same dimensions, so that the same row and column are taken from it
+                const size_t anOffset  = size_t(theSrc - thePlane.Src->getData());
+                const size_t aRowBytes = thePlane.Src->getSizeRowBytes();
+                aSrc2 = thePlane.Src2->getData(anOffset / aRowBytes, 0) + (anOffset % aRowBytes);
+            }
+            copyPixels(thePlane.Convert, thePlane.NbComps, theDst, theSrc, aSrc2,
+                       theNbPixels, thePlane.DstL->getSizePixelBytes());
+        }
+
+        /**
+         * Fill output rows within specified range.
+         */
+        static void copyRows(const StSplitPlane& thePlane,
+                             const size_t        theRowFrom,
+                             const size_t        theRowTo) {
+            const StImagePlane& aSrc  = *thePlane.Src;
+            StImagePlane&       aDstL = *thePlane.DstL;
+            const size_t aPixelBytes = aDstL.getSizePixelBytes();
+            switch(thePlane.Layout) {
+                case StSplit_Mono: {
+                    const size_t aCopyPixels = stMin(aDstL.getSizeX(), aSrc.getSizeX());
+                    const size_t aRowTo      = stMin(theRowTo, aSrc.getSizeY());
+                    for(size_t aRow = theRowFrom; aRow < aRowTo; ++aRow) {
+                        copyRow(thePlane, aDstL.changeData(aRow, 0), srcRow(aSrc, aRow, 0), aCopyPixels);
+                    }
+                    return;
+                }
+                case StSplit_Parallel: {
+                    StImagePlane& aDstR = *thePlane.DstR;
+                    const size_t aCopyPixels = aDstL.getSizeX();
+                    for(size_t aRow = theRowFrom; aRow < theRowTo; ++aRow) {
+                        copyRow(thePlane, aDstL.changeData(aRow, 0), srcRow(aSrc, aRow, 0),                aCopyPixels);
+                        copyRow(thePlane, aDstR.changeData(aRow, 0), srcRow(aSrc, aRow, aDstL.getSizeX()), aCopyPixels);
+                    }
+                    return;
+                }
+                case StSplit_OverUnder: {
+                    StImagePlane& aDstR = *thePlane.DstR;
+                    const size_t aCopyPixels = aDstL.getSizeX();
+                    const size_t aRowsHalf   = aDstL.getSizeY();
+                    for(size_t aRow = theRowFrom; aRow < theRowTo; ++aRow) {
+                        copyRow(thePlane, aDstL.changeData(aRow, 0), srcRow(aSrc, aRow,             0), aCopyPixels);
+                        copyRow(thePlane, aDstR.changeData(aRow, 0), srcRow(aSrc, aRowsHalf + aRow, 0), aCopyPixels);
+                    }
+                    return;
+                }
+                case StSplit_Rows: {
+                    StImagePlane& aDstR = *thePlane.DstR;
+                    const size_t aCopyPixels = aDstL.getSizeX();
+                    for(size_t aRow = theRowFrom; aRow < theRowTo; ++aRow) {
+                        copyRow(thePlane, aDstL.changeData(aRow, 0), srcRow(aSrc, 2 * aRow,     0), aCopyPixels);
+                        copyRow(thePlane, aDstR.changeData(aRow, 0), srcRow(aSrc, 2 * aRow + 1, 0), aCopyPixels);
+                    }
+                    return;
+                }
+                case StSplit_Columns: {
+                    StImagePlane& aDstR = *thePlane.DstR;
+                    if(thePlane.Convert == StConvert_None) {
+                        for(size_t aRow = theRowFrom; aRow < theRowTo; ++aRow) {
+                            splitColumns(srcRow(aSrc, aRow, 0), aDstL.changeData(aRow, 0), aDstR.changeData(aRow, 0),
+                                         aDstL.getSizeX(), aPixelBytes);
+                        }
+                        return;
+                    }
+
+                    const size_t aSrcPixelBytes = aSrc.getSizePixelBytes();
+                    for(size_t aRow = theRowFrom; aRow < theRowTo; ++aRow) {
+                        const GLubyte* aSrcRow  = srcRow(aSrc, aRow, 0);
+                        GLubyte*       aDstRowL = aDstL.changeData(aRow, 0);
+                        GLubyte*       aDstRowR = aDstR.changeData(aRow, 0);
+                        for(size_t aPixel = 0; aPixel < aDstL.getSizeX(); ++aPixel) {
+                            copyRow(thePlane, aDstRowL + aPixel * aPixelBytes, aSrcRow + (2 * aPixel)     * aSrcPixelBytes, 1);
+                            copyRow(thePlane, aDstRowR + aPixel * aPixelBytes, aSrcRow + (2 * aPixel + 1) * aSrcPixelBytes, 1);
+                        }
+                    }
+                    return;
+                }
+                case StSplit_Tiled4X: {
+                    // left view is a big tile at top-left corner,
+                    // right view is composed from half-width tile at top-right and two quarter tiles at bottom
+                    StImagePlane& aDstR = *thePlane.DstR;
+                    const size_t aDataSizeX     = aDstL.getSizeX();
+                    const size_t aDataSizeY     = aDstL.getSizeY();
+                    const size_t aDataSizeXHalf = aDataSizeX / 2;
+                    const size_t aDataSizeYHalf = aDataSizeY / 2;
+                    for(size_t aRow = theRowFrom; aRow < theRowTo; ++aRow) {
+                        copyRow(thePlane, aDstL.changeData(aRow, 0), srcRow(aSrc, aRow, 0),          aDataSizeX);
+                        copyRow(thePlane, aDstR.changeData(aRow, 0), srcRow(aSrc, aRow, aDataSizeX), aDataSizeXHalf);
+                        if(aRow < aDataSizeYHalf) {
+                            copyRow(thePlane, aDstR.changeData(aRow, aDataSizeXHalf),
+                                    srcRow(aSrc, aDataSizeY + aRow, 0), aDataSizeXHalf);
+                        } else if(aRow < 2 * aDataSizeYHalf) {
+                            copyRow(thePlane, aDstR.changeData(aRow, aDataSizeXHalf),
+                                    srcRow(aSrc, aDataSizeY + aRow - aDataSizeYHalf, aDataSizeXHalf), aDataSizeXHalf);
+                        }
+                    }
+                    return;
+                }
+            }
+        }
+
+            private:
+
+        StSplitPlane myPlanes[8];   //!< planes to process
+        size_t       myNbPlanes;    //!< number of planes
+        size_t       myNbBytes;     //!< amount of data to copy
+        bool         myToHalfFloat; //!< convert float planes into half-float
+        bool         myToRGB10A2;   //!< convert 16-bit RGB planes into packed 10-bit RGB
+        bool         myToNv10;      //!< repack 10-bit planar YUV into semi-planar layout
+        const StImage* myNv10Images[2]; //!< images to be repacked into semi-planar layout
+
+    };
+
+}
+
 static GLubyte* readFromParallel(const StImagePlane& theSrc,
                                  GLubyte*            theDataPtr,
                                  StImagePlane&       theDataL,
-                                 StImagePlane&       theDataR) {
+                                 StImagePlane&       theDataR,
+                                 StSplitJob&         theJob) {
     if(theSrc.isNull()) {
         return theDataPtr;
+    } else if(theJob.isMerged(theSrc)) {
+        theDataL.nullify();
+        theDataR.nullify();
+        return theDataPtr;
     }
 
+    const StImagePlane::ImgFormat aFormat = theJob.getOutFormat(theSrc);
     const size_t srcDataSizeXHalf = theSrc.getSizeX() / 2;
-    const size_t anOutRowBytes    = getEvenNumber(srcDataSizeXHalf * theSrc.getSizePixelBytes());
-    theDataL.initWrapper(theSrc.getFormat(), theDataPtr,
+    const size_t anOutRowBytes    = getEvenNumber(srcDataSizeXHalf * StImagePlane::getSizePixelBytes(aFormat));
+    theDataL.initWrapper(aFormat, theDataPtr,
                          srcDataSizeXHalf, theSrc.getSizeY(),
                          anOutRowBytes);
-    theDataR.initWrapper(theSrc.getFormat(), &theDataPtr[theDataL.getSizeBytes()],
+    theDataR.initWrapper(aFormat, &theDataPtr[theDataL.getSizeBytes()],
                          theDataL.getSizeX(), theDataL.getSizeY(),
                          anOutRowBytes);
+    theJob.add(theSrc, theDataL, &theDataR, StSplit_Parallel);
+    return &theDataPtr[2 * theDataL.getSizeBytes()];
+}
 
-    const size_t aCopyRows      = stMin(theDataL.getSizeY(), theSrc.getSizeY());
-    const size_t aCopyRowBytes  = stMin(theDataL.getSizeX(), srcDataSizeXHalf) * theDataL.getSizePixelBytes();
-
-    // copy row by row
-    size_t aRowInc = theSrc.isTopDown() ? 1 : size_t(-1);
-    size_t aRowTo  = theSrc.isTopDown() ? 0 : (aCopyRows - 1);
-    for(size_t aRowFrom = 0; aRowFrom < aCopyRows; ++aRowFrom, aRowTo += aRowInc) {
-        stMemCpy(theDataL.changeData(aRowTo, 0),
-                 theSrc.getData(aRowFrom, 0),
-                 aCopyRowBytes);
-        stMemCpy(theDataR.changeData(aRowTo, 0),
-                 theSrc.getData(aRowFrom, srcDataSizeXHalf),
-                 aCopyRowBytes);
+static GLubyte* readFromColumnInterlace(const StImagePlane& theSrc,
+                                        GLubyte*            theDataPtr,
+                                        StImagePlane&       theDataL,
+                                        StImagePlane&       theDataR,
+                                        StSplitJob&         theJob) {
+    if(theSrc.isNull()) {
+        return theDataPtr;
+    } else if(theJob.isMerged(theSrc)) {
+        theDataL.nullify();
+        theDataR.nullify();
+        return theDataPtr;
     }
+
+    const StImagePlane::ImgFormat aFormat = theJob.getOutFormat(theSrc);
+    const size_t srcDataSizeXHalf = theSrc.getSizeX() / 2;
+    const size_t anOutRowBytes    = getEvenNumber(srcDataSizeXHalf * StImagePlane::getSizePixelBytes(aFormat));
+    theDataL.initWrapper(aFormat, theDataPtr,
+                         srcDataSizeXHalf, theSrc.getSizeY(),
+                         anOutRowBytes);
+    theDataR.initWrapper(aFormat, &theDataPtr[theDataL.getSizeBytes()],
+                         theDataL.getSizeX(), theDataL.getSizeY(),
+                         anOutRowBytes);
+    theJob.add(theSrc, theDataL, &theDataR, StSplit_Columns);
     return &theDataPtr[2 * theDataL.getSizeBytes()];
 }
 
 static GLubyte* readFromOverUnderLR(const StImagePlane& theSrc,
                                     GLubyte*            theDataPtr,
                                     StImagePlane&       theDataL,
-                                    StImagePlane&       theDataR) {
+                                    StImagePlane&       theDataR,
+                                    StSplitJob&         theJob) {
     if(theSrc.isNull()) {
         return theDataPtr;
+    } else if(theJob.isMerged(theSrc)) {
+        theDataL.nullify();
+        theDataR.nullify();
+        return theDataPtr;
     }
 
+    const StImagePlane::ImgFormat aFormat = theJob.getOutFormat(theSrc);
     const size_t srcDataSizeYHalf = theSrc.getSizeY() / 2;
-    const size_t anOutRowBytes    = getEvenNumber(theSrc.getSizeX() * theSrc.getSizePixelBytes());
-    theDataL.initWrapper(theSrc.getFormat(), theDataPtr,
+    const size_t anOutRowBytes    = getEvenNumber(theSrc.getSizeX() * StImagePlane::getSizePixelBytes(aFormat));
+    theDataL.initWrapper(aFormat, theDataPtr,
                          theSrc.getSizeX(), srcDataSizeYHalf,
                          anOutRowBytes);
-    theDataR.initWrapper(theSrc.getFormat(), &theDataPtr[theDataL.getSizeBytes()],
+    theDataR.initWrapper(aFormat, &theDataPtr[theDataL.getSizeBytes()],
                          theDataL.getSizeX(), theDataL.getSizeY(),
                          anOutRowBytes);
-
-    const size_t aCopyRows      = stMin(theDataL.getSizeY(), srcDataSizeYHalf);
-    const size_t aCopyRowBytes  = stMin(theDataL.getSizeX(), theSrc.getSizeX()) * theDataL.getSizePixelBytes();
-
-    if(theDataL.getSizeRowBytes() == theSrc.getSizeRowBytes() && theSrc.isTopDown()) {
-        // perform fat copy
-        stMemCpy(theDataL.changeData(),
-                 theSrc.getData(0, 0),
-                 aCopyRows * aCopyRowBytes);
-        stMemCpy(theDataR.changeData(),
-                 theSrc.getData(srcDataSizeYHalf, 0),
-                 aCopyRows * aCopyRowBytes);
-    } else {
-        // check if data is upside-down
-        const size_t aRowTop    = theSrc.isTopDown() ? 0 : srcDataSizeYHalf;
-        const size_t aRowBottom = theSrc.isTopDown() ? srcDataSizeYHalf : 0;
-
-        // copy row by row
-        const size_t aRowInc = theSrc.isTopDown() ? 1 : size_t(-1);
-        size_t       aRowTo  = theSrc.isTopDown() ? 0 : (aCopyRows - 1);
-        for(size_t aRow = 0; aRow < aCopyRows; ++aRow, aRowTo += aRowInc) {
-            stMemCpy(theDataL.changeData(aRowTo, 0),
-                     theSrc.getData(aRowTop + aRow, 0),
-                     aCopyRowBytes);
-        }
-        aRowTo = theSrc.isTopDown() ? 0 : (aCopyRows - 1);
-        for(size_t aRow = 0; aRow < aCopyRows; ++aRow, aRowTo += aRowInc) {
-            stMemCpy(theDataR.changeData(aRowTo, 0),
-                     theSrc.getData(aRowBottom + aRow, 0),
-                     aCopyRowBytes);
-        }
-    }
+    theJob.add(theSrc, theDataL, &theDataR, StSplit_OverUnder);
     return &theDataPtr[2 * theDataL.getSizeBytes()];
 }
 
-
 static GLubyte* readFromRowInterlace(const StImagePlane& theSrc,
                                      GLubyte*            theDataPtr,
                                      StImagePlane&       theDataL,
-                                     StImagePlane&       theDataR) {
+                                     StImagePlane&       theDataR,
+                                     StSplitJob&         theJob) {
     if(theSrc.isNull()) {
         return theDataPtr;
+    } else if(theJob.isMerged(theSrc)) {
+        theDataL.nullify();
+        theDataR.nullify();
+        return theDataPtr;
     }
 
+    const StImagePlane::ImgFormat aFormat = theJob.getOutFormat(theSrc);
     const size_t srcDataSizeYHalf = theSrc.getSizeY() / 2;
-    const size_t anOutRowBytes = getEvenNumber(theSrc.getSizeX() * theSrc.getSizePixelBytes());
-    theDataL.initWrapper(theSrc.getFormat(), theDataPtr,
+    const size_t anOutRowBytes = getEvenNumber(theSrc.getSizeX() * StImagePlane::getSizePixelBytes(aFormat));
+    theDataL.initWrapper(aFormat, theDataPtr,
                          theSrc.getSizeX(), srcDataSizeYHalf,
                          anOutRowBytes);
-    theDataR.initWrapper(theSrc.getFormat(), &theDataPtr[theDataL.getSizeBytes()],
+    theDataR.initWrapper(aFormat, &theDataPtr[theDataL.getSizeBytes()],
                          theDataL.getSizeX(), theDataL.getSizeY(),
                          anOutRowBytes);
-
-    const size_t aCopyRows     = stMin(theDataL.getSizeY(), srcDataSizeYHalf);
-    const size_t aCopyRowBytes = stMin(theDataL.getSizeX(), theSrc.getSizeX()) * theDataL.getSizePixelBytes();
-
-    const size_t aSrcRowLeft   = theSrc.isTopDown() ? 0 : 1;
-    const size_t aSrcRowRight  = theSrc.isTopDown() ? 1 : 0;
-
-    // prepare iterator for bottom-up source data
-    const size_t aRowInc = theSrc.isTopDown() ? 1 : size_t(-1);
-    size_t       aRowTo  = theSrc.isTopDown() ? 0 : (aCopyRows - 1);
-
-    // copy row by row
-    for(size_t aRowFrom = 0; aRowFrom < aCopyRows; ++aRowFrom, aRowTo += aRowInc) {
-        stMemCpy(theDataR.changeData(aRowTo, 0),
-                 theSrc.getData(2 * aRowFrom + aSrcRowRight, 0),
-                 aCopyRowBytes);
-        stMemCpy(theDataL.changeData(aRowTo, 0),
-                 theSrc.getData(2 * aRowFrom + aSrcRowLeft, 0),
-                 aCopyRowBytes);
-    }
+    theJob.add(theSrc, theDataL, &theDataR, StSplit_Rows);
     return &theDataPtr[2 * theDataL.getSizeBytes()];
 }
 
 static GLubyte* readFromTiled4X(const StImagePlane& theDataSrc,
                                 GLubyte*            theDataOutPtr,
                                 StImagePlane&       theDataOutL,
-                                StImagePlane&       theDataOutR) {
+                                StImagePlane&       theDataOutR,
+                                StSplitJob&         theJob) {
     if(theDataSrc.isNull()) {
         return theDataOutPtr;
+    } else if(theJob.isMerged(theDataSrc)) {
+        theDataOutL.nullify();
+        theDataOutR.nullify();
+        return theDataOutPtr;
     }
 
+    const StImagePlane::ImgFormat aFormat = theJob.getOutFormat(theDataSrc);
     const size_t aDataSizeX = (theDataSrc.getSizeX() / 3) * 2;
     const size_t aDataSizeY = (theDataSrc.getSizeY() / 3) * 2;
-    const size_t aDataSizeXHalf = aDataSizeX / 2;
 
-    const size_t anOutRowBytes = getEvenNumber(aDataSizeX * theDataSrc.getSizePixelBytes());
-    theDataOutL.initWrapper(theDataSrc.getFormat(), theDataOutPtr,
+    const size_t anOutRowBytes = getEvenNumber(aDataSizeX * StImagePlane::getSizePixelBytes(aFormat));
+    theDataOutL.initWrapper(aFormat, theDataOutPtr,
                             aDataSizeX, aDataSizeY,
                             anOutRowBytes);
-    theDataOutR.initWrapper(theDataSrc.getFormat(), &theDataOutPtr[theDataOutL.getSizeBytes()],
+    theDataOutR.initWrapper(aFormat, &theDataOutPtr[theDataOutL.getSizeBytes()],
                             theDataOutL.getSizeX(), theDataOutL.getSizeY(),
                             anOutRowBytes);
-
-    size_t aCopyRows     = stMin(theDataOutL.getSizeY(), aDataSizeY);
-    size_t aCopyRowBytes = stMin(theDataOutL.getSizeX(), aDataSizeX) * theDataOutL.getSizePixelBytes();
-
-    // check if data is upside-down
-    size_t aRowSrcTop = theDataSrc.isTopDown() ? 0 : (theDataSrc.getSizeY() - 1);
-
-    // copy Left view (1 big tile at top-left corner)
-    const size_t aRowInc = theDataSrc.isTopDown() ? 1 : size_t(-1);
-    size_t aRowTo  = 0;
-    size_t aRowSrc = aRowSrcTop;
-    for(; aRowTo < aCopyRows; ++aRowTo, aRowSrc += aRowInc) {
-        stMemCpy(theDataOutL.changeData(aRowTo, 0),
-                 theDataSrc.getData(aRowSrc, 0),
-                 aCopyRowBytes);
-    }
-
-    // copy Right view (first half-width tile at top-right
-    aCopyRowBytes = (aDataSizeX / 2) * theDataOutL.getSizePixelBytes();
-    aRowTo  = 0;
-    aRowSrc = aRowSrcTop;
-    for(; aRowTo < aCopyRows; ++aRowTo, aRowSrc += aRowInc) {
-        stMemCpy(theDataOutR.changeData(aRowTo, 0),
-                 theDataSrc.getData(aRowSrc, aDataSizeX),
-                 aCopyRowBytes);
-    }
-
-    // copy Right view (first 0.25 tile at bottom-left)
-    aCopyRows = aDataSizeY / 2;
-    aRowSrcTop = theDataSrc.isTopDown() ? aDataSizeY : (theDataSrc.getSizeY() - aDataSizeY);
-    aRowTo  = 0;
-    aRowSrc = aRowSrcTop;
-    for(; aRowTo < aCopyRows; ++aRowTo, aRowSrc += aRowInc) {
-        stMemCpy(theDataOutR.changeData(aRowTo, aDataSizeXHalf),
-                 theDataSrc.getData(aRowSrc, 0),
-                 aCopyRowBytes);
-    }
-
-    // copy Right view (second 0.25 tile at bottom)
-    aRowTo  = aCopyRows;
-    aRowSrc = aRowSrcTop;
-    aCopyRows += aCopyRows;
-    for(; aRowTo < aCopyRows; ++aRowTo, aRowSrc += aRowInc) {
-        stMemCpy(theDataOutR.changeData(aRowTo, aDataSizeXHalf),
-                 theDataSrc.getData(aRowSrc, aDataSizeXHalf),
-                 aCopyRowBytes);
-    }
-
+    theJob.add(theDataSrc, theDataOutL, &theDataOutR, StSplit_Tiled4X);
     return &theDataOutPtr[2 * theDataOutL.getSizeBytes()];
 }
 
 static GLubyte* readFromMono(const StImagePlane& theSrc,
                              GLubyte*            theDataPtr,
-                             StImagePlane&       theData) {
+                             StImagePlane&       theData,
+                             StSplitJob&         theJob) {
     if(theSrc.isNull()) {
         return theDataPtr;
+    } else if(theJob.isMerged(theSrc)) {
+        theData.nullify();
+        return theDataPtr;
     }
 
-    const size_t anOutRowBytes = getEvenNumber(theSrc.getSizeX() * theSrc.getSizePixelBytes());
-    theData.initWrapper(theSrc.getFormat(), theDataPtr,
+    const StImagePlane::ImgFormat aFormat = theJob.getOutFormat(theSrc);
+    const size_t anOutRowBytes = getEvenNumber(theSrc.getSizeX() * StImagePlane::getSizePixelBytes(aFormat));
+    theData.initWrapper(aFormat, theDataPtr,
                         theSrc.getSizeX(), theSrc.getSizeY(),
                         anOutRowBytes);
-
-    if(theData.getSizeRowBytes() == theSrc.getSizeRowBytes() && theSrc.isTopDown()) {
-        // perform fat copy
-        stMemCpy(theData.changeData(), theSrc.getData(),
-                 stMin(theData.getSizeBytes(), theSrc.getSizeBytes()));
-    } else {
-        const size_t aCopyRows     = stMin(theData.getSizeY(), theSrc.getSizeY());
-        const size_t aCopyRowBytes = stMin(theData.getSizeX(), theSrc.getSizeX()) * theData.getSizePixelBytes();
-        const size_t aRowInc       = theSrc.isTopDown() ? 1 : size_t(-1);
-        size_t       aRowTo        = theSrc.isTopDown() ? 0 : (aCopyRows - 1);
-        for(size_t aRowFrom = 0; aRowFrom < aCopyRows; ++aRowFrom, aRowTo += aRowInc) {
-            stMemCpy(theData.changeData(aRowTo, 0), theSrc.getData(aRowFrom, 0), aCopyRowBytes);
-        }
-    }
+    theJob.add(theSrc, theData, NULL, StSplit_Mono);
     return &theDataPtr[theData.getSizeBytes()];
 }
 
@@ -354,17 +996,26 @@ void StGLTextureData::updateData(const StGLDeviceCaps&           theDeviceCaps,
                                  const StHandle<StStereoParams>& theStParams,
                                  const StFormat                  theFormat,
                                  const StCubemap                 theCubemap,
-                                 const double                    thePts) {
+                                 const double                    thePts,
+                                 const StHandle<StThreadPool>&   theThreadPool,
+                                 const bool                      theToCompact,
+                                 const bool                      theIsRightRepeated) {
     // setup new stereo source
     myStParams  = theStParams;
     myPts       = thePts;
     mySrcFormat = theFormat != StFormat_AUTO ? theFormat : StFormat_Mono;
+    myIsRightRepeated = theIsRightRepeated && theFormat == StFormat_SeparateFrames;
 
     // reset fill texture state
     myFillRows = myFillFromRow = 0;
 
+    StSplitJob aJob(theDeviceCaps, theToCompact);
+    const bool isNv10L = aJob.setupNv10(theDataL);
+    const bool isNv10R = aJob.setupNv10(theDataR);
     if(canCopyReference(theDataL)
-    && canCopyReference(theDataR)) {
+    && canCopyReference(theDataR)
+    && !aJob.isConverted(theDataL)
+    && !aJob.isConverted(theDataR)) {
         bool toCopy = false;
         switch(mySrcFormat) {
             case StFormat_SideBySide_LR:
@@ -517,6 +1168,21 @@ void StGLTextureData::updateData(const StGLDeviceCaps&           theDeviceCaps,
 
     reAllocate(aNewSizeBytes);
     copyProps(theDataL, theDataR);
+    if(isNv10L) {
+        const StImage::ImgColorScale aScale = theDataL.getColorScale() == StImage::ImgScale_Jpeg10
+                                            ? StImage::ImgScale_Nv10Full
+                                            : StImage::ImgScale_Nv10Mpeg;
+        myDataPair.setColorScale(aScale);
+        myDataL.setColorScale(aScale);
+        if(theDataR.isNull()) {
+            myDataR.setColorScale(aScale);
+        }
+    }
+    if(isNv10R) {
+        myDataR.setColorScale(theDataR.getColorScale() == StImage::ImgScale_Jpeg10
+                            ? StImage::ImgScale_Nv10Full
+                            : StImage::ImgScale_Nv10Mpeg);
+    }
 
     switch(mySrcFormat) {
         case StFormat_SideBySide_LR:
@@ -525,7 +1191,8 @@ void StGLTextureData::updateData(const StGLDeviceCaps&           theDeviceCaps,
             for(size_t aPlaneId = 0; aPlaneId < 4; ++aPlaneId) {
                 aDataDispl = readFromParallel(theDataL.getPlane(aPlaneId), aDataDispl,
                                               (mySrcFormat == StFormat_SideBySide_LR) ? myDataL.changePlane(aPlaneId) : myDataR.changePlane(aPlaneId),
-                                              (mySrcFormat == StFormat_SideBySide_LR) ? myDataR.changePlane(aPlaneId) : myDataL.changePlane(aPlaneId));
+                                              (mySrcFormat == StFormat_SideBySide_LR) ? myDataR.changePlane(aPlaneId) : myDataL.changePlane(aPlaneId),
+                                              aJob);
             }
             break;
         }
@@ -535,7 +1202,8 @@ void StGLTextureData::updateData(const StGLDeviceCaps&           theDeviceCaps,
             for(size_t aPlaneId = 0; aPlaneId < 4; ++aPlaneId) {
                 aDataDispl = readFromOverUnderLR(theDataL.getPlane(aPlaneId), aDataDispl,
                                                  (mySrcFormat == StFormat_TopBottom_LR) ? myDataL.changePlane(aPlaneId) : myDataR.changePlane(aPlaneId),
-                                                 (mySrcFormat == StFormat_TopBottom_LR) ? myDataR.changePlane(aPlaneId) : myDataL.changePlane(aPlaneId));
+                                                 (mySrcFormat == StFormat_TopBottom_LR) ? myDataR.changePlane(aPlaneId) : myDataL.changePlane(aPlaneId),
+                                                 aJob);
             }
             break;
         }
@@ -546,7 +1214,7 @@ void StGLTextureData::updateData(const StGLDeviceCaps&           theDeviceCaps,
             // TODO (Kirill Gavrilov#9) wrong for yuv420p?
             for(size_t aPlaneId = 0; aPlaneId < 4; ++aPlaneId) {
                 aDataDispl = readFromRowInterlace(theDataL.getPlane(aPlaneId), aDataDispl,
-                                                  myDataL.changePlane(aPlaneId), myDataR.changePlane(aPlaneId));
+                                                  myDataL.changePlane(aPlaneId), myDataR.changePlane(aPlaneId), aJob);
 
             }
             break;
@@ -557,10 +1225,20 @@ void StGLTextureData::updateData(const StGLDeviceCaps&           theDeviceCaps,
             myDataR.setPixelRatio(theDataR.getPixelRatio());
             GLubyte* aDataDispl = myDataPtr;
             for(size_t aPlaneId = 0; aPlaneId < 4; ++aPlaneId) {
-                aDataDispl = readFromMono(theDataL.getPlane(aPlaneId), aDataDispl, myDataL.changePlane(aPlaneId));
+                aDataDispl = readFromMono(theDataL.getPlane(aPlaneId), aDataDispl, myDataL.changePlane(aPlaneId), aJob);
             }
             for(size_t aPlaneId = 0; aPlaneId < 4; ++aPlaneId) {
-                aDataDispl = readFromMono(theDataR.getPlane(aPlaneId), aDataDispl, myDataR.changePlane(aPlaneId));
+                aDataDispl = readFromMono(theDataR.getPlane(aPlaneId), aDataDispl, myDataR.changePlane(aPlaneId), aJob);
+            }
+            break;
+        }
+        case StFormat_Columns: {
+            myDataL.setPixelRatio(theDataL.getPixelRatio() * 2.0f);
+            myDataR.setPixelRatio(theDataL.getPixelRatio() * 2.0f);
+            GLubyte* aDataDispl = myDataPtr;
+            for(size_t aPlaneId = 0; aPlaneId < 4; ++aPlaneId) {
+                aDataDispl = readFromColumnInterlace(theDataL.getPlane(aPlaneId), aDataDispl,
+                                                     myDataL.changePlane(aPlaneId), myDataR.changePlane(aPlaneId), aJob);
             }
             break;
         }
@@ -568,23 +1246,32 @@ void StGLTextureData::updateData(const StGLDeviceCaps&           theDeviceCaps,
             GLubyte* aDataDispl = myDataPtr;
             for(size_t aPlaneId = 0; aPlaneId < 4; ++aPlaneId) {
                 aDataDispl = readFromTiled4X(theDataL.getPlane(aPlaneId), aDataDispl,
-                                             myDataL.changePlane(aPlaneId), myDataR.changePlane(aPlaneId));
+                                             myDataL.changePlane(aPlaneId), myDataR.changePlane(aPlaneId), aJob);
             }
             break;
         }
         case StFormat_AnaglyphRedCyan:
         case StFormat_AnaglyphGreenMagenta:
         case StFormat_AnaglyphYellowBlue:
-        case StFormat_Columns: // not supported
         case StFormat_Mono:
         default: {
             GLubyte* aDataDispl = myDataPtr;
             for(size_t aPlaneId = 0; aPlaneId < 4; ++aPlaneId) {
-                aDataDispl = readFromMono(theDataL.getPlane(aPlaneId), aDataDispl, myDataL.changePlane(aPlaneId));
+                aDataDispl = readFromMono(theDataL.getPlane(aPlaneId), aDataDispl, myDataL.changePlane(aPlaneId), aJob);
             }
             break;
         }
     }
+
+    // split rows between worker threads only for large frames
+    const size_t aNbChunks = (!theThreadPool.isNull() && aJob.getNbBytes() >= THE_PARALLEL_COPY_MIN_BYTES)
+                           ? theThreadPool->getNbThreads()
+                           : 1;
+    if(aNbChunks > 1) {
+        theThreadPool->perform(aJob, aNbChunks);
+    } else {
+        aJob.perform(0, 1);
+    }
     validateCubemap(theCubemap);
 }
 
@@ -616,15 +1303,94 @@ void StGLTextureData::validateCubemap(const StCubemap theCubemap) {
     }
 }
 
-void StGLTextureData::fillTexture(StGLContext&        theCtx,
-                                  StGLFrameTexture&   theFrameTexture,
-                                  const StImagePlane& theData) {
+/**
+ * Upload visible tiles of the plane region into the texture.
+ * The region is split into theNbCols x StGLVisibleTiles::NB_ROWS tiles.
+ * @param theTexture  target texture
+ * @param theTarget   texture target
+ * @param thePlane    the whole image plane
+ * @param theLeft     left   column of the plane region mapped to the texture
+ * @param theTop      top    row    of the plane region mapped to the texture
+ * @param theSizeX    width  of the plane region
+ * @param theSizeY    height of the plane region
+ * @param theTiles    visible tiles mask
+ * @param theColFirst first tile column within the mask corresponding to the region
+ * @param theNbCols   number of tile columns within the region
+ * @param theRowFrom  first row to upload within the region
+ * @param theRowTo    last  row to upload within the region (exclusive)
+ */
+static void fillPlaneTiles(StGLContext&            theCtx,
+                           StGLFrameTexture&       theTexture,
+                           const GLenum            theTarget,
+                           const StImagePlane&     thePlane,
+                           const size_t            theLeft,
+                           const size_t            theTop,
+                           const size_t            theSizeX,
+                           const size_t            theSizeY,
+                           const StGLVisibleTiles& theTiles,
+                           const int               theColFirst,
+                           const int               theNbCols,
+                           const size_t            theRowFrom,
+                           const size_t            theRowTo) {
+    const size_t aRowTo = stMin(theRowTo, theSizeY);
+    for(int aTileRow = 0; aTileRow < StGLVisibleTiles::NB_ROWS; ++aTileRow) {
+        uint32_t aMask = (theTiles.getRow(aTileRow) >> theColFirst) & ((uint32_t(1) << theNbCols) - 1);
+        const size_t aRowTop    = stMax(theSizeY *  aTileRow      / StGLVisibleTiles::NB_ROWS, theRowFrom);
+        const size_t aRowBottom = stMin(theSizeY * (aTileRow + 1) / StGLVisibleTiles::NB_ROWS, aRowTo);
+        if(aMask == 0
+        || aRowTop >= aRowBottom) {
+            continue;
+        }
+        if(!theCtx.hasUnpack) {
+            // without GL_UNPACK_ROW_LENGTH partial rows would be uploaded one-by-one
+            aMask = (uint32_t(1) << theNbCols) - 1;
+        }
+
+        // upload contiguous spans of visible tiles
+        for(int aCol = 0; aCol < theNbCols;) {
+            if((aMask & (uint32_t(1) << aCol)) == 0) {
+                ++aCol;
+                continue;
+            }
+
+            int aColEnd = aCol + 1;
+            for(; aColEnd < theNbCols && (aMask & (uint32_t(1) << aColEnd)) != 0; ++aColEnd) {}
+            const size_t aColLeft  = theSizeX * aCol    / theNbCols;
+            const size_t aColRight = theSizeX * aColEnd / theNbCols;
+            aCol = aColEnd;
+            if(aColLeft >= aColRight) {
+                continue;
+            }
+
+            StImagePlane aRegion;
+            if(!aRegion.initWrapper(thePlane.getFormat(), const_cast<GLubyte* >(thePlane.getData(theTop + aRowTop, theLeft + aColLeft)),
+                                    aColRight - aColLeft, aRowBottom - aRowTop, thePlane.getSizeRowBytes())) {
+                continue;
+            }
+            theTexture.fillSubImage(theCtx, aRegion, theTarget, GLsizei(aColLeft), GLsizei(aRowTop));
+        }
+    }
+}
+
+void StGLTextureData::fillTexture(StGLContext&            theCtx,
+                                  StGLFrameTexture&       theFrameTexture,
+                                  const StImagePlane&     theData,
+                                  const StGLVisibleTiles& theTiles,
+                                  const GLsizei           theRowFrom,
+                                  const GLsizei           theRowTo) {
     if(!theFrameTexture.isValid() || theData.isNull()) {
         return;
     }
 
+    const bool isPartial = !theTiles.isAll();
     if(myCubemapFormat != StCubemap_Packed) {
-        theFrameTexture.fillPatch(theCtx, theData, GL_TEXTURE_2D, myFillFromRow, myFillFromRow + myFillRows);
+        if(isPartial) {
+            fillPlaneTiles(theCtx, theFrameTexture, GL_TEXTURE_2D, theData,
+                           0, 0, theData.getSizeX(), theData.getSizeY(),
+                           theTiles, 0, StGLVisibleTiles::NB_COLS, size_t(theRowFrom), size_t(theRowTo));
+            return;
+        }
+        theFrameTexture.fillPatch(theCtx, theData, GL_TEXTURE_2D, theRowFrom, theRowTo);
         return;
     }
 
@@ -645,16 +1411,24 @@ void StGLTextureData::fillTexture(StGLContext&        theCtx,
                                  GL_TEXTURE_CUBE_MAP_POSITIVE_Z,
                                  GL_TEXTURE_CUBE_MAP_NEGATIVE_Z };
     for(size_t aTargetIter = 0; aTargetIter < 6; ++aTargetIter) {
-        StImagePlane aPlane;
         const bool isSecondRow = (aCoeffs[1] == 2 && aTargetIter >= 3);
         const size_t aLeft = isSecondRow ? (aPatch * (aTargetIter - 3)) : (aPatch * aTargetIter);
         const size_t aTop  = isSecondRow ? aPatch : 0;
+        if(isPartial) {
+            fillPlaneTiles(theCtx, theFrameTexture, aTargets[aTargetIter], theData,
+                           aLeft, aTop, aPatch, aPatch,
+                           theTiles, int(aTargetIter) * StGLVisibleTiles::NB_FACE_COLS, StGLVisibleTiles::NB_FACE_COLS,
+                           size_t(theRowFrom), size_t(theRowTo));
+            continue;
+        }
+
+        StImagePlane aPlane;
         if(!aPlane.initWrapper(theData.getFormat(), const_cast<GLubyte* >(theData.getData(aTop, aLeft)),
                                aPatch, aPatch, theData.getSizeRowBytes())) {
             ST_DEBUG_LOG("StGLTextureData::fillTexture(). wrapping failure");
             continue;
         }
-        theFrameTexture.fillPatch(theCtx, aPlane, aTargets[aTargetIter], myFillFromRow, myFillFromRow + myFillRows);
+        theFrameTexture.fillPatch(theCtx, aPlane, aTargets[aTargetIter], theRowFrom, theRowTo);
     }
 }
 
@@ -730,25 +1504,31 @@ static void prepareTextures(StGLContext&       theCtx,
     }
 }
 
-bool StGLTextureData::fillTexture(StGLContext&     theCtx,
-                                  StGLQuadTexture& theQTexture) {
+bool StGLTextureData::fillTexture(StGLContext&            theCtx,
+                                  StGLQuadTexture&        theQTexture,
+                                  const StGLVisibleTiles& theTiles) {
 
     // setup rows count to be filled per fillTexture()
     if(myFillRows == 0 || myFillFromRow == 0) {
         // prepare textures for new data
         prepareTextures(theCtx, myDataL, myCubemapFormat, theQTexture.getBack(StGLQuadTexture::LEFT_TEXTURE));
-        prepareTextures(theCtx, myDataR, myCubemapFormat, theQTexture.getBack(StGLQuadTexture::RIGHT_TEXTURE));
+        if(!myIsRightRepeated) {
+            prepareTextures(theCtx, myDataR, myCubemapFormat, theQTexture.getBack(StGLQuadTexture::RIGHT_TEXTURE));
+        }
 
         // remove links to old stereo parameters
         theQTexture.getBack(StGLQuadTexture::LEFT_TEXTURE).setSource(StHandle<StStereoParams>());
-        theQTexture.getBack(StGLQuadTexture::RIGHT_TEXTURE).setSource(StHandle<StStereoParams>());
+        if(!myIsRightRepeated) {
+            theQTexture.getBack(StGLQuadTexture::RIGHT_TEXTURE).setSource(StHandle<StStereoParams>());
+        }
 
         // TODO (Kirill Gavrilov#9) this value is meanfull only for PageFlip,
         //                          also rows number may be replaced with bytes count
         static const GLsizei UPDATED_ROWS_MAX = 1088; // we use optimal value to update 1080p video frame at-once
         GLsizei maxRows    = stMin(GLsizei(myDataL.getSizeY()), theQTexture.getBack(StGLQuadTexture::LEFT_TEXTURE).getSizeY());
         GLsizei iterations = (maxRows / (UPDATED_ROWS_MAX * 2)) + 1;
-        if(!myDataR.isNull()) {
+        if(!myDataR.isNull()
+        && !myIsRightRepeated) {
             maxRows    = stMax(maxRows, stMin(GLsizei(myDataR.getSizeY()), theQTexture.getBack(StGLQuadTexture::RIGHT_TEXTURE).getSizeY()));
             iterations = maxRows / UPDATED_ROWS_MAX + 1;
         }
@@ -765,25 +1545,28 @@ bool StGLTextureData::fillTexture(StGLContext&     theCtx,
         for(size_t aPlaneId = 0; aPlaneId < 4; ++aPlaneId) {
             fillTexture(theCtx,
                         theQTexture.getBack(StGLQuadTexture::LEFT_TEXTURE).getPlane(aPlaneId),
-                        myDataL.getPlane(aPlaneId));
+                        myDataL.getPlane(aPlaneId),
+                        theTiles, myFillFromRow, myFillFromRow + myFillRows);
         }
     }
-    if(theQTexture.getBack(StGLQuadTexture::RIGHT_TEXTURE).isValid()) {
+    if(!myIsRightRepeated
+    && theQTexture.getBack(StGLQuadTexture::RIGHT_TEXTURE).isValid()) {
         for(size_t aPlaneId = 0; aPlaneId < 4; ++aPlaneId) {
             fillTexture(theCtx,
                         theQTexture.getBack(StGLQuadTexture::RIGHT_TEXTURE).getPlane(aPlaneId),
-                        myDataR.getPlane(aPlaneId));
+                        myDataR.getPlane(aPlaneId),
+                        theTiles, myFillFromRow, myFillFromRow + myFillRows);
         }
     }
     theQTexture.getBack(StGLQuadTexture::LEFT_TEXTURE).unbind(theCtx);
 
     myFillFromRow += myFillRows;
     if(myFillFromRow >= GLsizei(myDataL.getSizeY())
-    && (myDataR.isNull() || myFillFromRow >= GLsizei(myDataR.getSizeY()))) {
+    && (myDataR.isNull() || myIsRightRepeated || myFillFromRow >= GLsizei(myDataR.getSizeY()))) {
         if(!myDataL.isNull() && theQTexture.getBack(StGLQuadTexture::LEFT_TEXTURE).isValid()) {
             setupAttributes(theQTexture.getBack(StGLQuadTexture::LEFT_TEXTURE), myDataL);
         }
-        if(!myDataR.isNull() && theQTexture.getBack(StGLQuadTexture::RIGHT_TEXTURE).isValid()) {
+        if(!myDataR.isNull() && !myIsRightRepeated && theQTexture.getBack(StGLQuadTexture::RIGHT_TEXTURE).isValid()) {
             setupAttributes(theQTexture.getBack(StGLQuadTexture::RIGHT_TEXTURE), myDataR);
         }
 
@@ -805,3 +1588,25 @@ void StGLTextureData::getCopy(StImage* theDataL,
         theDataR->initCopy(myDataR, true);
     }
 }
+
+void StGLTextureData::fillTiles(StGLContext&            theCtx,
+                                StGLQuadTexture&        theQTexture,
+                                const StGLVisibleTiles& theTilesL,
+                                const StGLVisibleTiles& theTilesR) {
+    const StImage*          aData [2] = { &myDataL,   &myDataR   };
+    const StGLVisibleTiles* aTiles[2] = { &theTilesL, &theTilesR };
+    for(size_t aViewIter = 0; aViewIter < 2; ++aViewIter) {
+        StGLFrameTextures& aTextures = theQTexture.getFront(aViewIter == 0 ? StGLQuadTexture::LEFT_TEXTURE : StGLQuadTexture::RIGHT_TEXTURE);
+        if(!aTextures.isValid()
+        ||  aData[aViewIter]->isNull()
+        ||  aTiles[aViewIter]->isEmpty()) {
+            continue;
+        }
+        for(size_t aPlaneId = 0; aPlaneId < 4; ++aPlaneId) {
+            StGLFrameTexture& aTexture = aTextures.getPlane(aPlaneId);
+            fillTexture(theCtx, aTexture, aData[aViewIter]->getPlane(aPlaneId),
+                        *aTiles[aViewIter], 0, aTexture.getSizeY());
+        }
+    }
+    theQTexture.getFront(StGLQuadTexture::LEFT_TEXTURE).unbind(theCtx);
+}
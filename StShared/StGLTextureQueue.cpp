@@ -19,11 +19,17 @@ StGLTextureQueue::StGLTextureQueue(const size_t theQueueSizeMax)
   mySwapFBCount(0),
   myCurrSrcFormat(StFormat_Mono),
   myCurrPts(0.0),
+  myUploadTimeMs(0.0),
   myNewShotEvent(false),
   myIsInUpdTexture(false),
   myIsReadyToSwap(false),
+  myToSwapRight(true),
+  myToUploadRight(false),
   myToCompress(false),
+  myToCompact(false),
   myHasStream(false) {
+    // memory copying is bandwidth-bound, so there is no sense in using too many threads
+    myThreadPool = new StThreadPool(stMin(StThread::countLogicalProcessors(), 4));
     ST_ASSERT(myQueueSizeMax >= 2, "StGLTextureQueue() - queue size limit should be >= 2");
 
     // we create 'empty' queue
@@ -49,13 +55,18 @@ void StGLTextureQueue::setCompressMemory(const bool theToCompress) {
     myToCompress = theToCompress;
 }
 
+void StGLTextureQueue::setCompactStorage(const bool theToCompact) {
+    myToCompact = theToCompact;
+}
+
 // this function called ONLY from image thread
 bool StGLTextureQueue::push(const StImage&     theSrcDataLeft,
                             const StImage&     theSrcDataRight,
                             const StHandle<StStereoParams>& theStParams,
                             const StFormat     theSrcFormat,
                             const StCubemap    theSrcCubemap,
-                            const double       theSrcPTS) {
+                            const double       theSrcPTS,
+                            const bool         theIsRightRepeated) {
     if(isFull()) {
         return false;
     }
@@ -63,13 +74,20 @@ bool StGLTextureQueue::push(const StImage&     theSrcDataLeft,
     myMutexPush.lock();
     myDataBack = isEmpty() ? myDataFront : myDataBack->getNext();
 
+    // frame with the right view to repeat might have been removed by clear()
+    const bool isRightRepeated = theIsRightRepeated && !myToUploadRight;
+    myToUploadRight = false;
+
     myDataBack->updateData(myDeviceCaps,
                            theSrcDataLeft,
                            theSrcDataRight,
                            theStParams,
                            theSrcFormat,
                            theSrcCubemap,
-                           theSrcPTS);
+                           theSrcPTS,
+                           myThreadPool,
+                           myToCompact,
+                           isRightRepeated);
     myMutexSrcFormat.lock();
         myCurrSrcFormat = myDataBack->getSourceFormat();
     myMutexSrcFormat.unlock();
@@ -92,7 +110,11 @@ int StGLTextureQueue::swapFBOnReady(StGLContext& theCtx) {
         --mySwapFBCount;
         mySwapFBMutex.unlock();
 
-        myQTexture.swapFB();
+        myQTexture.swapFB(myToSwapRight);
+        myFrontTiles[StGLQuadTexture::LEFT_TEXTURE] = myBackTiles[StGLQuadTexture::LEFT_TEXTURE];
+        if(myToSwapRight) {
+            myFrontTiles[StGLQuadTexture::RIGHT_TEXTURE] = myBackTiles[StGLQuadTexture::RIGHT_TEXTURE];
+        }
         if(myToCompress) {
             myQTexture.getBack(StGLQuadTexture::LEFT_TEXTURE ).release(theCtx);
             myQTexture.getBack(StGLQuadTexture::RIGHT_TEXTURE).release(theCtx);
@@ -124,6 +146,23 @@ bool StGLTextureQueue::stglUpdateStTextures(StGLContext& theCtx) {
         // check event from video thread
         if(!isEmpty()) {
             myIsInUpdTexture = true;
+            // memory is released right after upload in compressed mode, thus invisible regions can not be uploaded later
+            StGLVisibleTiles aTiles = myToCompress ? StGLVisibleTiles(true) : myVisibleTiles;
+
+            // visible region is dilated by one tile to cover view rotation until the next frame;
+            // when it has moved further, regions displayed from partially uploaded frames are behind -
+            // upload the whole frame instead of leaving stale tiles on the screen
+            StGLVisibleTiles aReachable = myPrevTiles;
+            aReachable.dilate();
+            if(!aTiles.subtracted(aReachable).isEmpty()) {
+                aTiles.setAll(true);
+            }
+            myPrevTiles = myVisibleTiles;
+
+            myBackTiles[StGLQuadTexture::LEFT_TEXTURE] = aTiles;
+            if(!myDataFront->isRightRepeated()) {
+                myBackTiles[StGLQuadTexture::RIGHT_TEXTURE] = aTiles;
+            }
         }
     } else if(isEmpty()) {
         // if we in texture update sequence - check queue not emptied!
@@ -132,13 +171,23 @@ bool StGLTextureQueue::stglUpdateStTextures(StGLContext& theCtx) {
 
     // still nothing to update? so return
     if(!myIsInUpdTexture) {
+        stglUpdateVisibleTiles(theCtx);
         myMutexPop.unlock();
         return aSwapState == SWAPONREADY_SWAPPED;
     }
 
-    if(!theCtx.isBound()
-    || myDataFront->fillTexture(theCtx, myQTexture)) {
+    // large frames might be uploaded within several steps
+    StTimer anUploadTimer(true);
+    const bool isUploaded = !theCtx.isBound()
+                         || myDataFront->fillTexture(theCtx, myQTexture, myBackTiles[StGLQuadTexture::LEFT_TEXTURE]);
+    myUploadTimeMs += anUploadTimer.getElapsedTimeInMilliSec();
+    if(isUploaded) {
+        if(theCtx.isBound()) {
+            myStatistics.addUploadTime(myUploadTimeMs);
+        }
+        myUploadTimeMs = 0.0;
         myIsReadyToSwap = true;
+        myToSwapRight   = !myDataFront->isRightRepeated();
         myMutexSize.lock();
             myCurrPts   = myDataFront->getPTS();
             myDataSnap  = myDataFront; myNewShotEvent.set();
@@ -159,6 +208,28 @@ bool StGLTextureQueue::stglUpdateStTextures(StGLContext& theCtx) {
     return (aSwapState == SWAPONREADY_SWAPPED || isAlreadySwapped);
 }
 
+void StGLTextureQueue::stglUpdateVisibleTiles(StGLContext& theCtx) {
+    if(myDataSnap == NULL
+    || myIsReadyToSwap
+    || myToCompress
+    || !theCtx.isBound()) {
+        return;
+    }
+
+    // the frame is not replaced by new one (e.g. on pause) - upload regions which became visible;
+    // displayed frame is safe to access since queue is considered full before push() reaches it
+    const StGLVisibleTiles aMissingL = myVisibleTiles.subtracted(myFrontTiles[StGLQuadTexture::LEFT_TEXTURE]);
+    const StGLVisibleTiles aMissingR = myVisibleTiles.subtracted(myFrontTiles[StGLQuadTexture::RIGHT_TEXTURE]);
+    if(aMissingL.isEmpty()
+    && aMissingR.isEmpty()) {
+        return;
+    }
+
+    myDataSnap->fillTiles(theCtx, myQTexture, aMissingL, aMissingR);
+    myFrontTiles[StGLQuadTexture::LEFT_TEXTURE] .add(aMissingL);
+    myFrontTiles[StGLQuadTexture::RIGHT_TEXTURE].add(aMissingR);
+}
+
 void StGLTextureQueue::clear() {
     myMutexPop.lock();
     myMutexPush.lock();
@@ -180,10 +251,15 @@ void StGLTextureQueue::clear() {
         myIsReadyToSwap = false; // invalidate currently uploaded image in back buffer
         // empty texture update sequence
         myIsInUpdTexture = false;
+        myUploadTimeMs   = 0.0;
+        // the next frame might repeat right view which has been never shown
+        myToUploadRight  = true;
     mySwapFBMutex.unlock();
     myMutexSize.unlock();
     myMutexPush.unlock();
     myMutexPop.unlock();
+
+    setPyramid(StHandle<StImagePyramid>(), StHandle<StStereoParams>());
 }
 
 void StGLTextureQueue::drop(const size_t theCount) {
@@ -200,16 +276,24 @@ void StGLTextureQueue::drop(const size_t theCount) {
         size_t decr = (theCount < myQueueSize) ? theCount : (myQueueSize - 1);
 
         // decrease StStereoSource counters
+        bool hasDroppedRight = false;
         for(size_t i = 0; i < decr; ++i, myDataFront = myDataFront->getNext()) {
+            hasDroppedRight = hasDroppedRight || !myDataFront->isRightRepeated();
             myDataFront->resetStParams();
         }
+        if(hasDroppedRight) {
+            // the first remaining frame should upload the right view instead of repeating the dropped one
+            myDataFront->resetRightRepeated();
+        }
         // reset queue
         myQueueSize -= decr;
         // empty texture update sequence
         myIsInUpdTexture = false;
+        myUploadTimeMs   = 0.0;
     myMutexSize.unlock();
     myMutexPush.unlock();
     myMutexPop.unlock();
+    myStatistics.addDropped(decr);
 }
 
 int StGLTextureQueue::getSnapshot(StImage* theOutDataLeft,
@@ -0,0 +1,157 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file license-boost.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+
+#include <StGLStereo/StGLTileCache.h>
+
+#include <StGLCore/StGLCore20.h>
+#include <StGL/StGLContext.h>
+
+StGLTileCache::StGLTileCache(const size_t theNbTilesMax,
+                             const size_t theNbUploadsMax)
+: myNbTilesMax(stMax(theNbTilesMax, size_t(1))),
+  myNbUploadsMax(stMax(theNbUploadsMax, size_t(1))),
+  myNbUploads(0),
+  myFrameIndex(0),
+  myHasPending(false) {
+    //
+}
+
+StGLTileCache::~StGLTileCache() {
+    //
+}
+
+void StGLTileCache::release(StGLContext& theCtx) {
+    for(size_t aTileIter = 0; aTileIter < myTiles.size(); ++aTileIter) {
+        myTiles[aTileIter].Texture->release(theCtx);
+    }
+    myTiles.clear();
+    myPyramid.nullify();
+    myStaging.nullify();
+}
+
+void StGLTileCache::setPyramid(const StHandle<StImagePyramid>& thePyramid) {
+    if(myPyramid == thePyramid) {
+        return;
+    }
+
+    myPyramid    = thePyramid;
+    myHasPending = false;
+    for(size_t aTileIter = 0; aTileIter < myTiles.size(); ++aTileIter) {
+        myTiles[aTileIter].IsValid = false;
+    }
+    if(myPyramid.isNull()) {
+        myStaging.nullify();
+    }
+}
+
+void StGLTileCache::beginFrame() {
+    ++myFrameIndex;
+    myNbUploads  = 0;
+    myHasPending = false;
+}
+
+StGLTexture* StGLTileCache::getTile(StGLContext& theCtx,
+                                    const size_t theLevel,
+                                    const size_t theTileX,
+                                    const size_t theTileY,
+                                    const bool   theIsLinear,
+                                    StGLVec4&    theDataRect) {
+    if(myPyramid.isNull()) {
+        return NULL;
+    }
+
+    // lookup resident tile and the eviction candidate at once
+    Tile*  aTile    = NULL;
+    size_t anOldest = size_t(-1);
+    for(size_t aTileIter = 0; aTileIter < myTiles.size(); ++aTileIter) {
+        Tile& aCand = myTiles[aTileIter];
+        if(aCand.IsValid
+        && aCand.Level == theLevel
+        && aCand.TileX == theTileX
+        && aCand.TileY == theTileY) {
+            aTile = &aCand;
+            anOldest = size_t(-1);
+            break;
+        }
+        if(anOldest == size_t(-1)
+        || !aCand.IsValid
+        || (myTiles[anOldest].IsValid && aCand.LastUsed < myTiles[anOldest].LastUsed)) {
+            anOldest = aTileIter;
+        }
+    }
+
+    if(aTile == NULL) {
+        if(myNbUploads >= myNbUploadsMax) {
+            myHasPending = true;
+            return NULL;
+        }
+
+        if(myTiles.size() < myNbTilesMax) {
+            myTiles.push_back(Tile());
+            aTile = &myTiles.back();
+            aTile->Texture = new StGLTexture();
+        } else {
+            aTile = &myTiles[anOldest];
+            if(aTile->IsValid && aTile->LastUsed == myFrameIndex) {
+                // cache is too small to hold all visible tiles
+                myHasPending = true;
+                return NULL;
+            }
+        }
+
+        ++myNbUploads;
+        aTile->IsValid = false;
+        size_t aBorderL = 0, aBorderT = 0;
+        if(!myPyramid->copyTile(theLevel, theTileX, theTileY, myStaging, aBorderL, aBorderT)) {
+            return NULL;
+        }
+
+        const GLsizei aTexSize = GLsizei(myPyramid->getTileSize() + 2);
+        if(!aTile->Texture->isValid()
+         || aTile->Texture->getSizeX() != aTexSize) {
+            aTile->Texture->release(theCtx);
+            if(!aTile->Texture->initTrash(theCtx, aTexSize, aTexSize)) {
+                return NULL;
+            }
+        }
+        if(!aTile->Texture->fillPatch(theCtx, myStaging, GL_TEXTURE_2D, 0, 0)) {
+            aTile->Texture->unbind(theCtx);
+            return NULL;
+        }
+        aTile->Texture->unbind(theCtx);
+
+        const StImagePlane& aLevel = myPyramid->getLevel(theLevel);
+        const size_t aCoreX0 = theTileX * myPyramid->getTileSize();
+        const size_t aCoreY0 = theTileY * myPyramid->getTileSize();
+        const size_t aCoreX1 = stMin(aCoreX0 + myPyramid->getTileSize(), aLevel.getSizeX());
+        const size_t aCoreY1 = stMin(aCoreY0 + myPyramid->getTileSize(), aLevel.getSizeY());
+        aTile->Level   = theLevel;
+        aTile->TileX   = theTileX;
+        aTile->TileY   = theTileY;
+        aTile->CoreL   = GLfloat(aBorderL);
+        aTile->CoreT   = GLfloat(aBorderT);
+        aTile->CoreR   = GLfloat(aBorderL + aCoreX1 - aCoreX0);
+        aTile->CoreB   = GLfloat(aBorderT + aCoreY1 - aCoreY0);
+        aTile->HasR    = aCoreX1 < aLevel.getSizeX();
+        aTile->HasB    = aCoreY1 < aLevel.getSizeY();
+        aTile->IsValid = true;
+    }
+
+    aTile->LastUsed = myFrameIndex;
+
+    // with linear filter, keep half-texel margin at image borders (no neighbor data there)
+    const GLfloat aTexSizeInv = 1.0f / GLfloat(aTile->Texture->getSizeX());
+    const GLfloat aHalf       = theIsLinear ? 0.5f : 0.0f;
+    const GLfloat aLeft   = aTile->CoreL + (aTile->CoreL > 0.0f ? 0.0f : aHalf);
+    const GLfloat aTop    = aTile->CoreT + (aTile->CoreT > 0.0f ? 0.0f : aHalf);
+    const GLfloat aRight  = aTile->CoreR - (aTile->HasR ? 0.0f : aHalf);
+    const GLfloat aBottom = aTile->CoreB - (aTile->HasB ? 0.0f : aHalf);
+    theDataRect = StGLVec4(aLeft * aTexSizeInv, aTop * aTexSizeInv,
+                           (aRight - aLeft) * aTexSizeInv, (aBottom - aTop) * aTexSizeInv);
+    return aTile->Texture.access();
+}
@@ -18,6 +18,9 @@ StString StImage::formatImgColorModel(ImgColorModel theColorModel) {
         case ImgColor_CMYK:    return "ImgColor_CMYK";
         case ImgColor_HSV:     return "ImgColor_HSV";
         case ImgColor_HSL:     return "ImgColor_HSL";
+        case ImgColor_YUVA:    return "ImgColor_YUVA";
+        case ImgColor_GBR:     return "ImgColor_GBR";
+        case ImgColor_GBRA:    return "ImgColor_GBRA";
         default:               return "ImgColor_UNKNOWN";
     }
 #else
@@ -29,6 +32,9 @@ StString StImage::formatImgColorModel(ImgColorModel theColorModel) {
         case ImgColor_CMYK:    return "CMYK";
         case ImgColor_HSV:     return "HSV";
         case ImgColor_HSL:     return "HSL";
+        case ImgColor_YUVA:    return "YUVA";
+        case ImgColor_GBR:     return "GBR";
+        case ImgColor_GBRA:    return "GBRA";
         default:               return StString("UNKNOWN[") + theColorModel + "]";
     }
 #endif
@@ -194,13 +200,14 @@ bool StImage::initSideBySide(const StImage& theImageL,
                              const StImage& theImageR,
                              const int theSeparationDx,
                              const int theSeparationDy) {
-    const bool isYUV = theImageL.getColorModel() == StImage::ImgColor_YUV;
+    const bool isYUV = theImageL.getColorModel() == StImage::ImgColor_YUV
+                    || theImageL.getColorModel() == StImage::ImgColor_YUVA;
     for(size_t aPlaneId = 0; aPlaneId < 4; ++aPlaneId) {
         float aScaleX = (theImageL.getPlane(aPlaneId).getSizeX() > 0) ? theImageL.getScaleFactorX(aPlaneId) : 1.0f;
         float aScaleY = (theImageL.getPlane(aPlaneId).getSizeY() > 0) ? theImageL.getScaleFactorY(aPlaneId) : 1.0f;
 
         // setup black color per plane
-        int aValue = (isYUV && aPlaneId != 0) ? 128 : 0;
+        int aValue = (isYUV && (aPlaneId == 1 || aPlaneId == 2)) ? 128 : 0;
         if(!changePlane(aPlaneId).initSideBySide(theImageL.getPlane(aPlaneId),
                                                  theImageR.getPlane(aPlaneId),
                                                  int(aScaleX * theSeparationDx),
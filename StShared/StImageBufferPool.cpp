@@ -0,0 +1,210 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file license-boost.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+
+#include <StImage/StImageBufferPool.h>
+
+#include <StStrings/StLogger.h>
+
+#if defined(__linux__) && !defined(__ANDROID__)
+    #include <sys/mman.h>
+#endif
+
+namespace {
+
+    /**
+     * Buffer header preceding the data, keeps the data aligned.
+     */
+    struct StBufferHeader {
+        size_t Bytes; //!< size class of the buffer
+    };
+
+    static const size_t THE_HEADER_SIZE = 64;
+
+    /**
+     * Smaller buffers are not cached.
+     */
+    static const size_t THE_MIN_POOLED_SIZE = 64 * 1024;
+
+    /**
+     * Buffers of this size and greater are aligned to huge pages.
+     */
+    static const size_t THE_HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    /**
+     * Default limit of cached memory.
+     */
+#if defined(__ANDROID__)
+    static const size_t THE_DEF_MAX_FREE = 64  * 1024 * 1024;
+#else
+    static const size_t THE_DEF_MAX_FREE = 256 * 1024 * 1024;
+#endif
+
+    /**
+     * Round the requested size up to the size class (4 classes per power of two).
+     */
+    inline size_t sizeClass(const size_t theNbBytes) {
+        if(theNbBytes < THE_MIN_POOLED_SIZE) {
+            return (stMax(theNbBytes, size_t(1)) + THE_HEADER_SIZE - 1) & ~(THE_HEADER_SIZE - 1);
+        }
+
+        size_t aBase = THE_MIN_POOLED_SIZE;
+        for(; (aBase << 1) != 0 && (aBase << 1) <= theNbBytes; aBase <<= 1) {}
+        const size_t aStep = aBase >> 2;
+        return (theNbBytes + aStep - 1) & ~(aStep - 1);
+    }
+
+    /**
+     * Allocate the buffer within the system heap.
+     */
+    inline void* allocateRaw(const size_t theNbBytes) {
+    #if defined(__linux__) && !defined(__ANDROID__)
+        if(theNbBytes >= THE_HUGE_PAGE_SIZE) {
+            void* aRaw = stMemAllocAligned(THE_HEADER_SIZE + theNbBytes, THE_HUGE_PAGE_SIZE);
+        #if defined(MADV_HUGEPAGE)
+            if(aRaw != NULL) {
+                // ask kernel to back the buffer with transparent huge pages
+                ::madvise(aRaw, (THE_HEADER_SIZE + theNbBytes) & ~(THE_HUGE_PAGE_SIZE - 1), MADV_HUGEPAGE);
+            }
+        #endif
+            return aRaw;
+        }
+    #endif
+        return stMemAllocAligned(THE_HEADER_SIZE + theNbBytes, THE_HEADER_SIZE);
+    }
+
+}
+
+StImageBufferPool& StImageBufferPool::GetDefault() {
+    // global instance is never destroyed,
+    // so that images within other static objects can be released at any moment
+    static StImageBufferPool* THE_DEFAULT_POOL = new StImageBufferPool(THE_DEF_MAX_FREE);
+    return *THE_DEFAULT_POOL;
+}
+
+StImageBufferPool::StImageBufferPool(const size_t theMaxFreeBytes)
+: myMaxFreeBytes(theMaxFreeBytes) {
+    //
+}
+
+StImageBufferPool::~StImageBufferPool() {
+    trim(0);
+    if(myStats.NbUsed != 0) {
+        ST_DEBUG_LOG("StImageBufferPool, destroyed while " + myStats.NbUsed + " buffers are still in use");
+    }
+}
+
+void* StImageBufferPool::allocate(const size_t theNbBytes) {
+    const size_t aBytes = sizeClass(theNbBytes);
+    void* aRaw = NULL;
+    if(aBytes >= THE_MIN_POOLED_SIZE) {
+        StMutexAuto aLock(myMutex);
+        // the most recently released buffer is reused first
+        for(size_t anIter = myFreeList.size(); anIter > 0; --anIter) {
+            const FreeBuffer& aBuffer = myFreeList[anIter - 1];
+            if(aBuffer.Bytes == aBytes) {
+                aRaw = aBuffer.Data;
+                myFreeList.erase(myFreeList.begin() + (anIter - 1));
+                myStats.NbFree    -= 1;
+                myStats.BytesFree -= aBytes;
+                myStats.NbUsed    += 1;
+                myStats.BytesUsed += aBytes;
+                myStats.NbHits    += 1;
+                return (stUByte_t* )aRaw + THE_HEADER_SIZE;
+            }
+        }
+    }
+
+    aRaw = allocateRaw(aBytes);
+    if(aRaw == NULL) {
+        // release cached memory and try again
+        trim(0);
+        aRaw = allocateRaw(aBytes);
+        if(aRaw == NULL) {
+            ST_ERROR_LOG("StImageBufferPool, unable to allocate " + aBytes + " bytes");
+            return NULL;
+        }
+    }
+
+    ((StBufferHeader* )aRaw)->Bytes = aBytes;
+    {
+        StMutexAuto aLock(myMutex);
+        myStats.NbUsed    += 1;
+        myStats.BytesUsed += aBytes;
+        myStats.NbMisses  += 1;
+        myStats.BytesPeak  = stMax(myStats.BytesPeak, myStats.BytesUsed + myStats.BytesFree);
+    }
+    return (stUByte_t* )aRaw + THE_HEADER_SIZE;
+}
+
+void StImageBufferPool::release(void* theBuffer) {
+    if(theBuffer == NULL) {
+        return;
+    }
+
+    FreeBuffer aBuffer;
+    aBuffer.Data  = (stUByte_t* )theBuffer - THE_HEADER_SIZE;
+    aBuffer.Bytes = ((StBufferHeader* )aBuffer.Data)->Bytes;
+    {
+        StMutexAuto aLock(myMutex);
+        myStats.NbUsed    -= 1;
+        myStats.BytesUsed -= aBuffer.Bytes;
+        if(aBuffer.Bytes >= THE_MIN_POOLED_SIZE
+        && aBuffer.Bytes <= myMaxFreeBytes) {
+            myFreeList.push_back(aBuffer);
+            myStats.NbFree    += 1;
+            myStats.BytesFree += aBuffer.Bytes;
+            aBuffer.Data = NULL;
+        }
+    }
+
+    if(aBuffer.Data != NULL) {
+        stMemFreeAligned(aBuffer.Data);
+    } else {
+        trim(getMaxFreeBytes());
+    }
+}
+
+void StImageBufferPool::trim(const size_t theMaxFreeBytes) {
+    std::vector<FreeBuffer> aBuffers;
+    {
+        StMutexAuto aLock(myMutex);
+        size_t aNbRemoved = 0;
+        for(; aNbRemoved < myFreeList.size() && myStats.BytesFree > theMaxFreeBytes; ++aNbRemoved) {
+            myStats.NbFree    -= 1;
+            myStats.BytesFree -= myFreeList[aNbRemoved].Bytes;
+        }
+        if(aNbRemoved == 0) {
+            return;
+        }
+        aBuffers.assign(myFreeList.begin(), myFreeList.begin() + aNbRemoved);
+        myFreeList.erase(myFreeList.begin(), myFreeList.begin() + aNbRemoved);
+    }
+
+    // return memory to the system outside the lock
+    for(size_t anIter = 0; anIter < aBuffers.size(); ++anIter) {
+        stMemFreeAligned(aBuffers[anIter].Data);
+    }
+}
+
+size_t StImageBufferPool::getMaxFreeBytes() const {
+    StMutexAuto aLock(myMutex);
+    return myMaxFreeBytes;
+}
+
+void StImageBufferPool::setMaxFreeBytes(const size_t theMaxFreeBytes) {
+    {
+        StMutexAuto aLock(myMutex);
+        myMaxFreeBytes = theMaxFreeBytes;
+    }
+    trim(theMaxFreeBytes);
+}
+
+StImageBufferPool::Statistics StImageBufferPool::getStatistics() const {
+    StMutexAuto aLock(myMutex);
+    return myStats;
+}
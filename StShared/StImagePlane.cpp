@@ -1,5 +1,5 @@
 /**
- * Copyright © 2010-2015 Kirill Gavrilov <kirill@sview.ru>
+ * Copyright © 2010-2017 Kirill Gavrilov <kirill@sview.ru>
  *
  * Distributed under the Boost Software License, Version 1.0.
  * See accompanying file license-boost.txt or copy at
@@ -7,6 +7,7 @@
  */
 
 #include <StImage/StImagePlane.h>
+#include <StImage/StImageBufferPool.h>
 
 StString StImagePlane::formatImgFormat(ImgFormat theImgFormat) {
     switch(theImgFormat) {
@@ -26,6 +27,10 @@ StString StImagePlane::formatImgFormat(ImgFormat theImgFormat) {
         case ImgRGBAF:   return "ImgRGBAF";
         case ImgBGRAF:   return "ImgBGRAF";
         case ImgUV:      return "ImgUV";
+        case ImgRGBHalf: return "ImgRGBHalf";
+        case ImgRGBAHalf:return "ImgRGBAHalf";
+        case ImgRGB10A2: return "ImgRGB10A2";
+        case ImgUV16:    return "ImgUV16";
         case ImgUNKNOWN:
         default:         return "ImgUNKNOWN";
     }
@@ -48,50 +53,50 @@ StImagePlane::~StImagePlane() {
     nullify();
 }
 
-void StImagePlane::setFormat(StImagePlane::ImgFormat thePixelFormat) {
-    myImgFormat = thePixelFormat;
-    switch(myImgFormat) {
+size_t StImagePlane::getSizePixelBytes(StImagePlane::ImgFormat theImgFormat) {
+    switch(theImgFormat) {
         case ImgGrayF:
-            mySizeBPP = sizeof(GLfloat);
-            break;
+            return sizeof(GLfloat);
         case ImgRGBAF:
         case ImgBGRAF:
-            mySizeBPP = sizeof(GLfloat) * 4;
-            break;
+            return sizeof(GLfloat) * 4;
         case ImgRGBF:
         case ImgBGRF:
-            mySizeBPP = sizeof(GLfloat) * 3;
-            break;
+            return sizeof(GLfloat) * 3;
+        case ImgRGBAHalf:
+            return 8;
+        case ImgRGBHalf:
+            return 6;
         case ImgRGBA:
         case ImgBGRA:
-            mySizeBPP = 4;
-            break;
+            return 4;
         case ImgRGBA64:
-            mySizeBPP = 8;
-            break;
+            return 8;
         case ImgRGB32:
         case ImgBGR32:
-            mySizeBPP = 4;
-            break;
+        case ImgRGB10A2:
+        case ImgUV16:
+            return 4;
         case ImgRGB48:
-            mySizeBPP = 6;
-            break;
+            return 6;
         case ImgRGB:
         case ImgBGR:
-            mySizeBPP = 3;
-            break;
+            return 3;
         case ImgGray16:
-            mySizeBPP = 2;
-            break;
+            return 2;
         case ImgUV:
-            mySizeBPP = 2;
-            break;
+            return 2;
         case ImgGray:
         default:
-            mySizeBPP = 1;
+            return 1;
     }
 }
 
+void StImagePlane::setFormat(StImagePlane::ImgFormat thePixelFormat) {
+    myImgFormat = thePixelFormat;
+    mySizeBPP   = getSizePixelBytes(thePixelFormat);
+}
+
 bool StImagePlane::initWrapper(StImagePlane::ImgFormat thePixelFormat,
                                GLubyte*      theDataPtr,
                                const size_t  theSizeX,
@@ -124,7 +129,7 @@ bool StImagePlane::initTrash(StImagePlane::ImgFormat thePixelFormat,
         // use argument only if it greater
         mySizeRowBytes = theSizeRowBytes;
     }
-    myDataPtr = stMemAllocAligned<GLubyte*>(getSizeBytes());
+    myDataPtr = (GLubyte* )StImageBufferPool::GetDefault().allocate(getSizeBytes());
     myIsOwnPointer = true;
     return myDataPtr != NULL;
 }
@@ -212,6 +217,47 @@ bool StImagePlane::initSideBySide(const StImagePlane& theImageL,
     return true;
 }
 
+bool StImagePlane::initFromPalette(const GLubyte*  theIndices,
+                                   const size_t    theIndicesRowBytes,
+                                   const uint32_t* thePalette,
+                                   const size_t    theSizeX,
+                                   const size_t    theSizeY) {
+    if(theIndices == NULL
+    || thePalette == NULL
+    || !initTrash(StImagePlane::ImgRGBA, theSizeX, theSizeY)) {
+        return false;
+    }
+
+    // convert palette into RGBA byte order once, so that each pixel becomes a single 32-bit lookup
+    uint32_t aTable[256];
+    for(size_t aColorIter = 0; aColorIter < 256; ++aColorIter) {
+        const uint32_t anArgb = thePalette[aColorIter];
+        const GLubyte  aRgba[4] = {
+            GLubyte((anArgb >> 16) & 0xFF),
+            GLubyte((anArgb >>  8) & 0xFF),
+            GLubyte( anArgb        & 0xFF),
+            GLubyte((anArgb >> 24) & 0xFF)
+        };
+        stMemCpy(&aTable[aColorIter], aRgba, 4);
+    }
+
+    for(size_t aRow = 0; aRow < theSizeY; ++aRow) {
+        const GLubyte* aSrc = theIndices + aRow * theIndicesRowBytes;
+        uint32_t*      aDst = (uint32_t* )changeData(aRow, 0);
+        size_t aCol = 0;
+        for(; aCol + 4 <= theSizeX; aCol += 4) {
+            aDst[aCol    ] = aTable[aSrc[aCol    ]];
+            aDst[aCol + 1] = aTable[aSrc[aCol + 1]];
+            aDst[aCol + 2] = aTable[aSrc[aCol + 2]];
+            aDst[aCol + 3] = aTable[aSrc[aCol + 3]];
+        }
+        for(; aCol < theSizeX; ++aCol) {
+            aDst[aCol] = aTable[aSrc[aCol]];
+        }
+    }
+    return true;
+}
+
 bool StImagePlane::fill(const StImagePlane& theCopy,
                         const bool          theIsCompact) {
     if(getSizeY()        != theCopy.getSizeY()
@@ -231,7 +277,7 @@ bool StImagePlane::fill(const StImagePlane& theCopy,
 
 void StImagePlane::nullify(StImagePlane::ImgFormat thePixelFormat) {
     if(myIsOwnPointer && (myDataPtr != NULL)) {
-        stMemFreeAligned(myDataPtr);
+        StImageBufferPool::GetDefault().release(myDataPtr);
     }
     myDataPtr = NULL;
     myIsOwnPointer = true;
@@ -0,0 +1,166 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file license-boost.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+
+#include <StImage/StImagePyramid.h>
+
+bool StImagePyramid::isSupportedFormat(const StImagePlane::ImgFormat theFormat) {
+    switch(theFormat) {
+        case StImagePlane::ImgRGB:
+        case StImagePlane::ImgBGR:
+        case StImagePlane::ImgRGB32:
+        case StImagePlane::ImgBGR32:
+        case StImagePlane::ImgRGBA:
+        case StImagePlane::ImgBGRA:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool StImagePyramid::isSupported(const StImage& theImage) {
+    return (theImage.getColorModel() == StImage::ImgColor_RGB
+         || theImage.getColorModel() == StImage::ImgColor_RGBA)
+        && !theImage.isNull()
+        &&  theImage.getPlane(1).isNull()
+        &&  isSupportedFormat(theImage.getPlane(0).getFormat());
+}
+
+StImagePyramid::StImagePyramid()
+: myColorModel(StImage::ImgColor_RGB),
+  myTileSize(512) {
+    //
+}
+
+StImagePyramid::~StImagePyramid() {
+    nullify();
+}
+
+void StImagePyramid::nullify() {
+    myLevels.clear();
+    myImage.nullify();
+}
+
+bool StImagePyramid::init(const StHandle<StImage>& theImage,
+                          const size_t             theMaxSizeX,
+                          const size_t             theMaxSizeY,
+                          const size_t             theTileSize) {
+    nullify();
+    if(theImage.isNull()
+    || theTileSize == 0
+    || !isSupported(*theImage)) {
+        return false;
+    }
+
+    myImage      = theImage;
+    myColorModel = theImage->getColorModel();
+    myTileSize   = theTileSize;
+
+    StHandle<StImagePlane> aBase = new StImagePlane();
+    aBase->initWrapper(theImage->getPlane(0));
+    myLevels.push_back(aBase);
+    for(;;) {
+        const StImagePlane& aPrev = *myLevels.back();
+        if(aPrev.getSizeX() <= theMaxSizeX
+        && aPrev.getSizeY() <= theMaxSizeY) {
+            break;
+        }
+
+        StHandle<StImagePlane> aLevel = new StImagePlane();
+        if(!aLevel->initTrash(aPrev.getFormat(),
+                              stMax((aPrev.getSizeX() + 1) / 2, size_t(1)),
+                              stMax((aPrev.getSizeY() + 1) / 2, size_t(1)))) {
+            ST_ERROR_LOG("StImagePyramid, unable to allocate level " + myLevels.size());
+            nullify();
+            return false;
+        }
+        downsample(aPrev, *aLevel);
+        myLevels.push_back(aLevel);
+    }
+
+    // the last level is never drawn with tiles - lower resolution texture is used instead
+    if(myLevels.size() < 2) {
+        nullify();
+        return false;
+    }
+    return true;
+}
+
+void StImagePyramid::downsample(const StImagePlane& theSrc,
+                                StImagePlane&       theDst) {
+    const size_t aPixelBytes = theSrc.getSizePixelBytes();
+    const size_t aSrcLastX   = theSrc.getSizeX() - 1;
+    const size_t aSrcLastY   = theSrc.getSizeY() - 1;
+    for(size_t aRow = 0; aRow < theDst.getSizeY(); ++aRow) {
+        // downsampled level is always top-down
+        size_t aRow0 = stMin(aRow * 2,     aSrcLastY);
+        size_t aRow1 = stMin(aRow * 2 + 1, aSrcLastY);
+        if(!theSrc.isTopDown()) {
+            aRow0 = aSrcLastY - aRow0;
+            aRow1 = aSrcLastY - aRow1;
+        }
+
+        const GLubyte* aSrcRow0 = theSrc.getData(aRow0, 0);
+        const GLubyte* aSrcRow1 = theSrc.getData(aRow1, 0);
+        GLubyte*       aDstRow  = theDst.changeData(aRow, 0);
+        for(size_t aCol = 0; aCol < theDst.getSizeX(); ++aCol) {
+            const size_t aCol0 = stMin(aCol * 2,     aSrcLastX) * aPixelBytes;
+            const size_t aCol1 = stMin(aCol * 2 + 1, aSrcLastX) * aPixelBytes;
+            GLubyte* aDst = aDstRow + aCol * aPixelBytes;
+            for(size_t aComp = 0; aComp < aPixelBytes; ++aComp) {
+                aDst[aComp] = GLubyte((unsigned(aSrcRow0[aCol0 + aComp]) + unsigned(aSrcRow0[aCol1 + aComp])
+                                     + unsigned(aSrcRow1[aCol0 + aComp]) + unsigned(aSrcRow1[aCol1 + aComp]) + 2) / 4);
+            }
+        }
+    }
+}
+
+bool StImagePyramid::copyTile(const size_t  theLevel,
+                              const size_t  theTileX,
+                              const size_t  theTileY,
+                              StImagePlane& theTile,
+                              size_t&       theBorderL,
+                              size_t&       theBorderT) const {
+    if(theLevel >= myLevels.size()) {
+        return false;
+    }
+
+    const StImagePlane& aLevel = getLevel(theLevel);
+    const size_t aCoreX0 = theTileX * myTileSize;
+    const size_t aCoreY0 = theTileY * myTileSize;
+    if(aCoreX0 >= aLevel.getSizeX()
+    || aCoreY0 >= aLevel.getSizeY()) {
+        return false;
+    }
+
+    const size_t aCoreX1 = stMin(aCoreX0 + myTileSize, aLevel.getSizeX());
+    const size_t aCoreY1 = stMin(aCoreY0 + myTileSize, aLevel.getSizeY());
+    theBorderL = aCoreX0 > 0 ? 1 : 0;
+    theBorderT = aCoreY0 > 0 ? 1 : 0;
+    const size_t aX0 = aCoreX0 - theBorderL;
+    const size_t aY0 = aCoreY0 - theBorderT;
+    const size_t aX1 = stMin(aCoreX1 + 1, aLevel.getSizeX());
+    const size_t aY1 = stMin(aCoreY1 + 1, aLevel.getSizeY());
+    const size_t aSizeX = aX1 - aX0;
+    const size_t aSizeY = aY1 - aY0;
+    if(theTile.isNull()
+    || theTile.getFormat() != aLevel.getFormat()
+    || theTile.getSizeX()  != aSizeX
+    || theTile.getSizeY()  != aSizeY) {
+        if(!theTile.initTrash(aLevel.getFormat(), aSizeX, aSizeY)) {
+            return false;
+        }
+    }
+
+    const size_t aRowBytes = aSizeX * aLevel.getSizePixelBytes();
+    const size_t aLastRow  = aLevel.getSizeY() - 1;
+    for(size_t aRow = 0; aRow < aSizeY; ++aRow) {
+        const size_t aSrcRow = aLevel.isTopDown() ? (aY0 + aRow) : (aLastRow - aY0 - aRow);
+        stMemCpy(theTile.changeData(aRow, 0), aLevel.getData(aSrcRow, aX0), aRowBytes);
+    }
+    return true;
+}
@@ -142,7 +142,8 @@ namespace {
 StJpegParser::StJpegParser(const StCString& theFilePath)
 : StRawFile(theFilePath),
   myImages(NULL),
-  myStFormat(StFormat_AUTO) {
+  myStFormat(StFormat_AUTO),
+  myToStopAtSos(false) {
     stMemZero(myOffsets, sizeof(myOffsets));
 #if !defined(_MSC_VER)
     (void )markerString;
@@ -158,6 +159,7 @@ void StJpegParser::reset() {
     myImages.nullify();
     myComment.clear();
     myStFormat = StFormat_AUTO;
+    myToStopAtSos = false;
     myLength = 0;
     stMemZero(myOffsets, sizeof(myOffsets));
 }
@@ -174,6 +176,21 @@ bool StJpegParser::readFile(const StCString& theFilePath,
     return parse();
 }
 
+bool StJpegParser::readHeaders(const StCString& theFilePath,
+                               const int        theOpenedFd,
+                               const size_t     theReadMax) {
+    reset();
+    if(!StRawFile::readFile(theFilePath, theOpenedFd, theReadMax)) {
+        return false;
+    }
+
+    myLength = myBuffSize;
+    myToStopAtSos = true;
+    const bool isParsed = parse();
+    myToStopAtSos = false;
+    return isParsed;
+}
+
 bool StJpegParser::parse() {
     if(myBuffer == NULL) {
         return false;
@@ -183,6 +200,8 @@ bool StJpegParser::parse() {
     myImages = parseImage(++aCount, 1, myBuffer, false);
     if(myImages.isNull()) {
         return false;
+    } else if(myToStopAtSos) {
+        return true;
     }
 
     // continue reading the file (MPO may contains more than 1 image)
@@ -236,17 +255,27 @@ StHandle<StJpegParser::Image> StJpegParser::parseImage(const int      theImgCoun
     for(;;) {
         // search for the next marker in the file
         ++aData; // one byte forward
-        size_t aSkippedBytes = 0;
+        const unsigned char* aScanStart = aData;
         unsigned char aMarker = 0;
-        for(; aData < aDataEnd; ++aSkippedBytes, ++aData) {
-            aMarker = aData[0];
-            if(aData[-1] == 0xFF
-            && aMarker   != 0xFF
-            && aMarker   != 0x00) {
+        for(; aData < aDataEnd; ++aData) {
+            if(aData[-1] != 0xFF) {
+                // quickly skip entropy-coded data up to the next 0xFF byte
+                unsigned char* aNextFF = (unsigned char* )std::memchr(aData, 0xFF, size_t(aDataEnd - aData));
+                if(aNextFF == NULL
+                || aNextFF + 1 >= aDataEnd) {
+                    aData = myBuffer + myLength;
+                    break;
+                }
+                aData = aNextFF + 1;
+            }
+            if(aData[0] != 0xFF
+            && aData[0] != 0x00) {
+                aMarker = aData[0];
                 ++aData; // skip marker id byte
                 break;
             }
         }
+        const size_t aSkippedBytes = size_t(aData - aScanStart);
 
         //ST_DEBUG_LOG(" #" + theImgCount + "." + theDepth + " [" + markerString(aMarker) + "] at position " + size_t(aData - myBuffer) + " / " + myLength); ///
         if(aMarker == M_EOI) {
@@ -310,6 +339,14 @@ StHandle<StJpegParser::Image> StJpegParser::parseImage(const int      theImgCoun
             case M_SOS: {
                 // here the image data...
                 //ST_DEBUG_LOG("Jpeg, SOS at position " + size_t(aData - myBuffer - 1) + " / " + myLength);
+                if(anImg->HeadersLength == 0) {
+                    anImg->HeadersLength = size_t(aData - anImg->Data);
+                }
+                if(myToStopAtSos && theDepth == 1) {
+                    // all headers have been read
+                    anImg->Length = size_t(aData - anImg->Data);
+                    return anImg;
+                }
                 aData += anItemLen;
                 break;
             }
@@ -352,21 +389,21 @@ StHandle<StJpegParser::Image> StJpegParser::parseImage(const int      theImgCoun
             case M_APP2: {
                 myOffsets[aMarker == M_EXIF ? Offset_Exif : Offset_ExifExtra] = aData - myBuffer - 2;
                 // there can be different section using the same marker
+                // EXIF is only located here and parsed on demand
                 if(stAreEqual(aData + 2, "Exif\0\0", 6)) {
                     //ST_DEBUG_LOG("Exif section...");
-                    StHandle<StExifDir> aSubDir = new StExifDir();
-                    anImg->Exif.add(aSubDir);
-                    if(!aSubDir->parseExif(anImg->Exif, aData + 8, anItemLen - 8)) {
-                        //
-                    }
+                    ExifSection aSection;
+                    aSection.Data   = aData + 8;
+                    aSection.Length = anItemLen - 8;
+                    aSection.Type   = StExifDir::DType_General;
+                    anImg->ExifSections.push_back(aSection);
                 } else if(stAreEqual(aData + 2, "MPF\0", 4)) {
                     // MP Extensions (MPO)
-                    StHandle<StExifDir> aSubDir = new StExifDir();
-                    aSubDir->Type = StExifDir::DType_MPO;
-                    anImg->Exif.add(aSubDir);
-                    if(!aSubDir->parseExif(anImg->Exif, aData + 6, anItemLen - 6)) {
-                        //
-                    }
+                    ExifSection aSection;
+                    aSection.Data   = aData + 6;
+                    aSection.Length = anItemLen - 6;
+                    aSection.Type   = StExifDir::DType_MPO;
+                    anImg->ExifSections.push_back(aSection);
                 } else if(stAreEqual(aData + 2, "http:", 5)) {
                     //ST_DEBUG_LOG("Image cotains XMP section");
                 } else {
@@ -459,6 +496,25 @@ StHandle<StJpegParser::Image> StJpegParser::parseImage(const int      theImgCoun
     }
 }
 
+void StJpegParser::relocateImage(StJpegParser::Image& theImage,
+                                 stUByte_t*           theNewData,
+                                 const ptrdiff_t      theOffset,
+                                 const size_t         theDiff) const {
+    ptrdiff_t anOffset = theImage.Data - myBuffer;
+    if(anOffset >= theOffset) {
+        anOffset += theDiff;
+    }
+    theImage.Data = theNewData + anOffset;
+    for(size_t aSectIter = 0; aSectIter < theImage.ExifSections.size(); ++aSectIter) {
+        ExifSection& aSection = theImage.ExifSections[aSectIter];
+        anOffset = aSection.Data - myBuffer;
+        if(anOffset >= theOffset) {
+            anOffset += theDiff;
+        }
+        aSection.Data = theNewData + anOffset;
+    }
+}
+
 bool StJpegParser::insertSection(const uint8_t   theMarker,
                                  const uint16_t  theSectLen,
                                  const ptrdiff_t theOffset) {
@@ -476,17 +532,9 @@ bool StJpegParser::insertSection(const uint8_t   theMarker,
         // update pointers of image(s) data
         for(StHandle<StJpegParser::Image> anImg = myImages;
             !anImg.isNull(); anImg = anImg->Next) {
-            ptrdiff_t anOffset = anImg->Data - myBuffer;
-            if(anOffset >= theOffset) {
-                anOffset += aDiff;
-            }
-            anImg->Data = aNewData + anOffset;
+            relocateImage(*anImg, aNewData, theOffset, aDiff);
             if(!anImg->Thumb.isNull()) {
-                anOffset = anImg->Thumb->Data - myBuffer;
-                if(anOffset >= theOffset) {
-                    anOffset += aDiff;
-                }
-                anImg->Thumb->Data = aNewData + anOffset;
+                relocateImage(*anImg->Thumb, aNewData, theOffset, aDiff);
             }
         }
 
@@ -577,10 +625,12 @@ bool StJpegParser::setupJps(const StFormat theFormat) {
 StJpegParser::Image::Image()
 : Data(NULL),
   Length(0),
+  HeadersLength(0),
   SizeX(0),
   SizeY(0),
   ParX(0),
-  ParY(0) {
+  ParY(0),
+  IsExifParsed(false) {
     //
 }
 
@@ -588,12 +638,50 @@ StJpegParser::Image::~Image() {
     //
 }
 
+const StExifDir::List& StJpegParser::Image::getExif() const {
+    if(IsExifParsed) {
+        return Exif;
+    }
+
+    IsExifParsed = true;
+    for(size_t aSectIter = 0; aSectIter < ExifSections.size(); ++aSectIter) {
+        const ExifSection& aSection = ExifSections[aSectIter];
+        StHandle<StExifDir> aSubDir = new StExifDir();
+        aSubDir->Type = aSection.Type;
+        Exif.add(aSubDir);
+        if(!aSubDir->parseExif(Exif, aSection.Data, aSection.Length)) {
+            //
+        }
+    }
+    return Exif;
+}
+
+StHandle<StJpegParser> StJpegParser::copyHeaders(const StHandle<StJpegParser::Image>& theImage) const {
+    if(theImage.isNull()
+    || theImage->HeadersLength < 4
+    || theImage->ExifSections.empty()) {
+        return StHandle<StJpegParser>();
+    }
+
+    // copy headers and replace Start Of Scan by End Of Image marker
+    StHandle<StJpegParser> aCopy = new StJpegParser();
+    aCopy->initBuffer(theImage->HeadersLength);
+    stMemCpy(aCopy->myBuffer, theImage->Data, theImage->HeadersLength);
+    aCopy->myBuffer[theImage->HeadersLength - 1] = M_EOI;
+    aCopy->myLength = theImage->HeadersLength;
+    if(!aCopy->parse()) {
+        return StHandle<StJpegParser>();
+    }
+    return aCopy;
+}
+
 void StJpegParser::fillDictionary(StDictionary& theDict,
                                   const bool    theToShowUnknown) const {
     for(StHandle<StJpegParser::Image> anImg = myImages;
         !anImg.isNull(); anImg = anImg->Next) {
-        for(size_t anExifId = 0; anExifId < anImg->Exif.size(); ++anExifId) {
-            anImg->Exif[anExifId]->fillDictionary(theDict, theToShowUnknown);
+        const StExifDir::List& anExif = anImg->getExif();
+        for(size_t anExifId = 0; anExifId < anExif.size(); ++anExifId) {
+            anExif[anExifId]->fillDictionary(theDict, theToShowUnknown);
         }
     }
 }
@@ -601,7 +689,7 @@ void StJpegParser::fillDictionary(StDictionary& theDict,
 StString StJpegParser::Image::getDateTime() const {
     StString aString;
     StExifDir::Query aQuery(StExifDir::DType_General, StExifTags::Image_DateTime);
-    if(StExifDir::findEntry(Exif, aQuery)) {
+    if(StExifDir::findEntry(getExif(), aQuery)) {
         aQuery.Folder->format(aQuery.Entry, aString);
     }
     return aString;
@@ -609,7 +697,7 @@ StString StJpegParser::Image::getDateTime() const {
 
 bool StJpegParser::Image::getParallax(double& theParallax) const {
     StExifDir::Query aQuery(StExifDir::DType_MakerFuji, StExifTags::Fuji_Parallax);
-    if(!StExifDir::findEntry(Exif, aQuery)
+    if(!StExifDir::findEntry(getExif(), aQuery)
     ||  aQuery.Entry.Format != StExifEntry::FMT_SRATIONAL) {
         return false;
     }
@@ -623,9 +711,19 @@ bool StJpegParser::Image::getParallax(double& theParallax) const {
     return false;
 }
 
+size_t StJpegParser::Image::getNbMpoImages() const {
+    StExifDir::Query aQuery(StExifDir::DType_MPO, StExifTags::Mpo_NumberOfImages);
+    if(!StExifDir::findEntry(getExif(), aQuery)
+    ||  aQuery.Entry.Format != StExifEntry::FMT_ULONG) {
+        return 0;
+    }
+
+    return aQuery.Folder->get32u(aQuery.Entry.ValuePtr);
+}
+
 StJpegParser::Orient StJpegParser::Image::getOrientation() const {
     StExifDir::Query aQuery(StExifDir::DType_General, StExifTags::Image_Orientation);
-    if(!StExifDir::findEntry(Exif, aQuery)
+    if(!StExifDir::findEntry(getExif(), aQuery)
     ||  aQuery.Entry.Format != StExifEntry::FMT_USHORT) {
         return StJpegParser::ORIENT_NORM;
     }
@@ -0,0 +1,381 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file license-boost.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+
+#include <StFile/StMediaInfoIndex.h>
+
+#include <StAV/stAV.h>
+#include <StAV/StAVIOFileContext.h>
+#include <StFile/StRawFile.h>
+#include <StImage/StJpegParser.h>
+#include <StStrings/StLogger.h>
+
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+    /**
+     * Index file header, should be changed when format of the lines is modified.
+     */
+    static const StCString THE_INDEX_HEADER = stCString("sView media index 2");
+
+    /**
+     * Amount of data to be read by FFmpeg for probing the container.
+     */
+    static const char THE_PROBE_SIZE[]     = "1048576";
+
+    /**
+     * Duration of data (in microseconds) to be analyzed by FFmpeg for probing the streams.
+     */
+    static const char THE_PROBE_DURATION[] = "500000";
+
+    /**
+     * Read the integer number terminated by tab.
+     */
+    inline bool readInteger(const char*& theIter,
+                            const char*  theEnd,
+                            int64_t&     theValue) {
+        char* aNumEnd = NULL;
+        theValue = std::strtoll(theIter, &aNumEnd, 10);
+        if(aNumEnd == theIter
+        || aNumEnd >= theEnd
+        || *aNumEnd != '\t') {
+            return false;
+        }
+        theIter = aNumEnd + 1;
+        return true;
+    }
+
+    /**
+     * Read the floating point number terminated by tab.
+     */
+    inline bool readNumber(const char*& theIter,
+                           const char*  theEnd,
+                           double&      theValue) {
+        char* aNumEnd = NULL;
+        theValue = std::strtod(theIter, &aNumEnd);
+        if(aNumEnd == theIter
+        || aNumEnd >= theEnd
+        || *aNumEnd != '\t') {
+            return false;
+        }
+        theIter = aNumEnd + 1;
+        return true;
+    }
+
+}
+
+StMediaInfoIndex::StMediaInfoIndex(const StString& theFilePath,
+                                   const size_t    theNbMax)
+: myLastStamp(0),
+  myFilePath(theFilePath),
+  myNbMax(theNbMax),
+  myIsChanged(false) {
+    //
+}
+
+StMediaInfoIndex::~StMediaInfoIndex() {
+    //
+}
+
+void StMediaInfoIndex::touch(MapOfEntries::iterator theIter) const {
+    if(theIter->second.Stamp != 0) {
+        myStamps.erase(theIter->second.Stamp);
+    }
+    theIter->second.Stamp = ++myLastStamp;
+    myStamps[theIter->second.Stamp] = theIter->first;
+}
+
+bool StMediaInfoIndex::load() {
+    StRawFile aFile;
+    if(myFilePath.isEmpty()
+    || !StFileNode::isFileExists(myFilePath)
+    || !aFile.readFile(myFilePath)) {
+        return false;
+    }
+
+    const char* anIter = (const char* )aFile.getBuffer();
+    const char* anEnd  = anIter + aFile.getSize();
+    const size_t aHeaderLen = THE_INDEX_HEADER.getSize();
+    if(aFile.getSize() < aHeaderLen
+    || !stAreEqual(anIter, THE_INDEX_HEADER.toCString(), aHeaderLen)) {
+        ST_DEBUG_LOG("StMediaInfoIndex, outdated index file \"" + myFilePath + "\" is ignored");
+        return false;
+    }
+
+    StMutexAuto aLock(myMutex);
+    myEntries.clear();
+    myStamps.clear();
+    for(anIter += aHeaderLen; anIter < anEnd;) {
+        const char* aLineEnd = anIter;
+        for(; aLineEnd < anEnd && *aLineEnd != '\n'; ++aLineEnd) {}
+
+        // the string is terminated by line break (or by buffer end)
+        // thus strtoll()/strtod() would not run out of the line
+        int64_t anInts[8];
+        double  aReals[2];
+        bool isValid = true;
+        const char* aValIter = anIter;
+        for(size_t aValId = 0; aValId < 8 && isValid; ++aValId) {
+            isValid = readInteger(aValIter, aLineEnd, anInts[aValId]);
+        }
+        for(size_t aValId = 0; aValId < 2 && isValid; ++aValId) {
+            isValid = readNumber(aValIter, aLineEnd, aReals[aValId]);
+        }
+        if(isValid && aValIter < aLineEnd) {
+            Entry anEntry;
+            anEntry.FileSize     = anInts[0];
+            anEntry.ModifTime    = anInts[1];
+            anEntry.SizeX        = (int )anInts[2];
+            anEntry.SizeY        = (int )anInts[3];
+            anEntry.NbImages     = (int )anInts[4];
+            anEntry.Rotation     = (int )anInts[5];
+            anEntry.StereoFormat = (StFormat )anInts[6];
+            anEntry.StreamKinds  = (int )anInts[7];
+            anEntry.Duration     = aReals[0];
+            anEntry.Parallax     = aReals[1];
+            if(anEntry.StereoFormat < StFormat_AUTO
+            || anEntry.StereoFormat >= StFormat_NB) {
+                anEntry.StereoFormat = StFormat_AUTO;
+            }
+
+            // entries are stored from the least to the most recently used one
+            MapOfEntries::iterator anEntryIter = myEntries.insert(MapOfEntries::value_type(StString(aValIter, aLineEnd - aValIter), IndexedEntry())).first;
+            anEntryIter->second.Info = anEntry;
+            touch(anEntryIter);
+            if(myEntries.size() > myNbMax) {
+                MapOfStamps::iterator anOldest = myStamps.begin();
+                myEntries.erase(anOldest->second);
+                myStamps.erase(anOldest);
+            }
+        }
+        anIter = aLineEnd + 1;
+    }
+    myIsChanged = false;
+    return true;
+}
+
+bool StMediaInfoIndex::save() {
+    StMutexAuto aLock(myMutex);
+    if(!myIsChanged) {
+        return true;
+    }
+
+    StRawFile aFile;
+    if(myFilePath.isEmpty()
+    || !aFile.openFile(StRawFile::WRITE, myFilePath)) {
+        return false;
+    }
+
+    // write entries in order of access, so that it can be restored on loading
+    char aBuffer[256];
+    aFile.write(THE_INDEX_HEADER);
+    for(MapOfStamps::const_iterator aStampIter = myStamps.begin(); aStampIter != myStamps.end(); ++aStampIter) {
+        MapOfEntries::const_iterator anIter = myEntries.find(aStampIter->second);
+        if(anIter == myEntries.end()) {
+            continue;
+        }
+
+        const Entry& anEntry = anIter->second.Info;
+        stsprintf(aBuffer, sizeof(aBuffer), "\n%lld\t%lld\t%d\t%d\t%d\t%d\t%d\t%d\t%.17g\t%.17g\t",
+                  (long long )anEntry.FileSize, (long long )anEntry.ModifTime,
+                  anEntry.SizeX, anEntry.SizeY, anEntry.NbImages, anEntry.Rotation,
+                  int(anEntry.StereoFormat), anEntry.StreamKinds,
+                  anEntry.Duration, anEntry.Parallax);
+        aFile.write(aBuffer, std::strlen(aBuffer));
+        aFile.write(anIter->first);
+    }
+    aFile.write(stCString("\n"));
+    myIsChanged = false;
+    return true;
+}
+
+bool StMediaInfoIndex::find(const StString& thePath,
+                            Entry&          theEntry) const {
+    int64_t aSize = 0, aModifTime = 0;
+    if(!StFileNode::getFileStat(thePath, aSize, aModifTime)) {
+        return false;
+    }
+
+    StMutexAuto aLock(myMutex);
+    MapOfEntries::iterator anIter = myEntries.find(thePath);
+    if(anIter == myEntries.end()
+    || anIter->second.Info.FileSize  != aSize
+    || anIter->second.Info.ModifTime != aModifTime) {
+        return false;
+    }
+    theEntry = anIter->second.Info;
+    touch(anIter);
+    myIsChanged = true;
+    return true;
+}
+
+void StMediaInfoIndex::update(const StString& thePath,
+                              const Entry&    theEntry) {
+    Entry anEntry = theEntry;
+    if(thePath.isEmpty()
+    || thePath.isContains('\n')
+    || StFileNode::isContentProtocolPath(thePath)
+    || !StFileNode::getFileStat(thePath, anEntry.FileSize, anEntry.ModifTime)) {
+        return;
+    }
+
+    StMutexAuto aLock(myMutex);
+    MapOfEntries::iterator anIter = myEntries.find(thePath);
+    if(anIter == myEntries.end()) {
+        if(myEntries.size() >= myNbMax
+        && !myStamps.empty()) {
+            // index is full - drop the least recently used entry
+            MapOfStamps::iterator anOldest = myStamps.begin();
+            myEntries.erase(anOldest->second);
+            myStamps.erase(anOldest);
+        }
+        anIter = myEntries.insert(MapOfEntries::value_type(thePath, IndexedEntry())).first;
+    }
+    anIter->second.Info = anEntry;
+    touch(anIter);
+    myIsChanged = true;
+}
+
+bool StMediaInfoIndex::scan(const StString& thePath,
+                            Entry&          theEntry) {
+    if(find(thePath, theEntry)) {
+        return true;
+    }
+
+    const StString anExt = StFileNode::getExtension(thePath);
+    if(anExt.isEqualsIgnoreCase(stCString("jpg"))
+    || anExt.isEqualsIgnoreCase(stCString("jpeg"))
+    || anExt.isEqualsIgnoreCase(stCString("jpe"))
+    || anExt.isEqualsIgnoreCase(stCString("mpo"))
+    || anExt.isEqualsIgnoreCase(stCString("jps"))) {
+        if(scanJpeg(thePath, theEntry)) {
+            update(thePath, theEntry);
+            return true;
+        }
+    }
+
+    if(scanContainer(thePath, theEntry)) {
+        update(thePath, theEntry);
+        return true;
+    }
+    return false;
+}
+
+bool StMediaInfoIndex::scanJpeg(const StString& thePath,
+                                Entry&          theEntry) {
+    StJpegParser aParser;
+    if(!aParser.readHeaders(thePath)) {
+        return false;
+    }
+
+    StHandle<StJpegParser::Image> anImg = aParser.getImage(0);
+    if(anImg.isNull()
+    || anImg->SizeX == 0
+    || anImg->SizeY == 0) {
+        return false;
+    }
+
+    theEntry.SizeX        = (int )anImg->SizeX;
+    theEntry.SizeY        = (int )anImg->SizeY;
+    theEntry.NbImages     = stMax((int )anImg->getNbMpoImages(), 1);
+    theEntry.Rotation     = StJpegParser::getRotationAngle(anImg->getOrientation());
+    theEntry.StereoFormat = aParser.getSrcFormat();
+    theEntry.Duration     = 0.0;
+    theEntry.Parallax     = 0.0;
+    theEntry.StreamKinds  = StreamKind_Video;
+    // in MPO parallax is generally stored only in the second frame,
+    // which is beyond the headers of the first one
+    anImg->getParallax(theEntry.Parallax);
+    return true;
+}
+
+bool StMediaInfoIndex::scanContainer(const StString& thePath,
+                                     Entry&          theEntry) {
+#if(LIBAVFORMAT_VERSION_INT >= AV_VERSION_INT(53, 17, 0))
+    if(StFileNode::isRemoteProtocolPath(thePath)
+    || StFileNode::isContentProtocolPath(thePath)
+    || !stAV::init()) {
+        return false;
+    }
+
+    StAVIOFileContext aFileCtx;
+    if(!aFileCtx.open(thePath)) {
+        return false;
+    }
+
+    AVFormatContext* aFormatCtx = avformat_alloc_context();
+    aFormatCtx->pb = aFileCtx.getAvioContext();
+
+    // limit probing to the file header
+    AVDictionary* anOpts = NULL;
+    av_dict_set(&anOpts, "probesize",       THE_PROBE_SIZE,     0);
+    av_dict_set(&anOpts, "analyzeduration", THE_PROBE_DURATION, 0);
+    const int avErrCode = avformat_open_input(&aFormatCtx, thePath.toCString(), NULL, &anOpts);
+    av_dict_free(&anOpts);
+    if(avErrCode != 0) {
+        if(aFormatCtx != NULL) {
+            avformat_close_input(&aFormatCtx);
+        }
+        return false;
+    }
+    if(avformat_find_stream_info(aFormatCtx, NULL) < 0) {
+        avformat_close_input(&aFormatCtx);
+        return false;
+    }
+
+    Entry anEntry;
+    for(unsigned int aStreamId = 0; aStreamId < aFormatCtx->nb_streams; ++aStreamId) {
+        const AVStream* aStream = aFormatCtx->streams[aStreamId];
+        switch(stAV::getCodecType(aStream)) {
+            case AVMEDIA_TYPE_VIDEO: {
+                if(stAV::isAttachedPicture(aStream)) {
+                    break;
+                }
+
+                anEntry.StreamKinds |= StreamKind_Video;
+                if(anEntry.SizeX == 0) {
+                #ifdef ST_AV_NEWCODECPAR
+                    anEntry.SizeX = aStream->codecpar->width;
+                    anEntry.SizeY = aStream->codecpar->height;
+                #else
+                    anEntry.SizeX = stAV::getCodecCtx(aStream)->width;
+                    anEntry.SizeY = stAV::getCodecCtx(aStream)->height;
+                #endif
+                    anEntry.NbImages = 1;
+                }
+                break;
+            }
+            case AVMEDIA_TYPE_AUDIO: {
+                anEntry.StreamKinds |= StreamKind_Audio;
+                break;
+            }
+            case AVMEDIA_TYPE_SUBTITLE: {
+                anEntry.StreamKinds |= StreamKind_Subtitles;
+                break;
+            }
+            default: break;
+        }
+    }
+    if(aFormatCtx->duration != AV_NOPTS_VALUE
+    && aFormatCtx->duration > 0) {
+        anEntry.Duration = stAV::unitsToSeconds(aFormatCtx->duration);
+    }
+    avformat_close_input(&aFormatCtx);
+    if(anEntry.StreamKinds == 0) {
+        return false;
+    }
+
+    theEntry = anEntry;
+    return true;
+#else
+    (void )thePath;
+    (void )theEntry;
+    return false;
+#endif
+}
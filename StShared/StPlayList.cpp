@@ -9,6 +9,7 @@
 #include <StGL/StPlayList.h>
 
 #include <StFile/StRawFile.h>
+#include <StStrings/StFormatTime.h>
 #include <StThreads/StProcess.h>
 
 #include <sstream>
@@ -181,6 +182,11 @@ void StPlayList::setExtensions(const StArrayList<StString>& theExtensions) {
     }
 }
 
+void StPlayList::setInfoIndex(const StHandle<StMediaInfoIndex>& theIndex) {
+    StMutexAuto anAutoLock(myMutex);
+    myInfoIndex = theIndex;
+}
+
 StPlayList::~StPlayList() {
     signals.onTitleChange.disconnect();
     signals.onPositionChange.disconnect();
@@ -750,28 +756,68 @@ bool StPlayList::saveM3U(const StCString& thePath) {
 
 void StPlayList::getSubList(StArrayList<StString>& theList,
                             const size_t           theStart,
-                            const size_t           theEnd) const {
+                            const size_t           theEnd,
+                            const bool             theToAddInfo) const {
     theList.clear();
-    StMutexAuto anAutoLock(myMutex);
+    StArrayList<StString> aPaths;
+    StHandle<StMediaInfoIndex> anIndex;
+    {
+        StMutexAuto anAutoLock(myMutex);
+        if(theToAddInfo) {
+            anIndex = myInfoIndex;
+        }
 
-    size_t anIter = 0;
-    StPlayItem* anItem = myFirst;
-    for(; anItem != NULL; anItem = anItem->getNext(), ++anIter) {
-        if(anIter == theStart) {
-            break;
+        size_t anIter = 0;
+        StPlayItem* anItem = myFirst;
+        for(; anItem != NULL; anItem = anItem->getNext(), ++anIter) {
+            if(anIter == theStart) {
+                break;
+            }
+        }
+
+        if(anIter != theStart) {
+            return;
+        }
+
+        for(; anItem != NULL; anItem = anItem->getNext(), ++anIter) {
+            if(anIter == theEnd) {
+                break;
+            }
+
+            theList.add(anItem->getTitle());
+            if(!anIndex.isNull()) {
+                const StFileNode* aNode = anItem->getFileNode();
+                aPaths.add(aNode != NULL && aNode->size() < 2 ? aNode->getPath() : StString());
+            }
         }
     }
 
-    if(anIter != theStart) {
+    if(anIndex.isNull()) {
         return;
     }
 
-    for(; anItem != NULL; anItem = anItem->getNext(), ++anIter) {
-        if(anIter == theEnd) {
-            break;
+    // look up the index outside of playlist lock, since it checks file modification time
+    StMediaInfoIndex::Entry anEntry;
+    for(size_t anIter = 0; anIter < aPaths.size(); ++anIter) {
+        if(aPaths[anIter].isEmpty()
+        || !anIndex->find(aPaths[anIter], anEntry)) {
+            continue;
         }
 
-        theList.add(anItem->getTitle());
+        StString anInfo;
+        if(anEntry.SizeX > 0
+        && anEntry.SizeY > 0) {
+            anInfo = StString() + anEntry.SizeX + "x" + anEntry.SizeY;
+        }
+        if(anEntry.Duration > 0.0) {
+            if(!anInfo.isEmpty()) {
+                anInfo += ", ";
+            }
+            anInfo += StFormatTime::formatSeconds(anEntry.Duration);
+        }
+        if(!anInfo.isEmpty()) {
+            theList.changeValue(anIter) = theList.getValue(anIter) + " [" + anInfo + "]";
+        }
     }
 }
 
@@ -0,0 +1,107 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file license-boost.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+
+#include <StThreads/StThreadPool.h>
+#include <StThreads/StAtomicOp.h>
+
+StThreadPool::StThreadPool(const int theNbThreads)
+: myJob(NULL),
+  myNbChunks(0),
+  myChunkIter(0),
+  myNbThreads(1),
+  myToQuit(false) {
+    const int aNbThreads = theNbThreads > 0 ? theNbThreads : StThread::countLogicalProcessors();
+    myNbThreads = size_t(stMax(aNbThreads, 1));
+}
+
+StThreadPool::~StThreadPool() {
+    myMutex.lock();
+    myToQuit = true;
+    for(size_t aWorkerIter = 0; aWorkerIter < myWorkers.size(); ++aWorkerIter) {
+        myWorkers[aWorkerIter]->WakeEvent.set();
+    }
+    for(size_t aWorkerIter = 0; aWorkerIter < myWorkers.size(); ++aWorkerIter) {
+        Worker* aWorker = myWorkers[aWorkerIter];
+        aWorker->Thread->wait();
+        delete aWorker;
+    }
+    myWorkers.clear();
+    myMutex.unlock();
+}
+
+SV_THREAD_FUNCTION StThreadPool::threadFunction(void* theWorker) {
+    Worker* aWorker = (Worker* )theWorker;
+    for(;;) {
+        aWorker->WakeEvent.wait();
+        aWorker->WakeEvent.reset();
+        if(aWorker->Pool->myToQuit) {
+            break;
+        }
+
+        aWorker->Pool->performChunks();
+        aWorker->DoneEvent.set();
+    }
+    return SV_THREAD_RETURN 0;
+}
+
+void StThreadPool::startWorkers() {
+    for(size_t aWorkerIter = 1; aWorkerIter < myNbThreads; ++aWorkerIter) {
+        Worker* aWorker = new Worker();
+        aWorker->Pool   = this;
+        aWorker->Thread = new StThread(threadFunction, (void* )aWorker, "StThreadPool");
+        myWorkers.push_back(aWorker);
+    }
+}
+
+void StThreadPool::performChunks() {
+    for(;;) {
+        const size_t aChunk = size_t(StAtomicOp::Increment(myChunkIter) - 1);
+        if(aChunk >= myNbChunks) {
+            return;
+        }
+        myJob->perform(aChunk, myNbChunks);
+    }
+}
+
+void StThreadPool::perform(Job&         theJob,
+                           const size_t theNbChunks) {
+    if(theNbChunks == 0) {
+        return;
+    } else if(theNbChunks == 1
+           || myNbThreads < 2) {
+        for(size_t aChunk = 0; aChunk < theNbChunks; ++aChunk) {
+            theJob.perform(aChunk, theNbChunks);
+        }
+        return;
+    }
+
+    myMutex.lock();
+    if(myWorkers.empty()) {
+        startWorkers();
+    }
+
+    myJob       = &theJob;
+    myNbChunks  = theNbChunks;
+    myChunkIter = 0;
+
+    // do not wake up more workers than needed
+    const size_t aNbWorkers = stMin(myWorkers.size(), theNbChunks - 1);
+    for(size_t aWorkerIter = 0; aWorkerIter < aNbWorkers; ++aWorkerIter) {
+        Worker* aWorker = myWorkers[aWorkerIter];
+        aWorker->DoneEvent.reset();
+        aWorker->WakeEvent.set();
+    }
+
+    performChunks();
+
+    for(size_t aWorkerIter = 0; aWorkerIter < aNbWorkers; ++aWorkerIter) {
+        myWorkers[aWorkerIter]->DoneEvent.wait();
+    }
+    myJob = NULL;
+    myMutex.unlock();
+}
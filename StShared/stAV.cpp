@@ -113,15 +113,31 @@ const AVPixelFormat stAV::PIX_FMT::YUV410P    = ST_AV_GETPIXFMT("yuv410p");
 const AVPixelFormat stAV::PIX_FMT::YUV411P    = ST_AV_GETPIXFMT("yuv411p");
 const AVPixelFormat stAV::PIX_FMT::YUV440P    = ST_AV_GETPIXFMT("yuv440p");
 const AVPixelFormat stAV::PIX_FMT::NV12       = ST_AV_GETPIXFMT("nv12");
+const AVPixelFormat stAV::PIX_FMT::P010       = ST_AV_GETPIXFMT("p010");
+const AVPixelFormat stAV::PIX_FMT::P016       = ST_AV_GETPIXFMT("p016");
+const AVPixelFormat stAV::PIX_FMT::YUYV422    = ST_AV_GETPIXFMT("yuyv422");
+const AVPixelFormat stAV::PIX_FMT::UYVY422    = ST_AV_GETPIXFMT("uyvy422");
 const AVPixelFormat stAV::PIX_FMT::YUV420P9   = ST_AV_GETPIXFMT("yuv420p9");
 const AVPixelFormat stAV::PIX_FMT::YUV422P9   = ST_AV_GETPIXFMT("yuv422p9");
 const AVPixelFormat stAV::PIX_FMT::YUV444P9   = ST_AV_GETPIXFMT("yuv444p9");
 const AVPixelFormat stAV::PIX_FMT::YUV420P10  = ST_AV_GETPIXFMT("yuv420p10");
 const AVPixelFormat stAV::PIX_FMT::YUV422P10  = ST_AV_GETPIXFMT("yuv422p10");
 const AVPixelFormat stAV::PIX_FMT::YUV444P10  = ST_AV_GETPIXFMT("yuv444p10");
+const AVPixelFormat stAV::PIX_FMT::YUV420P12  = ST_AV_GETPIXFMT("yuv420p12");
+const AVPixelFormat stAV::PIX_FMT::YUV422P12  = ST_AV_GETPIXFMT("yuv422p12");
+const AVPixelFormat stAV::PIX_FMT::YUV444P12  = ST_AV_GETPIXFMT("yuv444p12");
 const AVPixelFormat stAV::PIX_FMT::YUV420P16  = ST_AV_GETPIXFMT("yuv420p16");
 const AVPixelFormat stAV::PIX_FMT::YUV422P16  = ST_AV_GETPIXFMT("yuv422p16");
 const AVPixelFormat stAV::PIX_FMT::YUV444P16  = ST_AV_GETPIXFMT("yuv444p16");
+const AVPixelFormat stAV::PIX_FMT::YUVA420P   = ST_AV_GETPIXFMT("yuva420p");
+const AVPixelFormat stAV::PIX_FMT::YUVA422P   = ST_AV_GETPIXFMT("yuva422p");
+const AVPixelFormat stAV::PIX_FMT::YUVA444P   = ST_AV_GETPIXFMT("yuva444p");
+const AVPixelFormat stAV::PIX_FMT::YUVA420P10 = ST_AV_GETPIXFMT("yuva420p10");
+const AVPixelFormat stAV::PIX_FMT::YUVA422P10 = ST_AV_GETPIXFMT("yuva422p10");
+const AVPixelFormat stAV::PIX_FMT::YUVA444P10 = ST_AV_GETPIXFMT("yuva444p10");
+const AVPixelFormat stAV::PIX_FMT::YUVA420P16 = ST_AV_GETPIXFMT("yuva420p16");
+const AVPixelFormat stAV::PIX_FMT::YUVA422P16 = ST_AV_GETPIXFMT("yuva422p16");
+const AVPixelFormat stAV::PIX_FMT::YUVA444P16 = ST_AV_GETPIXFMT("yuva444p16");
 const AVPixelFormat stAV::PIX_FMT::YUVJ420P   = ST_AV_GETPIXFMT("yuvj420p");
 const AVPixelFormat stAV::PIX_FMT::YUVJ422P   = ST_AV_GETPIXFMT("yuvj422p");
 const AVPixelFormat stAV::PIX_FMT::YUVJ444P   = ST_AV_GETPIXFMT("yuvj444p");
@@ -132,6 +148,13 @@ const AVPixelFormat stAV::PIX_FMT::RGB48      = ST_AV_GETPIXFMT("rgb48");
 const AVPixelFormat stAV::PIX_FMT::BGR48      = ST_AV_GETPIXFMT("bgr48");
 const AVPixelFormat stAV::PIX_FMT::RGBA64     = ST_AV_GETPIXFMT("rgba64");
 const AVPixelFormat stAV::PIX_FMT::BGRA64     = ST_AV_GETPIXFMT("bgra64");
+const AVPixelFormat stAV::PIX_FMT::GBRP       = ST_AV_GETPIXFMT("gbrp");
+const AVPixelFormat stAV::PIX_FMT::GBRP9      = ST_AV_GETPIXFMT("gbrp9");
+const AVPixelFormat stAV::PIX_FMT::GBRP10     = ST_AV_GETPIXFMT("gbrp10");
+const AVPixelFormat stAV::PIX_FMT::GBRP12     = ST_AV_GETPIXFMT("gbrp12");
+const AVPixelFormat stAV::PIX_FMT::GBRP16     = ST_AV_GETPIXFMT("gbrp16");
+const AVPixelFormat stAV::PIX_FMT::GBRAP      = ST_AV_GETPIXFMT("gbrap");
+const AVPixelFormat stAV::PIX_FMT::GBRAP16    = ST_AV_GETPIXFMT("gbrap16");
 const AVPixelFormat stAV::PIX_FMT::XYZ12      = ST_AV_GETPIXFMT("xyz12");
 const AVPixelFormat stAV::PIX_FMT::DXVA2_VLD  = ST_AV_GETPIXFMT("dxva2_vld");
 
@@ -182,12 +205,36 @@ StCString stAV::PIX_FMT::getString(const AVPixelFormat theFrmt) {
         return stCString("yuv422p10");
     } else if(theFrmt == stAV::PIX_FMT::YUV444P10) {
         return stCString("yuv444p10");
+    } else if(theFrmt == stAV::PIX_FMT::YUV420P12) {
+        return stCString("yuv420p12");
+    } else if(theFrmt == stAV::PIX_FMT::YUV422P12) {
+        return stCString("yuv422p12");
+    } else if(theFrmt == stAV::PIX_FMT::YUV444P12) {
+        return stCString("yuv444p12");
     } else if(theFrmt == stAV::PIX_FMT::YUV420P16) {
         return stCString("yuv420p16");
     } else if(theFrmt == stAV::PIX_FMT::YUV422P16) {
         return stCString("yuv422p16");
     } else if(theFrmt == stAV::PIX_FMT::YUV444P16) {
         return stCString("yuv444p16");
+    } else if(theFrmt == stAV::PIX_FMT::YUVA420P) {
+        return stCString("yuva420p");
+    } else if(theFrmt == stAV::PIX_FMT::YUVA422P) {
+        return stCString("yuva422p");
+    } else if(theFrmt == stAV::PIX_FMT::YUVA444P) {
+        return stCString("yuva444p");
+    } else if(theFrmt == stAV::PIX_FMT::YUVA420P10) {
+        return stCString("yuva420p10");
+    } else if(theFrmt == stAV::PIX_FMT::YUVA422P10) {
+        return stCString("yuva422p10");
+    } else if(theFrmt == stAV::PIX_FMT::YUVA444P10) {
+        return stCString("yuva444p10");
+    } else if(theFrmt == stAV::PIX_FMT::YUVA420P16) {
+        return stCString("yuva420p16");
+    } else if(theFrmt == stAV::PIX_FMT::YUVA422P16) {
+        return stCString("yuva422p16");
+    } else if(theFrmt == stAV::PIX_FMT::YUVA444P16) {
+        return stCString("yuva444p16");
     } else if(theFrmt == stAV::PIX_FMT::YUVJ420P) {
         return stCString("yuvj420p");
     } else if(theFrmt == stAV::PIX_FMT::YUVJ422P) {
@@ -214,6 +261,28 @@ StCString stAV::PIX_FMT::getString(const AVPixelFormat theFrmt) {
         return stCString("bgra64");
     } else if(theFrmt == stAV::PIX_FMT::NV12) {
         return stCString("nv12");
+    } else if(theFrmt == stAV::PIX_FMT::P010) {
+        return stCString("p010");
+    } else if(theFrmt == stAV::PIX_FMT::P016) {
+        return stCString("p016");
+    } else if(theFrmt == stAV::PIX_FMT::YUYV422) {
+        return stCString("yuyv422");
+    } else if(theFrmt == stAV::PIX_FMT::UYVY422) {
+        return stCString("uyvy422");
+    } else if(theFrmt == stAV::PIX_FMT::GBRP) {
+        return stCString("gbrp");
+    } else if(theFrmt == stAV::PIX_FMT::GBRP9) {
+        return stCString("gbrp9");
+    } else if(theFrmt == stAV::PIX_FMT::GBRP10) {
+        return stCString("gbrp10");
+    } else if(theFrmt == stAV::PIX_FMT::GBRP12) {
+        return stCString("gbrp12");
+    } else if(theFrmt == stAV::PIX_FMT::GBRP16) {
+        return stCString("gbrp16");
+    } else if(theFrmt == stAV::PIX_FMT::GBRAP) {
+        return stCString("gbrap");
+    } else if(theFrmt == stAV::PIX_FMT::GBRAP16) {
+        return stCString("gbrap16");
     } else if(theFrmt == stAV::PIX_FMT::XYZ12) {
         return stCString("xyz12");
     } else if(theFrmt == stAV::PIX_FMT::DXVA2_VLD) {
@@ -300,25 +369,8 @@ bool stAV::init() {
 }
 
 bool stAV::isFormatYUVPlanar(const AVCodecContext* theCtx) {
-    return theCtx->pix_fmt == stAV::PIX_FMT::YUV420P
-        || theCtx->pix_fmt == stAV::PIX_FMT::YUVJ420P
-        || theCtx->pix_fmt == stAV::PIX_FMT::YUV422P
-        || theCtx->pix_fmt == stAV::PIX_FMT::YUVJ422P
-        || theCtx->pix_fmt == stAV::PIX_FMT::YUV444P
-        || theCtx->pix_fmt == stAV::PIX_FMT::YUVJ444P
-        || theCtx->pix_fmt == stAV::PIX_FMT::YUV440P
-        || theCtx->pix_fmt == stAV::PIX_FMT::YUVJ440P
-        || theCtx->pix_fmt == stAV::PIX_FMT::YUV411P
-        || theCtx->pix_fmt == stAV::PIX_FMT::YUV410P
-        || theCtx->pix_fmt == stAV::PIX_FMT::YUV420P9
-        || theCtx->pix_fmt == stAV::PIX_FMT::YUV422P9
-        || theCtx->pix_fmt == stAV::PIX_FMT::YUV444P9
-        || theCtx->pix_fmt == stAV::PIX_FMT::YUV420P10
-        || theCtx->pix_fmt == stAV::PIX_FMT::YUV422P10
-        || theCtx->pix_fmt == stAV::PIX_FMT::YUV444P10
-        || theCtx->pix_fmt == stAV::PIX_FMT::YUV420P16
-        || theCtx->pix_fmt == stAV::PIX_FMT::YUV422P16
-        || theCtx->pix_fmt == stAV::PIX_FMT::YUV444P16;
+    dimYUV aDims;
+    return isFormatYUVPlanar(theCtx->pix_fmt, theCtx->width, theCtx->height, aDims);
 }
 
 bool stAV::isFormatYUVPlanar(const AVPixelFormat thePixFmt,
@@ -331,7 +383,11 @@ bool stAV::isFormatYUVPlanar(const AVPixelFormat thePixFmt,
            || thePixFmt == stAV::PIX_FMT::YUVJ420P
            || thePixFmt == stAV::PIX_FMT::YUV420P9
            || thePixFmt == stAV::PIX_FMT::YUV420P10
-           || thePixFmt == stAV::PIX_FMT::YUV420P16) {
+           || thePixFmt == stAV::PIX_FMT::YUV420P12
+           || thePixFmt == stAV::PIX_FMT::YUV420P16
+           || thePixFmt == stAV::PIX_FMT::YUVA420P
+           || thePixFmt == stAV::PIX_FMT::YUVA420P10
+           || thePixFmt == stAV::PIX_FMT::YUVA420P16) {
         theDims.widthY  = theWidth;
         theDims.heightY = theHeight;
         theDims.widthU  = theDims.widthV  = theDims.widthY  / 2;
@@ -341,7 +397,11 @@ bool stAV::isFormatYUVPlanar(const AVPixelFormat thePixFmt,
            || thePixFmt == stAV::PIX_FMT::YUVJ422P
            || thePixFmt == stAV::PIX_FMT::YUV422P9
            || thePixFmt == stAV::PIX_FMT::YUV422P10
-           || thePixFmt == stAV::PIX_FMT::YUV422P16) {
+           || thePixFmt == stAV::PIX_FMT::YUV422P12
+           || thePixFmt == stAV::PIX_FMT::YUV422P16
+           || thePixFmt == stAV::PIX_FMT::YUVA422P
+           || thePixFmt == stAV::PIX_FMT::YUVA422P10
+           || thePixFmt == stAV::PIX_FMT::YUVA422P16) {
         theDims.widthY  = theWidth;
         theDims.heightY = theDims.heightU = theDims.heightV = theHeight;
         theDims.widthU  = theDims.widthV  = theDims.widthY  / 2;
@@ -350,7 +410,11 @@ bool stAV::isFormatYUVPlanar(const AVPixelFormat thePixFmt,
            || thePixFmt == stAV::PIX_FMT::YUVJ444P
            || thePixFmt == stAV::PIX_FMT::YUV444P9
            || thePixFmt == stAV::PIX_FMT::YUV444P10
-           || thePixFmt == stAV::PIX_FMT::YUV444P16) {
+           || thePixFmt == stAV::PIX_FMT::YUV444P12
+           || thePixFmt == stAV::PIX_FMT::YUV444P16
+           || thePixFmt == stAV::PIX_FMT::YUVA444P
+           || thePixFmt == stAV::PIX_FMT::YUVA444P10
+           || thePixFmt == stAV::PIX_FMT::YUVA444P16) {
         theDims.widthY  = theDims.widthU  = theDims.widthV  = theWidth;
         theDims.heightY = theDims.heightU = theDims.heightV = theHeight;
         theDims.isFullScale = (thePixFmt == stAV::PIX_FMT::YUVJ444P);
@@ -381,16 +445,63 @@ bool stAV::isFormatYUVPlanar(const AVPixelFormat thePixFmt,
         theDims.bitsPerComp = 9;
     } else if(thePixFmt == stAV::PIX_FMT::YUV420P10
            || thePixFmt == stAV::PIX_FMT::YUV422P10
-           || thePixFmt == stAV::PIX_FMT::YUV444P10) {
+           || thePixFmt == stAV::PIX_FMT::YUV444P10
+           || thePixFmt == stAV::PIX_FMT::YUVA420P10
+           || thePixFmt == stAV::PIX_FMT::YUVA422P10
+           || thePixFmt == stAV::PIX_FMT::YUVA444P10) {
         theDims.bitsPerComp = 10;
+    } else if(thePixFmt == stAV::PIX_FMT::YUV420P12
+           || thePixFmt == stAV::PIX_FMT::YUV422P12
+           || thePixFmt == stAV::PIX_FMT::YUV444P12) {
+        theDims.bitsPerComp = 12;
     } else if(thePixFmt == stAV::PIX_FMT::YUV420P16
            || thePixFmt == stAV::PIX_FMT::YUV422P16
-           || thePixFmt == stAV::PIX_FMT::YUV444P16) {
+           || thePixFmt == stAV::PIX_FMT::YUV444P16
+           || thePixFmt == stAV::PIX_FMT::YUVA420P16
+           || thePixFmt == stAV::PIX_FMT::YUVA422P16
+           || thePixFmt == stAV::PIX_FMT::YUVA444P16) {
         theDims.bitsPerComp = 16;
     } else {
         theDims.bitsPerComp = 8;
     }
 
+    theDims.hasAlpha = thePixFmt == stAV::PIX_FMT::YUVA420P
+                    || thePixFmt == stAV::PIX_FMT::YUVA422P
+                    || thePixFmt == stAV::PIX_FMT::YUVA444P
+                    || thePixFmt == stAV::PIX_FMT::YUVA420P10
+                    || thePixFmt == stAV::PIX_FMT::YUVA422P10
+                    || thePixFmt == stAV::PIX_FMT::YUVA444P10
+                    || thePixFmt == stAV::PIX_FMT::YUVA420P16
+                    || thePixFmt == stAV::PIX_FMT::YUVA422P16
+                    || thePixFmt == stAV::PIX_FMT::YUVA444P16;
+    return true;
+}
+
+bool stAV::isFormatGBRPlanar(const AVPixelFormat thePixFmt,
+                             int&                theBitsPerComp,
+                             bool&               theHasAlpha) {
+    theHasAlpha = false;
+    if(thePixFmt == stAV::PIX_FMT::NONE) {
+        return false;
+    } else if(thePixFmt == stAV::PIX_FMT::GBRP) {
+        theBitsPerComp = 8;
+    } else if(thePixFmt == stAV::PIX_FMT::GBRP9) {
+        theBitsPerComp = 9;
+    } else if(thePixFmt == stAV::PIX_FMT::GBRP10) {
+        theBitsPerComp = 10;
+    } else if(thePixFmt == stAV::PIX_FMT::GBRP12) {
+        theBitsPerComp = 12;
+    } else if(thePixFmt == stAV::PIX_FMT::GBRP16) {
+        theBitsPerComp = 16;
+    } else if(thePixFmt == stAV::PIX_FMT::GBRAP) {
+        theBitsPerComp = 8;
+        theHasAlpha    = true;
+    } else if(thePixFmt == stAV::PIX_FMT::GBRAP16) {
+        theBitsPerComp = 16;
+        theHasAlpha    = true;
+    } else {
+        return false;
+    }
     return true;
 }
 
@@ -0,0 +1,107 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StTests program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StTests program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StTestEvents.h"
+
+#include "../StCore/StEventsBuffer.h"
+
+#include <StStrings/stConsole.h>
+#include <StTemplates/StHandle.h>
+
+namespace {
+
+    static const uint32_t THE_NB_EVENTS    = 4000000; // events per producer thread
+    static const int      THE_NB_PRODUCERS = 3;
+    static volatile int32_t TheNbAppendDone = 0;
+
+    struct StProducerInfo {
+        StEventsBuffer* Buffer;
+        StVirtKey       Key;
+    };
+
+}
+
+SV_THREAD_FUNCTION StTestEvents::appendLoop(void* theInfo) {
+    const StProducerInfo* anInfo = (const StProducerInfo* )theInfo;
+    StEvent anEvent;
+    anEvent.Type       = stEvent_KeyDown;
+    anEvent.Key.Time   = 0.0;
+    anEvent.Key.VKey   = anInfo->Key;
+    anEvent.Key.Flags  = ST_VF_NONE;
+    for(uint32_t anIter = 1; anIter <= THE_NB_EVENTS; ++anIter) {
+        anEvent.Key.Char = anIter;
+        anInfo->Buffer->append(anEvent);
+    }
+    StAtomicOp::Increment(TheNbAppendDone);
+    return SV_THREAD_RETURN 0;
+}
+
+void StTestEvents::perform() {
+    st::cout << stostream_text("Events buffer flood test (") << THE_NB_PRODUCERS << stostream_text(" threads, ")
+             << THE_NB_EVENTS << stostream_text(" events per thread).\n");
+
+    StEventsBuffer* aBuffer = new StEventsBuffer();
+    size_t   aNbFetched = 0;
+    size_t   aSizeMax   = 0;
+    size_t   aNbErrors  = 0;
+    uint32_t aLastChar[THE_NB_PRODUCERS] = {};
+    StProducerInfo anInfos[THE_NB_PRODUCERS];
+    StHandle<StThread> aThreads[THE_NB_PRODUCERS];
+    TheNbAppendDone = 0;
+    myTimer.restart();
+    for(int aThreadIter = 0; aThreadIter < THE_NB_PRODUCERS; ++aThreadIter) {
+        anInfos[aThreadIter].Buffer = aBuffer;
+        anInfos[aThreadIter].Key    = StVirtKey(ST_VK_A + aThreadIter);
+        aThreads[aThreadIter] = new StThread(appendLoop, &anInfos[aThreadIter]);
+    }
+    for(;;) {
+        const bool isLastSwap = TheNbAppendDone == THE_NB_PRODUCERS;
+        StAtomicOp::Barrier();
+        aBuffer->swapBuffers();
+        const size_t aSize = aBuffer->getSize();
+        aSizeMax = stMax(aSizeMax, aSize);
+        if(aSize > StEventsBuffer::BUFFER_SIZE) {
+            ++aNbErrors;
+            break;
+        }
+        for(size_t anIter = 0; anIter < aSize; ++anIter) {
+            // events might be lost when ring is full, but never reordered or duplicated
+            const StKeyEvent& anEvent = aBuffer->getEvent(anIter).Key;
+            const int aThreadId = int(anEvent.VKey) - int(ST_VK_A);
+            if(aThreadId < 0 || aThreadId >= THE_NB_PRODUCERS
+            || anEvent.Char <= aLastChar[aThreadId]) {
+                ++aNbErrors;
+                continue;
+            }
+            aLastChar[aThreadId] = anEvent.Char;
+        }
+        aNbFetched += aSize;
+        if(isLastSwap) {
+            break;
+        }
+    }
+    for(int aThreadIter = 0; aThreadIter < THE_NB_PRODUCERS; ++aThreadIter) {
+        aThreads[aThreadIter]->wait();
+    }
+    const double aTimeMSec = myTimer.getElapsedTimeInMilliSec();
+    delete aBuffer;
+
+    st::cout << stostream_text("  fetched:\t")         << aNbFetched << stostream_text(" events in ") << aTimeMSec << stostream_text(" msec\n")
+             << stostream_text("  max swap size:\t")   << aSizeMax   << stostream_text(" (limit ") << StEventsBuffer::BUFFER_SIZE << stostream_text(")\n")
+             << stostream_text("  errors:\t")          << aNbErrors  << stostream_text("\n");
+}
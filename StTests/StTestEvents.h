@@ -0,0 +1,44 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StTests program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StTests program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __StTestEvents_h_
+#define __StTestEvents_h_
+
+#include "StTest.h"
+#include <StThreads/StThread.h>
+
+/**
+ * Stress test of StEventsBuffer: floods append() from several threads
+ * while consumer thread keeps calling swapBuffers().
+ */
+class ST_LOCAL StTestEvents : public StTest {
+
+        public:
+
+    virtual void perform() ST_ATTR_OVERRIDE;
+
+        private:
+
+    /**
+     * Append events in loop.
+     */
+    static SV_THREAD_FUNCTION appendLoop(void* theInfo);
+
+};
+
+#endif // __StTestEvents_h_
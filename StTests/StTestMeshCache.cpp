@@ -0,0 +1,274 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StTests program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StTests program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StTestMeshCache.h"
+#include "../StCADViewer/StAssetMeshCache.h"
+
+#include <StFile/StFolder.h>
+#include <StFile/StRawFile.h>
+#include <StStrings/stConsole.h>
+#include <StThreads/StProcess.h>
+
+#include <gp_Ax1.hxx>
+#include <gp_Vec.hxx>
+
+#include <cstring>
+
+/**
+ * Texture with image data embedded into another file.
+ */
+class StTestEmbeddedTexture : public StAssetTexture {
+
+    DEFINE_STANDARD_RTTI_INLINE(StTestEmbeddedTexture, StAssetTexture)
+
+        public:
+
+    StTestEmbeddedTexture(const StString& theUri,
+                          const Handle(NCollection_Buffer)& theData)
+    : StAssetTexture(theUri),
+      myData(theData) {
+        myTexId = (StString("texture://") + theUri + "@embedded").toCString();
+    }
+
+    virtual Handle(NCollection_Buffer) readEmbeddedData(StString& theMime) const Standard_OVERRIDE {
+        theMime = "image/png";
+        return myData;
+    }
+
+        private:
+
+    Handle(NCollection_Buffer) myData;
+
+};
+
+namespace {
+
+    static void printResult(const char* theName,
+                            const bool  theIsOk,
+                            size_t&     theNbErrors) {
+        st::cout << stostream_text("  ") << theName << stostream_text(":\t")
+                 << (theIsOk ? stostream_text("OK\n") : stostream_text("FAILED\n"));
+        if(!theIsOk) {
+            ++theNbErrors;
+        }
+    }
+
+    static Handle(StPrimArray) createTriangle(const Handle(StGLMaterial)& theMat,
+                                              const float theShift) {
+        Handle(StPrimArray) aPrims = new StPrimArray();
+        aPrims->Material = theMat;
+        aPrims->Trsf.SetTranslation(gp_Vec(theShift, 0.0, 0.0));
+        aPrims->Positions.push_back(StGLVec3(0.0f, 0.0f, theShift));
+        aPrims->Positions.push_back(StGLVec3(1.0f, 0.0f, theShift));
+        aPrims->Positions.push_back(StGLVec3(0.0f, 1.0f, theShift));
+        aPrims->Normals.resize(3, StGLVec3(0.0f, 0.0f, 1.0f));
+        aPrims->TexCoords0.push_back(StGLVec2(0.0f, 0.0f));
+        aPrims->TexCoords0.push_back(StGLVec2(1.0f, 0.0f));
+        aPrims->TexCoords0.push_back(StGLVec2(0.0f, 1.0f));
+        aPrims->Indices.push_back(0);
+        aPrims->Indices.push_back(1);
+        aPrims->Indices.push_back(2);
+        return aPrims;
+    }
+
+    static bool isEqualTrsf(const gp_Trsf& theTrsf1,
+                            const gp_Trsf& theTrsf2) {
+        for(int aRow = 1; aRow <= 3; ++aRow) {
+            for(int aCol = 1; aCol <= 4; ++aCol) {
+                if(theTrsf1.Value(aRow, aCol) != theTrsf2.Value(aRow, aCol)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    template<typename T>
+    static bool isEqualVector(const std::vector<T>& theVec1,
+                              const std::vector<T>& theVec2) {
+        return theVec1.size() == theVec2.size()
+           && (theVec1.empty() || std::memcmp(&theVec1[0], &theVec2[0], theVec1.size() * sizeof(T)) == 0);
+    }
+
+    static bool isEqualTexture(const Handle(StAssetTexture)& theTex1,
+                               const Handle(StAssetTexture)& theTex2) {
+        if(theTex1.IsNull() || theTex2.IsNull()) {
+            return theTex1.IsNull() == theTex2.IsNull();
+        }
+
+        StString aMime1, aMime2;
+        Handle(NCollection_Buffer) aData1 = theTex1->readEmbeddedData(aMime1);
+        Handle(NCollection_Buffer) aData2 = theTex2->readEmbeddedData(aMime2);
+        if(theTex1->GetId() != theTex2->GetId()
+        || theTex1->getImageUri() != theTex2->getImageUri()
+        || aData1.IsNull() != aData2.IsNull()) {
+            return false;
+        }
+        return aData1.IsNull()
+            || (aMime1 == aMime2
+             && aData1->Size() == aData2->Size()
+             && std::memcmp(aData1->Data(), aData2->Data(), aData1->Size()) == 0);
+    }
+
+}
+
+Handle(StDocNode) StTestMeshCache::createDocument() const {
+    Handle(StGLMaterial) aMatFile = new StGLMaterial();
+    aMatFile->Name = "file texture";
+    aMatFile->DiffuseColor = StGLVec4(1.0f, 0.5f, 0.25f, 1.0f);
+    aMatFile->Texture = new StAssetTexture("textures/part.png");
+
+    Handle(NCollection_Buffer) anImageData = new NCollection_Buffer(NCollection_BaseAllocator::CommonBaseAllocator());
+    anImageData->Allocate(37);
+    for(size_t aByteIter = 0; aByteIter < anImageData->Size(); ++aByteIter) {
+        anImageData->ChangeData()[aByteIter] = Standard_Byte(aByteIter * 7);
+    }
+    Handle(StGLMaterial) aMatEmbedded = new StGLMaterial();
+    aMatEmbedded->Name = "embedded texture";
+    aMatEmbedded->EmissiveColor = StGLVec4(0.0f, 0.1f, 0.2f, 1.0f);
+    aMatEmbedded->Texture = new StTestEmbeddedTexture("model.glb", anImageData);
+
+    Handle(StDocMeshNode) aPart = new StDocMeshNode();
+    aPart->setNodeName("Part");
+    aPart->setNbOccurrences(2);
+    aPart->ChangePrimitiveArrays().Append(createTriangle(aMatFile, 0.0f));
+    aPart->ChangePrimitiveArrays().Append(createTriangle(Handle(StGLMaterial)(), 1.0f));
+
+    Handle(StDocMeshNode) aDecal = new StDocMeshNode();
+    aDecal->setNodeName("Decal");
+    aDecal->ChangePrimitiveArrays().Append(createTriangle(aMatEmbedded, 2.0f));
+
+    // nested assembly referring to the same part twice
+    gp_Trsf aSubTrsf;
+    aSubTrsf.SetRotation(gp_Ax1(gp_Pnt(0.0, 0.0, 0.0), gp_Dir(0.0, 0.0, 1.0)), 0.5);
+    Handle(StDocObjectNode) aSubAssembly = new StDocObjectNode();
+    aSubAssembly->setNodeName("SubAssembly");
+    aSubAssembly->setNodeTransformation(aSubTrsf);
+    aSubAssembly->ChangeChildren().Append(aPart);
+
+    gp_Trsf anAsmTrsf;
+    anAsmTrsf.SetTranslation(gp_Vec(10.0, 20.0, 30.0));
+    Handle(StDocObjectNode) anAssembly = new StDocObjectNode();
+    anAssembly->setNodeName("Assembly");
+    anAssembly->setNodeTransformation(anAsmTrsf);
+    anAssembly->ChangeChildren().Append(aSubAssembly);
+    anAssembly->ChangeChildren().Append(aPart);
+
+    Handle(StDocNode) aRoot = new StDocObjectNode();
+    aRoot->ChangeChildren().Append(anAssembly);
+    aRoot->ChangeChildren().Append(aDecal);
+    return aRoot;
+}
+
+bool StTestMeshCache::isEqualPrims(const Handle(StPrimArray)& thePrims1,
+                                   const Handle(StPrimArray)& thePrims2) const {
+    if(!isEqualTrsf(thePrims1->Trsf, thePrims2->Trsf)
+    || !isEqualVector(thePrims1->Positions,  thePrims2->Positions)
+    || !isEqualVector(thePrims1->Normals,    thePrims2->Normals)
+    || !isEqualVector(thePrims1->TexCoords0, thePrims2->TexCoords0)
+    || !isEqualVector(thePrims1->Indices,    thePrims2->Indices)
+    ||  thePrims1->Material.IsNull() != thePrims2->Material.IsNull()) {
+        return false;
+    } else if(thePrims1->Material.IsNull()) {
+        return true;
+    }
+
+    const StGLMaterial& aMat1 = *thePrims1->Material;
+    const StGLMaterial& aMat2 = *thePrims2->Material;
+    return aMat1.Name == aMat2.Name
+        && aMat1.isEqual(aMat2)
+        && isEqualTexture(aMat1.Texture, aMat2.Texture);
+}
+
+bool StTestMeshCache::isEqualTree(const Handle(StDocNode)& theNode1,
+                                  const Handle(StDocNode)& theNode2) const {
+    if(theNode1->nodeType() != theNode2->nodeType()
+    || theNode1->nodeName() != theNode2->nodeName()
+    || theNode1->Children().Size() != theNode2->Children().Size()
+    || !isEqualTrsf(theNode1->nodeTransformation(), theNode2->nodeTransformation())) {
+        return false;
+    }
+
+    if(theNode1->nodeType() == StDocNodeType_Mesh) {
+        const Handle(StDocMeshNode) aMesh1 = Handle(StDocMeshNode)::DownCast(theNode1);
+        const Handle(StDocMeshNode) aMesh2 = Handle(StDocMeshNode)::DownCast(theNode2);
+        if(aMesh1->nbOccurrences() != aMesh2->nbOccurrences()
+        || aMesh1->PrimitiveArrays().Size() != aMesh2->PrimitiveArrays().Size()) {
+            return false;
+        }
+        for(int aPrimIter = 1; aPrimIter <= aMesh1->PrimitiveArrays().Size(); ++aPrimIter) {
+            if(!isEqualPrims(aMesh1->PrimitiveArrays().Value(aPrimIter), aMesh2->PrimitiveArrays().Value(aPrimIter))) {
+                return false;
+            }
+        }
+    }
+
+    for(int aChildIter = 1; aChildIter <= theNode1->Children().Size(); ++aChildIter) {
+        if(!isEqualTree(theNode1->Children().Value(aChildIter), theNode2->Children().Value(aChildIter))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void StTestMeshCache::perform() {
+    st::cout << stostream_text("Mesh cache round-trip test.\n");
+
+    const StString aFolder = StProcess::getTempFolder() + "stmeshcachetest" + SYS_FS_SPLITTER;
+    StFolder::createFolder(aFolder);
+    const StAssetMeshCache aCache(aFolder);
+
+    size_t aNbErrors = 0;
+    {
+        // nested assembly with shared mesh and textured materials
+        Handle(StDocNode) aDoc = createDocument();
+        Handle(StDocNode) aRestored = new StDocObjectNode();
+        const bool isSaved  = aCache.save("test", aDoc);
+        const bool isLoaded = isSaved && aCache.load("test", aRestored);
+        printResult("round-trip", isLoaded && isEqualTree(aDoc, aRestored), aNbErrors);
+
+        // instances should refer to the same mesh node
+        bool isShared = false;
+        if(isLoaded
+        && aRestored->Children().Size() == 2
+        && aRestored->Children().First()->Children().Size() == 2) {
+            const Handle(StDocNode)& anAssembly = aRestored->Children().First();
+            isShared = anAssembly->Children().First()->Children().Size() == 1
+                    && anAssembly->Children().First()->Children().First() == anAssembly->Children().Last();
+        }
+        printResult("instances", isShared, aNbErrors);
+    }
+    {
+        // the key should depend on the whole file content
+        const StString aModelPath = aFolder + "model.bin";
+        StRawFile aModel(aModelPath);
+        aModel.initBuffer(3 * 1024 * 1024);
+        std::memset(aModel.changeBuffer(), 0, aModel.getSize());
+        aModel.saveFile();
+        const StString aKey1 = StAssetMeshCache::computeKey(aModelPath, 0.001, 0.5);
+
+        aModel.changeBuffer()[aModel.getSize() - 1] = 1;
+        aModel.saveFile();
+        const StString aKey2 = StAssetMeshCache::computeKey(aModelPath, 0.001, 0.5);
+        StFileNode::removeFile(aModelPath);
+        printResult("key", !aKey1.isEmpty() && !aKey2.isEmpty() && aKey1 != aKey2, aNbErrors);
+    }
+    StFileNode::removeFile(aFolder + "mesh_test.stmesh");
+
+    st::cout << stostream_text("  errors:\t") << aNbErrors << stostream_text("\n");
+}
@@ -0,0 +1,56 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StTests program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StTests program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __StTestMeshCache_h_
+#define __StTestMeshCache_h_
+
+#include "StTest.h"
+#include "../StCADViewer/StAssetDocument.h"
+
+/**
+ * Checks that StAssetMeshCache restores the document written into the cache:
+ * nested object nodes, mesh instances, primitive arrays and textured materials.
+ */
+class ST_LOCAL StTestMeshCache : public StTest {
+
+        public:
+
+    virtual void perform() ST_ATTR_OVERRIDE;
+
+        private:
+
+    /**
+     * Create the document with nested assembly, shared mesh and textured materials.
+     */
+    Handle(StDocNode) createDocument() const;
+
+    /**
+     * Compare two trees.
+     */
+    bool isEqualTree(const Handle(StDocNode)& theNode1,
+                     const Handle(StDocNode)& theNode2) const;
+
+    /**
+     * Compare two primitive arrays including their materials.
+     */
+    bool isEqualPrims(const Handle(StPrimArray)& thePrims1,
+                      const Handle(StPrimArray)& thePrims2) const;
+
+};
+
+#endif // __StTestMeshCache_h_
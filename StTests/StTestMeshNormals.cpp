@@ -0,0 +1,153 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StTests program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StTests program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StTestMeshNormals.h"
+
+#include <StStrings/stConsole.h>
+#include <StFile/StRawFile.h>
+
+#include <cmath>
+#include <cstring>
+#include <map>
+
+namespace {
+
+    static const size_t THE_GRID_SIZE = 3000; // 18M triangles
+
+    /**
+     * Lexicographical comparison of nodes for merging.
+     */
+    struct StVec3Less {
+        bool operator()(const StGLVec3& theLeft, const StGLVec3& theRight) const {
+            return std::memcmp(theLeft.getData(), theRight.getData(), sizeof(StGLVec3)) < 0;
+        }
+    };
+
+}
+
+StTestMeshNormals::StTestMeshNormals(const StString& theFile)
+: myFilePath(theFile) {
+    //
+}
+
+void StTestMeshNormals::generateGrid(const size_t theSize) {
+    myVertices.resize((theSize + 1) * (theSize + 1));
+    myIndices.resize(theSize * theSize * 6);
+    for(size_t aRow = 0; aRow <= theSize; ++aRow) {
+        for(size_t aCol = 0; aCol <= theSize; ++aCol) {
+            const float aX = float(aCol) / float(theSize);
+            const float aY = float(aRow) / float(theSize);
+            myVertices[aRow * (theSize + 1) + aCol] = StGLVec3(aX, aY, 0.1f * std::sin(aX * 20.0f) * std::cos(aY * 20.0f));
+        }
+    }
+
+    size_t anIndexIter = 0;
+    for(size_t aRow = 0; aRow < theSize; ++aRow) {
+        for(size_t aCol = 0; aCol < theSize; ++aCol) {
+            const GLuint aNode = GLuint(aRow * (theSize + 1) + aCol);
+            myIndices[anIndexIter++] = aNode;
+            myIndices[anIndexIter++] = aNode + 1;
+            myIndices[anIndexIter++] = aNode + GLuint(theSize) + 2;
+            myIndices[anIndexIter++] = aNode;
+            myIndices[anIndexIter++] = aNode + GLuint(theSize) + 2;
+            myIndices[anIndexIter++] = aNode + GLuint(theSize) + 1;
+        }
+    }
+}
+
+bool StTestMeshNormals::readStl() {
+    myVertices.clear();
+    myIndices.clear();
+
+    StRawFile aRawFile(myFilePath);
+    if(!aRawFile.readFile()) {
+        st::cout << stostream_text("  file can not be read.\n");
+        return false;
+    }
+
+    // binary STL: 80 bytes header, number of triangles and 50 bytes per triangle
+    const stUByte_t* aData = aRawFile.getBuffer();
+    uint32_t aNbTris = 0;
+    if(aRawFile.getSize() >= 84) {
+        std::memcpy(&aNbTris, aData + 80, sizeof(uint32_t));
+    }
+    if(aNbTris == 0
+    || aRawFile.getSize() < 84 + size_t(aNbTris) * 50) {
+        st::cout << stostream_text("  file is not a binary STL.\n");
+        return false;
+    }
+
+    std::map<StGLVec3, GLuint, StVec3Less> aNodeMap;
+    myIndices.reserve(size_t(aNbTris) * 3);
+    for(uint32_t aTriIter = 0; aTriIter < aNbTris; ++aTriIter) {
+        // skip facet normal
+        const stUByte_t* aTriData = aData + 84 + size_t(aTriIter) * 50 + 12;
+        for(int aNodeIter = 0; aNodeIter < 3; ++aNodeIter) {
+            float aCoords[3];
+            std::memcpy(aCoords, aTriData + aNodeIter * 12, sizeof(aCoords));
+            const StGLVec3 aNode(aCoords[0], aCoords[1], aCoords[2]);
+            std::map<StGLVec3, GLuint, StVec3Less>::iterator aFound = aNodeMap.find(aNode);
+            if(aFound == aNodeMap.end()) {
+                aFound = aNodeMap.insert(std::make_pair(aNode, GLuint(myVertices.size()))).first;
+                myVertices.push_back(aNode);
+            }
+            myIndices.push_back(aFound->second);
+        }
+    }
+    return true;
+}
+
+void StTestMeshNormals::testMesh() {
+    st::cout << stostream_text("  vertices:\t") << myVertices.size()
+             << stostream_text(", triangles: ") << (myIndices.size() / 3) << stostream_text("\n");
+
+    std::vector<StGLVec3> aNormals1(myVertices.size());
+    myTimer.restart();
+    StGLMesh::computeNormals(&aNormals1[0], &myVertices[0], myVertices.size(),
+                             &myIndices[0], myIndices.size(), 3, NULL);
+    const double aTime1 = myTimer.getElapsedTimeInMilliSec();
+    st::cout << stostream_text("  1  thread:\t") << aTime1 << stostream_text(" msec\n");
+
+    StThreadPool aPool;
+    std::vector<StGLVec3> aNormals2(myVertices.size());
+    myTimer.restart();
+    StGLMesh::computeNormals(&aNormals2[0], &myVertices[0], myVertices.size(),
+                             &myIndices[0], myIndices.size(), 3, &aPool);
+    const double aTime2 = myTimer.getElapsedTimeInMilliSec();
+    st::cout << stostream_text("  ") << aPool.getNbThreads() << stostream_text(" threads:\t") << aTime2 << stostream_text(" msec")
+             << stostream_text(" (speedup ") << (aTime1 / stMax(aTime2, 0.001)) << stostream_text("x)\n");
+
+    const bool isSame = std::memcmp(&aNormals1[0], &aNormals2[0], sizeof(StGLVec3) * aNormals1.size()) == 0;
+    st::cout << stostream_text("  results:\t") << (isSame ? stostream_text("identical\n") : stostream_text("DIFFERENT!\n"));
+}
+
+void StTestMeshNormals::perform() {
+    st::cout << stostream_text("Mesh normals computation speed tests\n");
+    st::cout << stostream_text("Synthetic grid:\n");
+    generateGrid(THE_GRID_SIZE);
+    testMesh();
+
+    if(myFilePath.isEmpty()) {
+        return;
+    }
+
+    st::cout << stostream_text("STL file '") << myFilePath << stostream_text("':\n");
+    if(readStl()) {
+        testMesh();
+    }
+}
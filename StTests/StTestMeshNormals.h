@@ -0,0 +1,67 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StTests program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StTests program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __StTestMeshNormals_h_
+#define __StTestMeshNormals_h_
+
+#include "StTest.h"
+#include <StGLMesh/StGLMesh.h>
+
+#include <vector>
+
+/**
+ * Tests performance of normals computation for synthetic grid and for mesh read from binary STL file.
+ */
+class ST_LOCAL StTestMeshNormals : public StTest {
+
+        public:
+
+    /**
+     * Main constructor.
+     * @param theFile optional path to binary STL file
+     */
+    StTestMeshNormals(const StString& theFile);
+
+    virtual void perform() ST_ATTR_OVERRIDE;
+
+        private:
+
+    /**
+     * Generate the regular grid of specified dimensions.
+     */
+    void generateGrid(const size_t theSize);
+
+    /**
+     * Read binary STL file and merge coincident nodes.
+     */
+    bool readStl();
+
+    /**
+     * Compute normals within single thread and using thread pool, compare results.
+     */
+    void testMesh();
+
+        private:
+
+    StString              myFilePath;
+    std::vector<StGLVec3> myVertices;
+    std::vector<GLuint>   myIndices;
+
+};
+
+#endif // __StTestMeshNormals_h_
@@ -0,0 +1,106 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StTests program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StTests program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StTestPalette.h"
+
+#include <StAV/stAV.h>
+#include <StImage/StImagePlane.h>
+#include <StStrings/stConsole.h>
+
+#include <cstdlib>
+#include <vector>
+
+extern "C" {
+    #include <libswscale/swscale.h>
+};
+
+namespace {
+
+    static const size_t THE_RECT_SIZE_X = 1920; // typical Blu-ray subtitle rectangle
+    static const size_t THE_RECT_SIZE_Y = 200;
+    static const size_t THE_ITERATIONS  = 500;
+
+}
+
+void StTestPalette::perform() {
+    st::cout << stostream_text("Bitmap subtitles palette expansion (") << THE_ITERATIONS << stostream_text(" rectangles ")
+             << THE_RECT_SIZE_X << stostream_text("x") << THE_RECT_SIZE_Y << stostream_text(").\n");
+
+    // synthetic indexed image with anti-aliased text-like runs
+    std::vector<uint8_t>  anIndices(THE_RECT_SIZE_X * THE_RECT_SIZE_Y);
+    std::vector<uint32_t> aPalette(256);
+    for(size_t aColorIter = 0; aColorIter < aPalette.size(); ++aColorIter) {
+        const uint32_t aLevel = uint32_t(aColorIter);
+        aPalette[aColorIter] = (aLevel << 24) | (aLevel << 16) | ((255 - aLevel) << 8) | (aLevel / 2);
+    }
+    uint32_t aSeed = 12345;
+    for(size_t aPixelIter = 0; aPixelIter < anIndices.size(); ++aPixelIter) {
+        aSeed = aSeed * 1103515245u + 12345u;
+        anIndices[aPixelIter] = uint8_t((aSeed >> 16) & 0x0F);
+    }
+
+    // direct palette expansion
+    StImagePlane aDirect;
+    myTimer.restart();
+    for(size_t anIter = 0; anIter < THE_ITERATIONS; ++anIter) {
+        aDirect.initFromPalette(&anIndices[0], THE_RECT_SIZE_X, &aPalette[0], THE_RECT_SIZE_X, THE_RECT_SIZE_Y);
+    }
+    const double aTimeDirect = myTimer.getElapsedTimeInMilliSec();
+    st::cout << stostream_text("  direct:\t") << aTimeDirect << stostream_text(" msec")
+             << stostream_text(" (one rect:\t") << (aTimeDirect / double(THE_ITERATIONS)) << stostream_text(" msec)\n");
+
+    // swscale context per rectangle, as done previously
+    StImagePlane aScaled;
+    uint8_t* aSrcData[4] = { &anIndices[0], (uint8_t* )&aPalette[0], NULL, NULL };
+    int aSrcLinesize[4]  = { int(THE_RECT_SIZE_X), 0, 0, 0 };
+    myTimer.restart();
+    for(size_t anIter = 0; anIter < THE_ITERATIONS; ++anIter) {
+        aScaled.initTrash(StImagePlane::ImgRGBA, THE_RECT_SIZE_X, THE_RECT_SIZE_Y);
+        SwsContext* aCtxToRgb = sws_getContext(int(THE_RECT_SIZE_X), int(THE_RECT_SIZE_Y), stAV::PIX_FMT::PAL8,
+                                               int(THE_RECT_SIZE_X), int(THE_RECT_SIZE_Y), stAV::PIX_FMT::RGBA32,
+                                               SWS_BICUBIC, NULL, NULL, NULL);
+        if(aCtxToRgb == NULL) {
+            st::cout << stostream_text("  swscale:\tunavailable\n");
+            return;
+        }
+
+        uint8_t* aDstData[4] = { aScaled.changeData(), NULL, NULL, NULL };
+        int aDstLinesize[4]  = { int(aScaled.getSizeRowBytes()), 0, 0, 0 };
+        sws_scale(aCtxToRgb, aSrcData, aSrcLinesize, 0, int(THE_RECT_SIZE_Y), aDstData, aDstLinesize);
+        sws_freeContext(aCtxToRgb);
+    }
+    const double aTimeSws = myTimer.getElapsedTimeInMilliSec();
+    st::cout << stostream_text("  swscale:\t") << aTimeSws << stostream_text(" msec")
+             << stostream_text(" (one rect:\t") << (aTimeSws / double(THE_ITERATIONS)) << stostream_text(" msec)\n");
+
+    // validate results
+    size_t aNbDiffs = 0;
+    for(size_t aRow = 0; aRow < THE_RECT_SIZE_Y; ++aRow) {
+        for(size_t aCol = 0; aCol < THE_RECT_SIZE_X; ++aCol) {
+            const GLubyte* aPix1 = aDirect.getData(aRow, aCol);
+            const GLubyte* aPix2 = aScaled.getData(aRow, aCol);
+            for(int aComp = 0; aComp < 4; ++aComp) {
+                if(std::abs(int(aPix1[aComp]) - int(aPix2[aComp])) > 1) {
+                    ++aNbDiffs;
+                    break;
+                }
+            }
+        }
+    }
+    st::cout << stostream_text("  mismatched pixels:\t") << aNbDiffs << stostream_text("\n");
+}
@@ -0,0 +1,111 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StTests program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StTests program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StTestTextureQueue.h"
+
+#include <StGL/StGLContext.h>
+#include <StStrings/stConsole.h>
+
+namespace {
+
+    static const size_t THE_QUEUE_SIZE = 4;
+    static const size_t THE_IMAGE_SIZE = 16;
+
+    static void printResult(const char* theName,
+                            const bool  theIsOk,
+                            size_t&     theNbErrors) {
+        st::cout << stostream_text("  ") << theName << stostream_text(":\t")
+                 << (theIsOk ? stostream_text("OK\n") : stostream_text("FAILED\n"));
+        if(!theIsOk) {
+            ++theNbErrors;
+        }
+    }
+
+}
+
+void StTestTextureQueue::push(StGLTextureQueue& theQueue,
+                              const double      thePts,
+                              const bool        theIsRightRepeated) {
+    theQueue.push(myImageL, myImageR, StHandle<StStereoParams>(),
+                  StFormat_SeparateFrames, StCubemap_OFF, thePts, theIsRightRepeated);
+}
+
+bool StTestTextureQueue::swap(StGLTextureQueue& theQueue,
+                              bool&             theIsRightSwapped) {
+    StGLContext aCtx(false);
+    StGLQuadTexture& aQTexture = theQueue.getQTexture();
+    const StGLFrameTextures* aFrontL = &aQTexture.getFront(StGLQuadTexture::LEFT_TEXTURE);
+    const StGLFrameTextures* aFrontR = &aQTexture.getFront(StGLQuadTexture::RIGHT_TEXTURE);
+    theQueue.stglSwapFB(0);
+    theQueue.stglUpdateStTextures(aCtx);
+    theIsRightSwapped = &aQTexture.getFront(StGLQuadTexture::RIGHT_TEXTURE) != aFrontR;
+    return &aQTexture.getFront(StGLQuadTexture::LEFT_TEXTURE) != aFrontL;
+}
+
+void StTestTextureQueue::perform() {
+    st::cout << stostream_text("Texture queue repeated right view test.\n");
+
+    for(int aViewIter = 0; aViewIter < 2; ++aViewIter) {
+        StImage& anImage = aViewIter == 0 ? myImageL : myImageR;
+        anImage.setColorModel(StImage::ImgColor_RGB);
+        anImage.changePlane(0).initZero(StImagePlane::ImgRGB, THE_IMAGE_SIZE, THE_IMAGE_SIZE);
+    }
+
+    size_t aNbErrors = 0;
+    bool isRightSwapped = false;
+    {
+        // repeated right view should be kept within front texture
+        StGLTextureQueue aQueue(THE_QUEUE_SIZE);
+        push(aQueue, 0.0, false);
+        push(aQueue, 1.0, true);
+        const bool isFreshOk    = swap(aQueue, isRightSwapped) &&  isRightSwapped;
+        const bool isRepeatedOk = swap(aQueue, isRightSwapped) && !isRightSwapped;
+        printResult("repeat", isFreshOk && isRepeatedOk, aNbErrors);
+    }
+    {
+        // dropped frame carried the right view - the next one should upload it
+        StGLTextureQueue aQueue(THE_QUEUE_SIZE);
+        push(aQueue, 0.0, false);
+        push(aQueue, 1.0, true);
+        aQueue.drop(1);
+        const bool isSwapped = swap(aQueue, isRightSwapped);
+        printResult("drop", isSwapped && isRightSwapped, aNbErrors);
+    }
+    {
+        // dropped frame repeated the right view - the next repeated one should not upload it
+        StGLTextureQueue aQueue(THE_QUEUE_SIZE);
+        push(aQueue, 0.0, false);
+        swap(aQueue, isRightSwapped);
+        push(aQueue, 1.0, true);
+        push(aQueue, 2.0, true);
+        aQueue.drop(1);
+        const bool isSwapped = swap(aQueue, isRightSwapped);
+        printResult("drop repeated", isSwapped && !isRightSwapped, aNbErrors);
+    }
+    {
+        // queue has been cleared - the next frame should upload the right view
+        StGLTextureQueue aQueue(THE_QUEUE_SIZE);
+        push(aQueue, 0.0, false);
+        aQueue.clear();
+        push(aQueue, 1.0, true);
+        const bool isSwapped = swap(aQueue, isRightSwapped);
+        printResult("clear", isSwapped && isRightSwapped, aNbErrors);
+    }
+
+    st::cout << stostream_text("  errors:\t") << aNbErrors << stostream_text("\n");
+}
@@ -0,0 +1,60 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StTests program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StTests program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __StTestTextureQueue_h_
+#define __StTestTextureQueue_h_
+
+#include "StTest.h"
+#include <StGLStereo/StGLTextureQueue.h>
+
+/**
+ * Checks that repeated right views are kept in sync with left views
+ * when frames are dropped from or cleared within StGLTextureQueue.
+ * Textures are not uploaded (GL context is not bound), only front/back swapping is verified.
+ */
+class ST_LOCAL StTestTextureQueue : public StTest {
+
+        public:
+
+    virtual void perform() ST_ATTR_OVERRIDE;
+
+        private:
+
+    /**
+     * Push the frame in separate frames stereo layout.
+     */
+    void push(StGLTextureQueue& theQueue,
+              const double      thePts,
+              const bool        theIsRightRepeated);
+
+    /**
+     * Upload and swap the next frame.
+     * @param theIsRightSwapped set to true if right view textures have been swapped
+     * @return true if frame has been swapped
+     */
+    bool swap(StGLTextureQueue& theQueue,
+              bool&             theIsRightSwapped);
+
+        private:
+
+    StImage myImageL;
+    StImage myImageR;
+
+};
+
+#endif // __StTestTextureQueue_h_
@@ -19,12 +19,18 @@
 #include <StStrings/stConsole.h>
 #include <StThreads/StProcess.h>
 #include <StFile/StFolder.h>
+#include <StFile/StFileNode.h>
 
 #include "StTestMutex.h"
 #include "StTestGlBand.h"
 #include "StTestEmbed.h"
 #include "StTestImageLib.h"
 #include "StTestGlStress.h"
+#include "StTestMeshCache.h"
+#include "StTestMeshNormals.h"
+#include "StTestPalette.h"
+#include "StTestEvents.h"
+#include "StTestTextureQueue.h"
 
 int main(int , char** ) { // force console output
 #if defined(_WIN32)
@@ -54,6 +60,11 @@ int main(int , char** ) { // force console output
     const StString ST_TEST_GLHANG  = "glhang";
     const StString ST_TEST_EMBED   = "embed";
     const StString ST_TEST_IMAGE   = "image";
+    const StString ST_TEST_MESH    = "mesh";
+    const StString ST_TEST_PALETTE = "palette";
+    const StString ST_TEST_EVENTS  = "events";
+    const StString ST_TEST_TEXQUEUE = "texqueue";
+    const StString ST_TEST_MESHCACHE = "meshcache";
     const StString ST_TEST_ALL     = "all";
     size_t aFound = 0;
     for(size_t anArgId = 0; anArgId < anArgs.size(); ++anArgId) {
@@ -88,6 +99,37 @@ int main(int , char** ) { // force console output
             StTestImageLib anImage(anArgs[anArgId]);
             anImage.perform();
             ++aFound;
+        } else if(aParam == ST_TEST_MESH) {
+            // mesh normals computation performance tests, optionally with binary STL file
+            StString aMeshFile;
+            if(anArgId + 1 < anArgs.size()
+            && StFileNode::getExtension(anArgs[anArgId + 1]).isEqualsIgnoreCase(stCString("stl"))) {
+                aMeshFile = anArgs[++anArgId];
+            }
+
+            StTestMeshNormals aMesh(aMeshFile);
+            aMesh.perform();
+            ++aFound;
+        } else if(aParam == ST_TEST_PALETTE) {
+            // bitmap subtitles palette expansion performance test
+            StTestPalette aPalette;
+            aPalette.perform();
+            ++aFound;
+        } else if(aParam == ST_TEST_EVENTS) {
+            // events buffer flood from concurrent producer
+            StTestEvents anEvents;
+            anEvents.perform();
+            ++aFound;
+        } else if(aParam == ST_TEST_TEXQUEUE) {
+            // texture queue frames dropping with repeated right view
+            StTestTextureQueue aTexQueue;
+            aTexQueue.perform();
+            ++aFound;
+        } else if(aParam == ST_TEST_MESHCACHE) {
+            // mesh cache write/read round-trip
+            StTestMeshCache aMeshCache;
+            aMeshCache.perform();
+            ++aFound;
         } else if(aParam == ST_TEST_ALL) {
             // mutex speed test
             StTestMutex aMutices;
@@ -114,7 +156,12 @@ int main(int , char** ) { // force console output
                  << stostream_text("  glband - gl <-> cpu trasfer speed test\n")
                  << stostream_text("  glhang - gl stress test\n")
                  << stostream_text("  embed  - test window embedding\n")
-                 << stostream_text("  image fileName - test image libraries\n");
+                 << stostream_text("  image fileName - test image libraries\n")
+                 << stostream_text("  mesh [fileName.stl] - test mesh normals computation\n")
+                 << stostream_text("  palette - test bitmap subtitles palette expansion\n")
+                 << stostream_text("  events  - test events buffer under concurrent flood\n")
+                 << stostream_text("  texqueue - test texture queue drop with repeated right view\n")
+                 << stostream_text("  meshcache - test mesh cache round-trip\n");
     }
 
     st::cout << stostream_text("Press any key to exit...") << st::SYS_PAUSE_EMPTY;
@@ -1,5 +1,5 @@
 /**
- * Copyright © 2016 Kirill Gavrilov <kirill@sview.ru>
+ * Copyright © 2016-2017 Kirill Gavrilov <kirill@sview.ru>
  *
  * Distributed under the Boost Software License, Version 1.0.
  * See accompanying file license-boost.txt or copy at
@@ -10,14 +10,47 @@
 #define __StAVIOFileContext_h_
 
 #include <StAV/StAVIOContext.h>
+#include <StStrings/StString.h>
+#include <StThreads/StCondition.h>
+#include <StThreads/StMutexSlim.h>
+#include <StThreads/StThread.h>
 
 /**
  * Custom AVIO context for the file.
+ *
+ * When read-ahead is enabled (see setReadAhead()), the file is read by a background thread
+ * into the ring buffer, so that latency spikes of slow storage (network shares, USB drives)
+ * do not stall the demuxer. Read-ahead depth grows while access remains sequential
+ * and is reset on seeking outside of already buffered range;
+ * data fetched for the position before the seek is discarded.
+ * Write access is not supported while read-ahead thread is running.
  */
 class StAVIOFileContext : public StAVIOContext {
 
         public:
 
+    /**
+     * Read-ahead statistics.
+     */
+    struct Statistics {
+        int64_t BytesRead;   //!< number of bytes read from the file
+        double  ReadSec;     //!< time spent within file reading in seconds
+        size_t  NbStalls;    //!< number of times the demuxer waited for data
+        double  StallSec;    //!< total time the demuxer waited for data in seconds
+        size_t  NbDiscarded; //!< number of seeks discarding buffered data
+
+        Statistics() : BytesRead(0), ReadSec(0.0), NbStalls(0), StallSec(0.0), NbDiscarded(0) {}
+
+        /**
+         * @return read throughput in bytes per second
+         */
+        double getThroughput() const {
+            return ReadSec > 0.0 ? double(BytesRead) / ReadSec : 0.0;
+        }
+    };
+
+        public:
+
     /**
      * Empty constructor.
      */
@@ -33,12 +66,28 @@ class StAVIOFileContext : public StAVIOContext {
      */
     ST_CPPEXPORT void close();
 
+    /**
+     * Open the file for reading.
+     */
+    ST_CPPEXPORT bool open(const StString& thePath);
+
     /**
      * Associate a stream with a file that was previously opened for low-level I/O.
      * The associated file will be automatically closed on destruction.
      */
     ST_CPPEXPORT bool openFromDescriptor(int theFD, const char* theMode);
 
+    /**
+     * Setup the size of read-ahead ring buffer, 0 disables read-ahead (default).
+     * Should be called before opening the file.
+     */
+    ST_CPPEXPORT void setReadAhead(const size_t theNbBytes);
+
+    /**
+     * @return read-ahead statistics
+     */
+    ST_CPPEXPORT Statistics getStatistics() const;
+
     /**
      * Read from the file.
      */
@@ -57,9 +106,63 @@ class StAVIOFileContext : public StAVIOContext {
     ST_CPPEXPORT virtual int64_t seek(int64_t theOffset,
                                       int     theWhence) ST_ATTR_OVERRIDE;
 
+        private:
+
+    /**
+     * Read-ahead thread function.
+     */
+    static SV_THREAD_FUNCTION readThreadFunction(void* theCtx);
+
+    /**
+     * Read-ahead loop.
+     */
+    ST_LOCAL void readLoop();
+
+    /**
+     * Initialize state after opening the file.
+     */
+    ST_LOCAL void initFile();
+
+    /**
+     * Seek within the file on the reader side.
+     */
+    ST_LOCAL bool seekFile(int64_t theOffset,
+                           int     theWhence);
+
+    /**
+     * @return current position within the file on the reader side
+     */
+    ST_LOCAL int64_t tellFile();
+
+    /**
+     * Blocking seek with read-ahead.
+     */
+    ST_LOCAL int64_t seekAhead(int64_t theOffset,
+                               int     theWhence);
+
         protected:
 
-    FILE* myFile;
+    FILE*               myFile;
+
+        private:
+
+    StHandle<StThread>  myThread;       //!< read-ahead thread
+    mutable StMutexSlim myMutex;        //!< lock for read-ahead state
+    StCondition         myEventData;    //!< event signaling new data, EOF or error
+    StCondition         myEventSpace;   //!< event signaling free space, seek or quit
+    uint8_t*            myRing;         //!< read-ahead ring buffer
+    size_t              myRingSize;     //!< ring buffer size
+    size_t              myRingHead;     //!< index of first buffered byte within ring
+    size_t              myRingFill;     //!< number of buffered bytes
+    size_t              myAheadLimit;   //!< current read-ahead depth (grows for sequential access)
+    int64_t             myPosition;     //!< logical position within the file (demuxer side)
+    int64_t             myFilePos;      //!< actual position within the file (reader side)
+    int64_t             myFileSize;     //!< file size or -1 if unknown
+    unsigned int        myGeneration;   //!< counter incremented on each seek discarding the buffer
+    Statistics          myStats;        //!< read-ahead statistics
+    volatile bool       myIsEof;        //!< reader has reached end of file
+    volatile bool       myIsError;      //!< reader has failed
+    volatile bool       myToQuit;       //!< flag to stop reader thread
 
 };
 
@@ -59,8 +59,18 @@ class StAVPacket {
         return &myPacket;
     }
 
+    /**
+     * Copy packet. Reference-counted payload is shared (only reference is added), otherwise data is copied.
+     */
     ST_CPPEXPORT void setAVpkt(const AVPacket& theCopy);
 
+    /**
+     * Move packet content from another packet without copying the payload
+     * (data not owned by reference-counted buffer is copied).
+     * Source packet becomes empty but preserves stereo parameters.
+     */
+    ST_CPPEXPORT void moveFrom(StAVPacket& theSource);
+
     inline const StHandle<StStereoParams>& getSource() const {
         return myStParams;
     }
@@ -207,6 +207,8 @@ namespace stAV {
      *  - MPEG,  9 bits in 16 bits:   32..470   for Y,   32..480   for U and V
      *  - full, 10 bits in 16 bits:    0..1023
      *  - MPEG, 10 bits in 16 bits:   64..940   for Y,   64..960   for U and V
+     *  - full, 12 bits in 16 bits:    0..4095
+     *  - MPEG, 12 bits in 16 bits:  256..3760  for Y,  256..3840  for U and V
      *  - full, 16 bits:               0..65535
      *  - MPEG, 16 bits:            4096..60160 for Y, 4096..61440 for U and V
      */
@@ -224,6 +226,11 @@ namespace stAV {
         ST_SHARED_CPPEXPORT AVPixelFormat YUV411P;   //!< planar YUV 4:1:1, 12bpp, (1 Cr & Cb sample per 4x1 Y samples)
         ST_SHARED_CPPEXPORT AVPixelFormat YUV440P;   //!< planar YUV 4:4:0 (1 Cr & Cb sample per 1x2 Y samples)
         ST_SHARED_CPPEXPORT AVPixelFormat NV12;      //!< YUV420, Y plane + interleaved UV plane oh half width and height
+        ST_SHARED_CPPEXPORT AVPixelFormat P010;      //!< same as NV12 but with 10 bits stored in high bits of 16 bits
+        ST_SHARED_CPPEXPORT AVPixelFormat P016;      //!< same as NV12 but with 16 bits per component
+        // packed YUV formats
+        ST_SHARED_CPPEXPORT AVPixelFormat YUYV422;   //!< packed YUV 4:2:2, 16bpp, Y0 Cb Y1 Cr
+        ST_SHARED_CPPEXPORT AVPixelFormat UYVY422;   //!< packed YUV 4:2:2, 16bpp, Cb Y0 Cr Y1
         // wide planar YUV formats (9,10,14,16 bits stored in 16 bits)
         ST_SHARED_CPPEXPORT AVPixelFormat YUV420P9;
         ST_SHARED_CPPEXPORT AVPixelFormat YUV422P9;
@@ -231,10 +238,22 @@ namespace stAV {
         ST_SHARED_CPPEXPORT AVPixelFormat YUV420P10;
         ST_SHARED_CPPEXPORT AVPixelFormat YUV422P10;
         ST_SHARED_CPPEXPORT AVPixelFormat YUV444P10;
+        ST_SHARED_CPPEXPORT AVPixelFormat YUV420P12;
+        ST_SHARED_CPPEXPORT AVPixelFormat YUV422P12;
+        ST_SHARED_CPPEXPORT AVPixelFormat YUV444P12;
         ST_SHARED_CPPEXPORT AVPixelFormat YUV420P16;
         ST_SHARED_CPPEXPORT AVPixelFormat YUV422P16;
         ST_SHARED_CPPEXPORT AVPixelFormat YUV444P16;
-        //extern const AVPixelFormat YUVA420P; ///< planar YUV 4:2:0, 20bpp, (1 Cr & Cb sample per 2x2 Y & A samples)
+        // planar YUV formats with alpha plane
+        ST_SHARED_CPPEXPORT AVPixelFormat YUVA420P;  //!< planar YUV 4:2:0, 20bpp, (1 Cr & Cb sample per 2x2 Y & A samples)
+        ST_SHARED_CPPEXPORT AVPixelFormat YUVA422P;
+        ST_SHARED_CPPEXPORT AVPixelFormat YUVA444P;
+        ST_SHARED_CPPEXPORT AVPixelFormat YUVA420P10;
+        ST_SHARED_CPPEXPORT AVPixelFormat YUVA422P10;
+        ST_SHARED_CPPEXPORT AVPixelFormat YUVA444P10;
+        ST_SHARED_CPPEXPORT AVPixelFormat YUVA420P16;
+        ST_SHARED_CPPEXPORT AVPixelFormat YUVA422P16;
+        ST_SHARED_CPPEXPORT AVPixelFormat YUVA444P16;
         // fullscale YUV formats (deprecated?)
         ST_SHARED_CPPEXPORT AVPixelFormat YUVJ420P;  //!< planar YUV 4:2:0, 12bpp, full scale (JPEG)
         ST_SHARED_CPPEXPORT AVPixelFormat YUVJ422P;  //!< planar YUV 4:2:2, 16bpp, full scale (JPEG)
@@ -249,6 +268,14 @@ namespace stAV {
         ST_SHARED_CPPEXPORT AVPixelFormat BGRA32;
         ST_SHARED_CPPEXPORT AVPixelFormat RGBA64;
         ST_SHARED_CPPEXPORT AVPixelFormat BGRA64;
+        // planar RGB formats (G, B, R planes order)
+        ST_SHARED_CPPEXPORT AVPixelFormat GBRP;
+        ST_SHARED_CPPEXPORT AVPixelFormat GBRP9;
+        ST_SHARED_CPPEXPORT AVPixelFormat GBRP10;
+        ST_SHARED_CPPEXPORT AVPixelFormat GBRP12;
+        ST_SHARED_CPPEXPORT AVPixelFormat GBRP16;
+        ST_SHARED_CPPEXPORT AVPixelFormat GBRAP;
+        ST_SHARED_CPPEXPORT AVPixelFormat GBRAP16;
         // XYZ formats
         ST_SHARED_CPPEXPORT AVPixelFormat XYZ12;
         // HWAccel formats
@@ -269,6 +296,7 @@ namespace stAV {
         int  heightV;
         int  bitsPerComp;
         bool isFullScale;
+        bool hasAlpha;    //!< alpha plane of luma dimensions follows U and V planes
     };
 
     /**
@@ -286,6 +314,17 @@ namespace stAV {
                                         const int           theHeight,
                                         dimYUV&             theDims);
 
+    /**
+     * Auxiliary function to check that frame is in one of the planar RGB pixel formats.
+     * @param thePixFmt      pixel format to check
+     * @param theBitsPerComp number of significant bits per component stored in 8 or 16 bits
+     * @param theHasAlpha    flag indicating alpha plane presence
+     * @return true if AVPixelFormat is planar GBR
+     */
+    ST_CPPEXPORT bool isFormatGBRPlanar(const AVPixelFormat thePixFmt,
+                                        int&                theBitsPerComp,
+                                        bool&               theHasAlpha);
+
     /**
      * @return true if AVPixelFormat is planar YUV
      */
@@ -242,6 +242,12 @@ class StAndroidGlue {
                                  bool&                 theToSwapEyes,
                                  const StKeysState&    theKeys);
 
+    /**
+     * Fetch only the most recent device orientation.
+     * Cheaper than fetchState() and intended for late-latching right before presenting the frame.
+     */
+    ST_CPPEXPORT void fetchOrientation(StQuaternion<double>& theQuaternion);
+
     /**
      * Return device memory class.
      */
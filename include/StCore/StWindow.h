@@ -477,6 +477,26 @@ class StWindow {
      */
     ST_CPPEXPORT virtual StQuaternion<double> getDeviceOrientation() const;
 
+    /**
+     * Re-sample device orientation from the sensor bypassing the value cached by processEvents().
+     * Intended to be called by output right before presenting the frame (late-latching),
+     * so that the difference to the orientation used for rendering can be compensated.
+     */
+    ST_CPPEXPORT StQuaternion<double> latchDeviceOrientation();
+
+    /**
+     * Return tangent of vertical half field of view of the head-tracked scene rendered by application,
+     * or 0 if the frame should not be reprojected by late-latched orientation.
+     */
+    ST_CPPEXPORT float getReprojectionFov() const;
+
+    /**
+     * Setup tangent of vertical half field of view of the head-tracked scene for the next frame.
+     * Application should reset it to 0 while head-locked GUI is drawn on top of the scene,
+     * so that output will not rotate GUI together with the scene.
+     */
+    ST_CPPEXPORT void setReprojectionFov(const float theTanHalfFovY);
+
     /**
      * Return TRUE if Left/Right eyes should be swapped by external event.
      */
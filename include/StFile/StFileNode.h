@@ -210,6 +210,24 @@ class StFileNode : public StNode {
      */
     ST_CPPEXPORT static bool isFileReadOnly(const StCString& thePath);
 
+    /**
+     * Retrieve file size and modification time without opening the file.
+     * @param thePath      file path
+     * @param theSize      file size in bytes
+     * @param theModifTime modification time in seconds since epoch
+     * @return true if file exists
+     */
+    ST_CPPEXPORT static bool getFileStat(const StCString& thePath,
+                                         int64_t&         theSize,
+                                         int64_t&         theModifTime);
+
+    /**
+     * Set file modification time to the current time.
+     * @param thePath file path
+     * @return true on success
+     */
+    ST_CPPEXPORT static bool touchFile(const StCString& thePath);
+
     /**
      * @param thePath file path
      * @return true if file attributes have been successfully modified
@@ -0,0 +1,177 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file license-boost.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+
+#ifndef __StMediaInfoIndex_h_
+#define __StMediaInfoIndex_h_
+
+#include <StGLStereo/StFormatEnum.h>
+#include <StThreads/StMutex.h>
+
+#include <map>
+
+/**
+ * Persistent index of basic media file properties.
+ * Entries are keyed by file path and validated by file size and modification time,
+ * so that metadata of already seen files is available without opening them.
+ * Missing entries are filled by reading only file headers:
+ * JPEG/MPO/JPS files are parsed up to the first image data,
+ * while other files are probed by FFmpeg within a limited amount of data.
+ * When the index is full, the least recently accessed entry is dropped.
+ */
+class StMediaInfoIndex {
+
+        public:
+
+    /**
+     * Stream kinds flags.
+     */
+    enum StreamKind {
+        StreamKind_Video     = 0x01, //!< video or image stream
+        StreamKind_Audio     = 0x02, //!< audio stream
+        StreamKind_Subtitles = 0x04, //!< subtitles stream
+    };
+
+    /**
+     * Media file properties.
+     */
+    struct Entry {
+        int64_t  FileSize;     //!< file size in bytes
+        int64_t  ModifTime;    //!< file modification time
+        int      SizeX;        //!< image width  in pixels (of the first view)
+        int      SizeY;        //!< image height in pixels (of the first view)
+        int      NbImages;     //!< number of images stored in file (e.g. 2 for stereo MPO)
+        int      Rotation;     //!< rotation angle in degrees from EXIF orientation
+        StFormat StereoFormat; //!< stereo format stored in file metadata
+        double   Duration;     //!< duration in seconds, 0 for still images
+        double   Parallax;     //!< horizontal parallax in percents
+        int      StreamKinds;  //!< combination of StreamKind flags
+
+        Entry()
+        : FileSize(0), ModifTime(0), SizeX(0), SizeY(0), NbImages(0), Rotation(0),
+          StereoFormat(StFormat_AUTO), Duration(0.0), Parallax(0.0), StreamKinds(0) {}
+    };
+
+        public:
+
+    /**
+     * Main constructor.
+     * @param theFilePath path to the index file
+     * @param theNbMax    maximum number of entries to keep
+     */
+    ST_CPPEXPORT StMediaInfoIndex(const StString& theFilePath,
+                                  const size_t    theNbMax = 16384);
+
+    /**
+     * Destructor.
+     */
+    ST_CPPEXPORT ~StMediaInfoIndex();
+
+    /**
+     * @return path to the index file
+     */
+    ST_LOCAL const StString& getFilePath() const {
+        return myFilePath;
+    }
+
+    /**
+     * Read the index file.
+     */
+    ST_CPPEXPORT bool load();
+
+    /**
+     * Write the index file if it has been modified.
+     */
+    ST_CPPEXPORT bool save();
+
+    /**
+     * Find up-to-date entry for specified file.
+     * The entry is marked as recently used.
+     * @param thePath  file path
+     * @param theEntry found entry
+     * @return false if file is not indexed or has been modified since
+     */
+    ST_CPPEXPORT bool find(const StString& thePath,
+                           Entry&          theEntry) const;
+
+    /**
+     * Add or replace the entry for specified file.
+     * File size and modification time are retrieved from file system.
+     * @param thePath  file path
+     * @param theEntry file properties
+     */
+    ST_CPPEXPORT void update(const StString& thePath,
+                             const Entry&    theEntry);
+
+    /**
+     * Retrieve the entry from index or scan file headers when possible.
+     * @param thePath  file path
+     * @param theEntry file properties
+     * @return true if properties are available
+     */
+    ST_CPPEXPORT bool scan(const StString& thePath,
+                           Entry&          theEntry);
+
+    /**
+     * Read properties from the headers of JPEG/MPO/JPS file.
+     * @param thePath  file path
+     * @param theEntry file properties
+     * @return true if headers have been parsed
+     */
+    ST_CPPEXPORT static bool scanJpeg(const StString& thePath,
+                                      Entry&          theEntry);
+
+    /**
+     * Read properties of media container using FFmpeg.
+     * Probing is limited to the beginning of the file, so that duration might be unavailable for some formats.
+     * @param thePath  file path (remote and content paths are not supported)
+     * @param theEntry file properties
+     * @return true if container has been recognized
+     */
+    ST_CPPEXPORT static bool scanContainer(const StString& thePath,
+                                           Entry&          theEntry);
+
+        private:
+
+    /**
+     * Indexed entry with access stamp.
+     */
+    struct IndexedEntry {
+        Entry    Info;  //!< file properties
+        uint64_t Stamp; //!< last access stamp
+
+        IndexedEntry() : Stamp(0) {}
+    };
+
+    typedef std::map<StString, IndexedEntry> MapOfEntries;
+    typedef std::map<uint64_t, StString>     MapOfStamps;
+
+        private:
+
+    /**
+     * Mark the entry as recently used.
+     */
+    ST_LOCAL void touch(MapOfEntries::iterator theIter) const;
+
+        private:
+
+    mutable StMutex      myMutex;     //!< lock for thread-safe access
+    mutable MapOfEntries myEntries;   //!< map path -> properties
+    mutable MapOfStamps  myStamps;    //!< map access stamp -> path, for dropping least recently used entries
+    mutable uint64_t     myLastStamp; //!< last assigned access stamp
+    StString             myFilePath;  //!< path to the index file
+    size_t               myNbMax;     //!< maximum number of entries
+    mutable bool         myIsChanged; //!< index has not been saved
+
+        private: //! @name no copies
+
+    StMediaInfoIndex(const StMediaInfoIndex& );
+    StMediaInfoIndex& operator=(const StMediaInfoIndex& );
+
+};
+
+#endif // __StMediaInfoIndex_h_
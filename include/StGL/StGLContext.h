@@ -164,6 +164,8 @@ class StGLContext {
     bool            hasHighp;   //!< highp in GLSL ES fragment shader is supported
     bool            hasTexRGBA8;//!< always available on desktop; on OpenGL ES - since 3.0 or as extension GL_OES_rgb8_rgba8
     bool            extTexBGRA8;//!< GL_EXT_texture_format_BGRA8888 for OpenGL ES
+    bool            hasTexHalfFloat; //!< half-float textures can be uploaded - OpenGL 3.0+, OpenGL ES 3.0+ or GL_ARB_half_float_pixel + GL_ARB_texture_float
+    bool            hasTexRGB10A2;   //!< GL_RGB10_A2 textures can be uploaded - OpenGL ES 3.0+ or any desktop
     StGLFunctions*  extAll;     //!< access to ALL extensions for advanced users
     bool            extSwapTear;//!< WGL_EXT_swap_control_tear/GLX_EXT_swap_control_tear
 
@@ -247,6 +249,8 @@ class StGLContext {
         StGLDeviceCaps aCaps;
         aCaps.maxTexDim = myMaxTexDim;
         aCaps.hasUnpack = hasUnpack;
+        aCaps.hasHalfFloat = hasTexHalfFloat;
+        aCaps.hasRGB10A2   = hasTexRGB10A2;
         return aCaps;
     }
 
@@ -26,10 +26,20 @@ struct StGLDeviceCaps {
      */
     bool hasUnpack;
 
+    /**
+     * Device supports half-float textures.
+     */
+    bool hasHalfFloat;
+
+    /**
+     * Device supports GL_RGB10_A2 textures.
+     */
+    bool hasRGB10A2;
+
     /**
      * Empty constructor.
      */
-    ST_LOCAL StGLDeviceCaps() : maxTexDim(0), hasUnpack(true) {}
+    ST_LOCAL StGLDeviceCaps() : maxTexDim(0), hasUnpack(true), hasHalfFloat(false), hasRGB10A2(false) {}
 };
 
 #endif // __StGLDeviceCaps_h_
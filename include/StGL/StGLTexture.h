@@ -192,6 +192,22 @@ class StGLTexture : public StGLResource {
                                 const GLsizei       theRowTo,
                                 const GLsizei       theBatchRows = 128);
 
+    /**
+     * Fill the rectangle within the texture with the image plane.
+     * The plane might be a wrapper over sub-region of another plane (with larger row stride).
+     * @param theCtx     current context
+     * @param theData    the image plane to copy data from
+     * @param theTarget  texture target
+     * @param theOffsetX texel offset in the texture
+     * @param theOffsetY texel offset in the texture
+     * @return true on success
+     */
+    ST_CPPEXPORT bool fillSubImage(StGLContext&        theCtx,
+                                   const StImagePlane& theData,
+                                   const GLenum        theTarget,
+                                   const GLsizei       theOffsetX,
+                                   const GLsizei       theOffsetY);
+
     /**
      * @return GL texture ID.
      */
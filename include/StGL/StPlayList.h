@@ -10,6 +10,7 @@
 #define __StPlayList_h__
 
 #include <StFile/StFolder.h>
+#include <StFile/StMediaInfoIndex.h>
 #include <StGL/StParams.h>
 
 #include <StGLStereo/StGLTextureQueue.h>
@@ -142,6 +143,11 @@ class StPlayList {
      */
     ST_CPPEXPORT void setExtensions(const StArrayList<StString>& theExtensions);
 
+    /**
+     * Set persistent index of media properties to be used for listing.
+     */
+    ST_CPPEXPORT void setInfoIndex(const StHandle<StMediaInfoIndex>& theIndex);
+
     /**
      * Clear playlist.
      */
@@ -314,14 +320,16 @@ class StPlayList {
                            const StCString& theItem = stCString(""));
 
     /**
-     * Fill list with playlist items (only titles).
-     * @param theList  the list to fill
-     * @param theStart start index (inclusive) in playlist
-     * @param theEnd   end   index (exclusive) in playlist
+     * Fill list with playlist items titles.
+     * @param theList       the list to fill
+     * @param theStart      start index (inclusive) in playlist
+     * @param theEnd        end   index (exclusive) in playlist
+     * @param theToAddInfo  append dimensions and duration of already indexed files to titles
      */
     ST_CPPEXPORT void getSubList(StArrayList<StString>& theList,
                                  const size_t           theStart,
-                                 const size_t           theEnd) const;
+                                 const size_t           theEnd,
+                                 const bool             theToAddInfo = false) const;
 
         public: //! @name recently opened files list
 
@@ -454,6 +462,7 @@ class StPlayList {
     std::deque<StPlayItem*> myStackNext;     //!< stack of next     items (for shuffle playback)
     size_t                  myItemsCount;    //!< current playlist size
     StArrayList<StString>   myExtensions;    //!< extensions list
+    StHandle<StMediaInfoIndex> myInfoIndex;  //!< persistent index of media properties (optional)
     StStereoParams          myDefStParams;   //!< default stereo parameters
     StMinGen                myRandGen;       //!< random number generator for shuffle playback
     size_t                  myPlayedCount;   //!< played items in current iteration (< myItemsCount)
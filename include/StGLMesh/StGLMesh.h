@@ -12,6 +12,7 @@
 #include <StGL/StGLMatrix.h>
 #include <StGL/StGLProgram.h>
 #include <StGL/StGLVertexBuffer.h>
+#include <StThreads/StThreadPool.h>
 
 #include "StBndSphere.h"
 
@@ -220,9 +221,34 @@ class StGLMesh : public StGLResource {
      * you will see lighting glitches on joints due to simple computation algorithm.
      * @param theDelta delta between triangles start node,
      *        should be 3 for GL_TRIANGLES and 1 for GL_TRIANGLES_STRIP
+     * @param thePool  optional thread pool to process large meshes in parallel
      * @return true id something was computed
      */
-    ST_CPPEXPORT bool computeNormals(size_t theDelta = 3);
+    ST_CPPEXPORT bool computeNormals(size_t theDelta = 3,
+                                     const StHandle<StThreadPool>& thePool = StHandle<StThreadPool>());
+
+    /**
+     * Compute normals for each vertex within specified arrays.
+     * Vertices are split into ranges processed by pool threads,
+     * triangles are distributed among ranges in advance so that each thread reads only triangles
+     * sharing vertices of its own range and accumulates normals only within this range.
+     * Thus result does not depend on number of threads and is equal to computation within single thread.
+     * @param theNormals    output array of theNbVertices normals
+     * @param theVertices   array of vertices
+     * @param theNbVertices number of vertices
+     * @param theIndices    array of indices, or NULL for non-indexed triangles
+     * @param theNbIndices  number of indices
+     * @param theDelta      delta between triangles start node
+     * @param thePool       optional thread pool
+     * @return true id something was computed
+     */
+    ST_CPPEXPORT static bool computeNormals(StGLVec3*       theNormals,
+                                            const StGLVec3* theVertices,
+                                            const size_t    theNbVertices,
+                                            const GLuint*   theIndices,
+                                            const size_t    theNbIndices,
+                                            const size_t    theDelta,
+                                            StThreadPool*   thePool);
 
         protected:
 
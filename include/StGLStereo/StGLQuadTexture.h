@@ -207,21 +207,26 @@ class StGLQuadTexture : public StGLResource {
      * @return texture (StGLFrameTextures& ) - texture from front pair (for rendering).
      */
     inline StGLFrameTextures& getFront(const LeftOrRight theLeftOrRight) {
-        return myTextures[getFrontId() + theLeftOrRight];
+        return myTextures[getFrontId(theLeftOrRight) + theLeftOrRight];
     }
 
     /**
      * @return texture (StGLFrameTextures& ) - texture from back pair (for filling).
      */
     inline StGLFrameTextures& getBack(const LeftOrRight theLeftOrRight) {
-        return myTextures[getBackId() + theLeftOrRight];
+        return myTextures[getBackId(theLeftOrRight) + theLeftOrRight];
     }
 
     /**
      * Swap FRONT / BACK.
+     * @param theToSwapRight when FALSE, the right view keeps its front texture
+     *                       (frame repeats previous right view which has not been uploaded again)
      */
-    inline void swapFB() {
-        myActive = !myActive; // process swap itself
+    inline void swapFB(const bool theToSwapRight = true) {
+        myActive[LEFT_TEXTURE] = !myActive[LEFT_TEXTURE]; // process swap itself
+        if(theToSwapRight) {
+            myActive[RIGHT_TEXTURE] = !myActive[RIGHT_TEXTURE];
+        }
     }
 
     /**
@@ -233,18 +238,18 @@ class StGLQuadTexture : public StGLResource {
 
         private:
 
-    inline size_t getFrontId() const {
-        return myActive ? FRONT_TEXTURE : BACK_TEXTURE;
+    inline size_t getFrontId(const LeftOrRight theLeftOrRight) const {
+        return myActive[theLeftOrRight] ? FRONT_TEXTURE : BACK_TEXTURE;
     }
 
-    inline size_t getBackId() const {
-        return myActive ? BACK_TEXTURE : FRONT_TEXTURE;
+    inline size_t getBackId(const LeftOrRight theLeftOrRight) const {
+        return myActive[theLeftOrRight] ? BACK_TEXTURE : FRONT_TEXTURE;
     }
 
         private:
 
     StGLFrameTextures myTextures[4]; //!< Front and Back stereo textures
-    bool              myActive;      //!< Front/Back flag
+    bool              myActive[2];   //!< Front/Back flags for left and right views
 
 };
 
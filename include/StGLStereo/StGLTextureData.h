@@ -11,8 +11,11 @@
 
 #include <StImage/StImage.h>
 #include <StGLStereo/StGLQuadTexture.h>
+#include <StGLStereo/StGLVisibleTiles.h>
 #include <StGL/StGLDeviceCaps.h>
 
+class StThreadPool;
+
 /**
  * This class represents stereo data for textures
  * in separate buffers.
@@ -129,6 +132,9 @@ class StGLTextureData {
      * @param theFormat   stereo layout in data
      * @param theCubemap  cubemap format
      * @param thePts      presentation timestamp
+     * @param theThreadPool optional thread pool to split large frames in parallel
+     * @param theToCompact  store float and 16-bit RGB images in compact texture formats (half-float, packed 10-bit)
+     * @param theIsRightRepeated right view repeats the one of previous frame and should not be uploaded again
      */
     ST_CPPEXPORT void updateData(const StGLDeviceCaps&           theDevCaps,
                                  const StImage&                  theDataL,
@@ -136,16 +142,48 @@ class StGLTextureData {
                                  const StHandle<StStereoParams>& theStParams,
                                  const StFormat                  theFormat,
                                  const StCubemap                 theCubemap,
-                                 const double                    thePts);
+                                 const double                    thePts,
+                                 const StHandle<StThreadPool>&   theThreadPool,
+                                 const bool                      theToCompact = false,
+                                 const bool                      theIsRightRepeated = false);
+
+    /**
+     * @return true if right view repeats the one of previous frame (already uploaded into texture)
+     */
+    ST_LOCAL bool isRightRepeated() const {
+        return myIsRightRepeated;
+    }
+
+    /**
+     * Force uploading of the right view, e.g. when the frame carrying it has been dropped from the queue.
+     */
+    ST_LOCAL void resetRightRepeated() {
+        myIsRightRepeated = false;
+    }
 
     /**
      * Perform texture update with current data.
      * @param theCtx      OpenGL context
      * @param theQTexture texture to fill in
+     * @param theTiles    regions of the frame to upload, other regions keep previous content
      * @return true if texture update (all iterations) finished
      */
-    ST_CPPEXPORT bool fillTexture(StGLContext&     theCtx,
-                                  StGLQuadTexture& theQTexture);
+    ST_CPPEXPORT bool fillTexture(StGLContext&            theCtx,
+                                  StGLQuadTexture&        theQTexture,
+                                  const StGLVisibleTiles& theTiles = StGLVisibleTiles());
+
+    /**
+     * Upload specified regions of already displayed data into front textures at once.
+     * Should be called only for the data previously uploaded by fillTexture() and swapped to front.
+     * @param theCtx      OpenGL context
+     * @param theQTexture texture to fill in
+     * @param theTilesL   regions of the left  view to upload
+     * @param theTilesR   regions of the right view to upload
+     */
+    ST_CPPEXPORT void fillTiles(StGLContext&            theCtx,
+                                StGLQuadTexture&        theQTexture,
+                                const StGLVisibleTiles& theTilesL,
+                                const StGLVisibleTiles& theTilesR);
 
     ST_CPPEXPORT void getCopy(StImage* outDataL, StImage* outDataR) const;
 
@@ -168,10 +206,19 @@ class StGLTextureData {
 
     /**
      * Fill the texture plane.
-     */
-    ST_LOCAL void fillTexture(StGLContext&        theCtx,
-                              StGLFrameTexture&   theFrameTexture,
-                              const StImagePlane& theData);
+     * @param theCtx          OpenGL context
+     * @param theFrameTexture texture to fill in
+     * @param theData         image plane
+     * @param theTiles        regions of the plane to upload
+     * @param theRowFrom      first row to upload (within the texture)
+     * @param theRowTo        last row to upload (exclusive)
+     */
+    ST_LOCAL void fillTexture(StGLContext&            theCtx,
+                              StGLFrameTexture&       theFrameTexture,
+                              const StImagePlane&     theData,
+                              const StGLVisibleTiles& theTiles,
+                              const GLsizei           theRowFrom,
+                              const GLsizei           theRowTo);
 
     ST_LOCAL void setupAttributes(StGLFrameTextures& stFrameTextures, const StImage& theImage);
 
@@ -193,6 +240,7 @@ class StGLTextureData {
 
     GLsizei                  myFillFromRow;
     GLsizei                  myFillRows;
+    bool                     myIsRightRepeated; //!< right view is not uploaded, previous one is kept
 
 };
 
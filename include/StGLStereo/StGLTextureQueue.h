@@ -11,9 +11,12 @@
 
 #include <StThreads/StCondition.h>
 #include <StThreads/StFPSMeter.h>
+#include <StThreads/StFrameStatistics.h>
 #include <StThreads/StMutex.h>
+#include <StThreads/StThreadPool.h>
 
 #include <StGL/StGLDeviceCaps.h>
+#include <StImage/StImagePyramid.h>
 
 #include "StGLQuadTexture.h"
 #include "StGLTextureData.h"
@@ -80,6 +83,7 @@ class StGLTextureQueue {
      * @param theSrcFormat    source data format
      * @param theSrcCubemap   format of cubemap
      * @param theSrcPTS       PTS (presentation timestamp)
+     * @param theIsRightRepeated right view is the same as in previous frame - keep it instead of uploading again
      * @return true on success
      */
     ST_CPPEXPORT bool push(const StImage&     theSrcDataLeft,
@@ -87,7 +91,8 @@ class StGLTextureQueue {
                            const StHandle<StStereoParams>& theStParams,
                            const StFormat     theSrcFormat,
                            const StCubemap    theSrcCubemap,
-                           const double       theSrcPTS);
+                           const double       theSrcPTS,
+                           const bool         theIsRightRepeated = false);
 
     /**
      * Retrieve queue statistics.
@@ -112,6 +117,13 @@ class StGLTextureQueue {
         }
     }
 
+    /**
+     * Access playback statistics (upload time and dropped frames are collected by the queue itself).
+     */
+    ST_LOCAL StFrameStatistics& changeStatistics() {
+        return myStatistics;
+    }
+
     /**
      * Function called in loop from general GL draw loop
      * and do update quad texture data / state (display frame).
@@ -200,6 +212,24 @@ class StGLTextureQueue {
      */
     ST_CPPEXPORT void setCompressMemory(const bool theToCompress);
 
+    /**
+     * Store float and 16-bit RGB images in compact texture formats (half-float, packed 10-bit)
+     * when supported by device, to reduce memory footprint and upload bandwidth.
+     * Takes effect on next pushed frame.
+     */
+    ST_CPPEXPORT void setCompactStorage(const bool theToCompact);
+
+    /**
+     * Setup regions of the frame currently visible on the screen (e.g. within panorama),
+     * so that only these regions are uploaded into textures.
+     * Other regions are uploaded later, when they become visible.
+     * This function called ONLY from GL thread.
+     * @param theTiles visible regions, all tiles to upload the whole frame
+     */
+    ST_LOCAL void setVisibleTiles(const StGLVisibleTiles& theTiles) {
+        myVisibleTiles = theTiles;
+    }
+
     /**
      * Function process TOTAL queue clean up.
      */
@@ -208,6 +238,7 @@ class StGLTextureQueue {
     /**
      * This function clean up only requested number of frames but prevents queue emptying.
      * At least one frame will remain in queue.
+     * When any of dropped frames carries new right view, it is uploaded with the next remaining frame.
      */
     ST_CPPEXPORT void drop(const size_t theCount);
 
@@ -223,6 +254,33 @@ class StGLTextureQueue {
         return aSrcFrmt;
     }
 
+    /**
+     * Setup tiled pyramid of the full-resolution image,
+     * used when the image was downscaled to fit texture size limits.
+     * @param thePyramid  image pyramid or NULL to reset
+     * @param theStParams stereo parameters of the image
+     */
+    ST_LOCAL void setPyramid(const StHandle<StImagePyramid>& thePyramid,
+                             const StHandle<StStereoParams>& theStParams) {
+        myMutexPyramid.lock();
+            myPyramid       = thePyramid;
+            myPyramidParams = theStParams;
+        myMutexPyramid.unlock();
+    }
+
+    /**
+     * Return tiled pyramid of the full-resolution image.
+     * @param theStParams stereo parameters of the image
+     * @return image pyramid or NULL
+     */
+    ST_LOCAL StHandle<StImagePyramid> getPyramid(StHandle<StStereoParams>& theStParams) const {
+        myMutexPyramid.lock();
+            StHandle<StImagePyramid> aPyramid = myPyramid;
+            theStParams = myPyramidParams;
+        myMutexPyramid.unlock();
+        return aPyramid;
+    }
+
     enum {
         SNAPSHOT_NO_NEW = 0,
         SNAPSHOT_SUCCESS = 1,
@@ -244,6 +302,12 @@ class StGLTextureQueue {
 
     ST_CPPEXPORT int swapFBOnReady(StGLContext& theCtx);
 
+    /**
+     * Upload regions of displayed frame which became visible since frame upload.
+     * Should be called with locked myMutexPop.
+     */
+    ST_LOCAL void stglUpdateVisibleTiles(StGLContext& theCtx);
+
         private:
 
     StMutex          myMutexPop;
@@ -263,19 +327,35 @@ class StGLTextureQueue {
 
     StMutex          myMeterMutex;
     StFPSMeter       myFPSMeter;
+    StFrameStatistics myStatistics;    //!< playback statistics
 
     StMutex          myMutexSrcFormat;
     int              myCurrSrcFormat;  //!< current source format
 
     double           myCurrPts;
+    double           myUploadTimeMs;   //!< time spent on uploading current frame
+
+    mutable StMutex          myMutexPyramid;
+    StHandle<StImagePyramid> myPyramid;       //!< tiled pyramid of the full-resolution image
+    StHandle<StStereoParams> myPyramidParams; //!< stereo parameters of the image within pyramid
+
+    StGLVisibleTiles myVisibleTiles;   //!< regions of the frame visible on the screen
+    StGLVisibleTiles myPrevTiles;      //!< visible regions requested for the previously uploaded frame
+    StGLVisibleTiles myBackTiles[2];   //!< regions uploaded into back  textures, per view
+    StGLVisibleTiles myFrontTiles[2];  //!< regions uploaded into front textures, per view
 
     StCondition      myNewShotEvent;
     bool             myIsInUpdTexture; //!< private bools for plugin thread
     bool             myIsReadyToSwap;
+    bool             myToSwapRight;    //!< swap right view textures (FALSE when uploaded frame repeats the right view)
+    bool             myToUploadRight;  //!< ignore repeated flag of the next pushed frame (queue has been cleared)
     bool             myToCompress;     //!< release unused memory as fast as possible
+    volatile bool    myToCompact;      //!< store float and 16-bit RGB images in compact texture formats
     volatile bool    myHasStream;      //!< flag indicates that some stream connected to this queue
 
     StGLDeviceCaps   myDeviceCaps;     //!< device capabilities
+    StHandle<StThreadPool>
+                     myThreadPool;     //!< workers splitting stereo layouts of large frames
 
 };
 
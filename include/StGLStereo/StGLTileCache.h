@@ -0,0 +1,126 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file license-boost.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+
+#ifndef __StGLTileCache_h_
+#define __StGLTileCache_h_
+
+#include <StGL/StGLTexture.h>
+#include <StGL/StGLVec.h>
+#include <StImage/StImagePyramid.h>
+
+#include <vector>
+
+/**
+ * GPU cache of image pyramid tiles.
+ * Holds fixed number of textures, the least recently used tile is evicted
+ * when new one should be uploaded.
+ * Number of uploads per frame is limited to keep frame rate smooth,
+ * tiles which did not fit into the budget are uploaded within next frames.
+ */
+class StGLTileCache : public StGLResource {
+
+        public:
+
+    /**
+     * Main constructor.
+     * @param theNbTilesMax   maximum number of textures in cache
+     * @param theNbUploadsMax maximum number of tiles uploaded within one frame
+     */
+    ST_CPPEXPORT StGLTileCache(const size_t theNbTilesMax   = 64,
+                               const size_t theNbUploadsMax = 4);
+
+    /**
+     * Destructor - should be called after release()!
+     */
+    ST_CPPEXPORT virtual ~StGLTileCache();
+
+    /**
+     * Release GL resources.
+     */
+    ST_CPPEXPORT virtual void release(StGLContext& theCtx) ST_ATTR_OVERRIDE;
+
+    /**
+     * @return current image pyramid
+     */
+    ST_LOCAL const StHandle<StImagePyramid>& getPyramid() const {
+        return myPyramid;
+    }
+
+    /**
+     * Setup image pyramid. Cached tiles are invalidated when pyramid is changed,
+     * but textures are kept for reuse.
+     */
+    ST_CPPEXPORT void setPyramid(const StHandle<StImagePyramid>& thePyramid);
+
+    /**
+     * Should be called at the beginning of the frame to reset upload budget.
+     */
+    ST_CPPEXPORT void beginFrame();
+
+    /**
+     * @return true if some tiles were requested but not uploaded due to budget limit
+     */
+    ST_LOCAL bool hasPendingTiles() const {
+        return myHasPending;
+    }
+
+    /**
+     * Return the texture holding requested tile, uploading it when it is not yet resident.
+     * @param theCtx      current context
+     * @param theLevel    pyramid level
+     * @param theTileX    tile column
+     * @param theTileY    tile row
+     * @param theIsLinear linear texture filter will be used (data rectangle is shrunk at image borders)
+     * @param theDataRect data rectangle within the texture (x, y, width, height) in normalized coordinates
+     * @return texture or NULL if tile is not available within this frame
+     */
+    ST_CPPEXPORT StGLTexture* getTile(StGLContext& theCtx,
+                                      const size_t theLevel,
+                                      const size_t theTileX,
+                                      const size_t theTileY,
+                                      const bool   theIsLinear,
+                                      StGLVec4&    theDataRect);
+
+        private:
+
+    /**
+     * Cached tile.
+     */
+    struct Tile {
+        StHandle<StGLTexture> Texture;  //!< texture object
+        size_t                Level;    //!< pyramid level
+        size_t                TileX;    //!< tile column
+        size_t                TileY;    //!< tile row
+        size_t                LastUsed; //!< frame index of the last usage
+        GLfloat               CoreL;    //!< tile left   border in texels
+        GLfloat               CoreT;    //!< tile top    border in texels
+        GLfloat               CoreR;    //!< tile right  border in texels
+        GLfloat               CoreB;    //!< tile bottom border in texels
+        bool                  HasR;     //!< tile has border pixel at the right
+        bool                  HasB;     //!< tile has border pixel at the bottom
+        bool                  IsValid;  //!< tile holds valid data
+
+        Tile() : Level(0), TileX(0), TileY(0), LastUsed(0),
+                 CoreL(0.0f), CoreT(0.0f), CoreR(0.0f), CoreB(0.0f),
+                 HasR(false), HasB(false), IsValid(false) {}
+    };
+
+        private:
+
+    std::vector<Tile>        myTiles;         //!< cached tiles
+    StHandle<StImagePyramid> myPyramid;       //!< active image pyramid
+    StImagePlane             myStaging;       //!< staging buffer for tile upload
+    size_t                   myNbTilesMax;    //!< maximum number of textures
+    size_t                   myNbUploadsMax;  //!< upload budget per frame
+    size_t                   myNbUploads;     //!< number of uploads within current frame
+    size_t                   myFrameIndex;    //!< frame counter for LRU
+    bool                     myHasPending;    //!< some tiles were skipped within current frame
+
+};
+
+#endif // __StGLTileCache_h_
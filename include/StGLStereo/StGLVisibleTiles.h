@@ -0,0 +1,194 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file license-boost.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+
+#ifndef __StGLVisibleTiles_h_
+#define __StGLVisibleTiles_h_
+
+#include <stTypes.h>
+
+/**
+ * Coarse mask of image regions visible on the screen.
+ * The image is split into fixed grid of NB_COLS x NB_ROWS tiles in normalized coordinates,
+ * so that the same mask can be applied to image planes of different dimensions (e.g. luma and chroma).
+ * Used to upload only visible part of panoramic frame into the texture.
+ *
+ * For equirectangular panorama tiles cover the whole image.
+ * For cubemap each face is split into NB_FACE_COLS x NB_ROWS tiles independently from packing layout,
+ * so that columns of face N start at N * NB_FACE_COLS.
+ */
+class StGLVisibleTiles {
+
+        public:
+
+    enum {
+        NB_COLS      = 30, //!< number of tile columns (bits in row mask)
+        NB_ROWS      = 16, //!< number of tile rows
+        NB_FACE_COLS = NB_COLS / 6, //!< number of tile columns per cubemap face
+    };
+
+    /**
+     * @return row mask with all tiles visible
+     */
+    static uint32_t allCols() {
+        return (uint32_t(1) << NB_COLS) - 1;
+    }
+
+        public:
+
+    /**
+     * Main constructor.
+     * @param theIsAll initial state of all tiles
+     */
+    StGLVisibleTiles(const bool theIsAll = true) {
+        setAll(theIsAll);
+    }
+
+    /**
+     * Mark all tiles as visible or invisible.
+     */
+    void setAll(const bool theIsVisible) {
+        for(int aRow = 0; aRow < NB_ROWS; ++aRow) {
+            myRows[aRow] = theIsVisible ? allCols() : 0;
+        }
+    }
+
+    /**
+     * @return true if all tiles are visible
+     */
+    bool isAll() const {
+        for(int aRow = 0; aRow < NB_ROWS; ++aRow) {
+            if(myRows[aRow] != allCols()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @return true if none of tiles is visible
+     */
+    bool isEmpty() const {
+        for(int aRow = 0; aRow < NB_ROWS; ++aRow) {
+            if(myRows[aRow] != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @return mask of visible tiles within specified row
+     */
+    uint32_t getRow(const int theRow) const {
+        return myRows[theRow];
+    }
+
+    /**
+     * @return true if specified tile is visible
+     */
+    bool isVisible(const int theCol,
+                   const int theRow) const {
+        return (myRows[theRow] & (uint32_t(1) << theCol)) != 0;
+    }
+
+    /**
+     * Mark the tile containing specified point as visible.
+     * @param theU horizontal normalized coordinate, wrapped into 0..1 range
+     * @param theV vertical   normalized coordinate, clamped to 0..1 range
+     */
+    void addPoint(const float theU,
+                  const float theV) {
+        const float aU = theU - std::floor(theU);
+        const int aCol = stMin(int(aU * float(NB_COLS)), int(NB_COLS) - 1);
+        const int aRow = stMax(stMin(int(theV * float(NB_ROWS)), int(NB_ROWS) - 1), 0);
+        myRows[aRow] |= uint32_t(1) << aCol;
+    }
+
+    /**
+     * Mark the tile within cubemap face containing specified point as visible.
+     * @param theFace cubemap face index (0..5)
+     * @param theS    horizontal normalized coordinate within the face
+     * @param theT    vertical   normalized coordinate within the face
+     */
+    void addFacePoint(const int   theFace,
+                      const float theS,
+                      const float theT) {
+        const int aCol = stMax(stMin(int(theS * float(NB_FACE_COLS)), int(NB_FACE_COLS) - 1), 0);
+        const int aRow = stMax(stMin(int(theT * float(NB_ROWS)),      int(NB_ROWS) - 1),      0);
+        myRows[aRow] |= uint32_t(1) << (theFace * NB_FACE_COLS + aCol);
+    }
+
+    /**
+     * Mark the whole tiles row as visible.
+     */
+    void addRow(const int theRow) {
+        myRows[theRow] = allCols();
+    }
+
+    /**
+     * Merge visible tiles from another mask.
+     */
+    void add(const StGLVisibleTiles& theOther) {
+        for(int aRow = 0; aRow < NB_ROWS; ++aRow) {
+            myRows[aRow] |= theOther.myRows[aRow];
+        }
+    }
+
+    /**
+     * @return tiles visible in this mask but not in another one
+     */
+    StGLVisibleTiles subtracted(const StGLVisibleTiles& theOther) const {
+        StGLVisibleTiles aRes(false);
+        for(int aRow = 0; aRow < NB_ROWS; ++aRow) {
+            aRes.myRows[aRow] = myRows[aRow] & ~theOther.myRows[aRow];
+        }
+        return aRes;
+    }
+
+    /**
+     * Extend visible region by one tile in each direction (horizontally wrapped).
+     */
+    void dilate() {
+        uint32_t aRows[NB_ROWS];
+        for(int aRow = 0; aRow < NB_ROWS; ++aRow) {
+            const uint32_t aMask = myRows[aRow];
+            aRows[aRow] = (aMask
+                         | (aMask << 1) | (aMask >> (NB_COLS - 1))
+                         | (aMask >> 1) | (aMask << (NB_COLS - 1))) & allCols();
+        }
+        for(int aRow = 0; aRow < NB_ROWS; ++aRow) {
+            myRows[aRow] = aRows[aRow];
+            if(aRow > 0) {
+                myRows[aRow] |= aRows[aRow - 1];
+            }
+            if(aRow + 1 < NB_ROWS) {
+                myRows[aRow] |= aRows[aRow + 1];
+            }
+        }
+    }
+
+    bool operator==(const StGLVisibleTiles& theOther) const {
+        for(int aRow = 0; aRow < NB_ROWS; ++aRow) {
+            if(myRows[aRow] != theOther.myRows[aRow]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool operator!=(const StGLVisibleTiles& theOther) const {
+        return !operator==(theOther);
+    }
+
+        private:
+
+    uint32_t myRows[NB_ROWS]; //!< bit masks of visible tiles per row
+
+};
+
+#endif // __StGLVisibleTiles_h_
@@ -12,6 +12,7 @@
 
 #include <StGLWidgets/StGLTextArea.h>
 #include <StGLWidgets/StGLMenuProgram.h>
+#include <StThreads/StFrameStatistics.h>
 
 /**
  * Widget for displaying diagnostic information
@@ -34,6 +35,11 @@ class StGLFpsLabel : public StGLTextArea {
     ST_LOCAL int&    changePlayQueued()      { return myPlayQueued; }
     ST_LOCAL int&    changePlayQueueLength() { return myPlayQueueLen; }
 
+    /**
+     * Setup playback statistics to display (read once per update interval), NULL to hide.
+     */
+    ST_LOCAL void setStatistics(const StFrameStatistics* theStats) { myStatistics = theStats; }
+
         public:  //! @name Signals
 
     struct {
@@ -53,6 +59,7 @@ class StGLFpsLabel : public StGLTextArea {
     double       myPlayFps;      //!< video decoding FPS
     int          myPlayQueued;   //!< queued frames
     int          myPlayQueueLen; //!< queue length
+    const StFrameStatistics* myStatistics; //!< playback statistics
     StTimer      myTimer;        //!< FPS timer
     unsigned int myCounter;      //!< frames counter
 
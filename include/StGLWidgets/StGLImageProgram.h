@@ -20,7 +20,7 @@
 /**
  * GLSL program for Image Region widget.
  */
-class StGLImageProgram : public StGLProgramMatrix<1, 5, StGLMeshProgram> {
+class StGLImageProgram : public StGLProgramMatrix<1, 6, StGLMeshProgram> {
 
         public:
 
@@ -48,6 +48,7 @@ class StGLImageProgram : public StGLProgramMatrix<1, 5, StGLMeshProgram> {
         FragSection_ToRgb,    //!< color conversion
         FragSection_Correct,  //!< color correction
         FragSection_Gamma,    //!< gamma correction
+        FragSection_Alpha,    //!< blending with alpha plane
         FragSection_NB
     };
 
@@ -77,6 +78,18 @@ class StGLImageProgram : public StGLProgramMatrix<1, 5, StGLMeshProgram> {
         FragToRgb_FromYuv10Mpeg,
         FragToRgb_FromYuvNvFull,
         FragToRgb_FromYuvNvMpeg,
+        FragToRgb_FromYuvNv10Full,
+        FragToRgb_FromYuvNv10Mpeg,
+        FragToRgb_FromYuv12Full,
+        FragToRgb_FromYuv12Mpeg,
+        FragToRgb_FromYuyvFull,
+        FragToRgb_FromYuyvMpeg,
+        FragToRgb_FromUyvyFull,
+        FragToRgb_FromUyvyMpeg,
+        FragToRgb_FromGbr,
+        FragToRgb_FromGbr9,
+        FragToRgb_FromGbr10,
+        FragToRgb_FromGbr12,
         FragToRgb_CUBEMAP,
         //FragToRgb_NB = FragToRgb_CUBEMAP * 2
     };
@@ -99,6 +112,16 @@ class StGLImageProgram : public StGLProgramMatrix<1, 5, StGLMeshProgram> {
         FragGamma_NB
     };
 
+    /**
+     * Alpha plane options in GLSL Fragment Shader.
+     */
+    enum FragAlpha {
+        FragAlpha_Off = 0,
+        FragAlpha_On,
+        FragAlpha_OnCubemap,
+        FragAlpha_NB
+    };
+
         public:
 
     ST_CPPEXPORT StGLImageProgram();
@@ -16,6 +16,7 @@
 #include <StGLWidgets/StGLWidget.h>
 #include <StGLWidgets/StGLImageProgram.h>
 #include <StGLStereo/StGLTextureQueue.h>
+#include <StGLStereo/StGLTileCache.h>
 
 #include <StGL/StParams.h>
 
@@ -132,11 +133,23 @@ class StGLImageRegion : public StGLWidget {
                                          unsigned int theView,
                                          const bool theToApplyDefShift) const;
 
+    /**
+     * Return tangent of vertical half field of view of displayed panorama
+     * (with zoom applied), or 0 if image is not displayed as panorama.
+     */
+    ST_CPPEXPORT float getPanoramaTanHalfFov() const;
+
     /**
      * Return true if there is any video stream.
      */
     ST_LOCAL bool hasVideoStream() { return myHasVideoStream; }
 
+    /**
+     * Return true if some full-resolution image tiles are still waiting for upload,
+     * so that the next frame should be drawn without delay.
+     */
+    ST_LOCAL bool hasPendingTiles() const { return myHasPendingTiles; }
+
     const StArrayList< StHandle<StAction> >& getActions() const {
         return myActions;
     }
@@ -170,6 +183,7 @@ class StGLImageRegion : public StGLWidget {
         StHandle<StEnumParam>         DisplayMode;           //!< StGLImageRegion::DisplayMode    - display mode
         StHandle<StEnumParam>         DisplayRatio;          //!< StGLImageRegion::DisplayRatio   - display ratio
         StHandle<StBoolParamNamed>    ToHealAnamorphicRatio; //!< correct aspect ratio for 1080p/720p anamorphic pairs
+        StHandle<StBoolParamNamed>    ToUploadVisible;       //!< upload only visible region of panorama frame
         StHandle<StEnumParam>         TextureFilter;         //!< StGLImageProgram::TextureFilter - texture filter;
         StHandle<StFloat32Param>      Gamma;                 //!< gamma correction coefficient
         StHandle<StFloat32Param>      Brightness;            //!< brightness level
@@ -303,6 +317,31 @@ class StGLImageRegion : public StGLWidget {
 
     ST_LOCAL void stglDrawView(unsigned int theView);
 
+    /**
+     * Mark panorama tiles visible within the view.
+     * @param theUnprojMat matrix transforming normalized device coordinates into panorama direction
+     * @param theIsCubemap cubemap or spherical panorama
+     * @param theFlipZ     cubemap Z direction flip factor
+     */
+    ST_LOCAL void addVisibleTiles(const StGLMatrix& theUnprojMat,
+                                  const bool        theIsCubemap,
+                                  const float       theFlipZ);
+
+    /**
+     * Draw visible tiles of full-resolution image pyramid over the downscaled image.
+     * Should be called with active image program.
+     * @param theCtx       active context
+     * @param theParams    parameters of displayed image
+     * @param theBaseSizeX width of downscaled image in texture
+     * @param theProjMat   projection matrix
+     * @param theModelMat  model matrix of the image quad
+     */
+    ST_LOCAL void stglDrawTiles(StGLContext&                    theCtx,
+                                const StHandle<StStereoParams>& theParams,
+                                const GLfloat                   theBaseSizeX,
+                                const StGLMatrix&               theProjMat,
+                                const StGLMatrix&               theModelMat);
+
         private: //! @name private fields
 
     StArrayList< StHandle<StAction> >
@@ -313,6 +352,8 @@ class StGLImageRegion : public StGLWidget {
     StGLProjCamera             myProjCam;        //!< copy of projection camera
     StGLImageProgram           myProgram;        //!< GL program to draw flat image
     StHandle<StGLTextureQueue> myTextureQueue;   //!< shared texture queue
+    StGLTileCache              myTileCache;      //!< GPU cache of full-resolution image tiles
+    StGLVisibleTiles           myVisibleTiles;   //!< panorama tiles visible within currently drawn frame
     StPointD_t                 myClickPntZo;     //!< remembered mouse click position
     StTimer                    myClickTimer;     //!< timer to delay dragging action
     StGLQuaternion             myDeviceQuat;     //!< device orientation
@@ -323,6 +364,7 @@ class StGLImageRegion : public StGLWidget {
     bool                       myToRightRotate;
     bool                       myIsInitialized;  //!< initialization state
     bool                       myHasVideoStream; //!< should be initialized for each new stream
+    bool                       myHasPendingTiles;//!< some tiles were not uploaded within previous frame
 
 };
 
@@ -11,6 +11,7 @@
 #define __StGLMenu_h_
 
 #include <StGLWidgets/StGLTextArea.h>
+#include <StGLWidgets/StGLTextBatch.h>
 #include <StGL/StGLVertexBuffer.h>
 
 // forward declarations
@@ -24,6 +25,7 @@ class StGLMenuItem;
 
 /**
  * Widget represents classical menu object.
+ * Text of menu items is collected into a batch and drawn at once after the items.
  */
 class StGLMenu : public StGLWidget {
 
@@ -215,6 +217,7 @@ class StGLMenu : public StGLWidget {
 
     StGLVertexBuffer           myVertexBuf;
     StGLVertexBuffer           myVertexBndBuf;
+    StGLTextBatch              myTextBatch;     //!< batch for text of menu items
     StGLVec4                   myColorVec;
     int                        myOrient;
     int                        myItemHeight;
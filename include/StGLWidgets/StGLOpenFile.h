@@ -19,6 +19,9 @@ class StGLMenuItem;
 
 /**
  * Widget for file system navigation.
+ * Only rows visible within the scroll area are represented by menu items,
+ * which are recycled while scrolling - so that folders with thousands of files
+ * do not create a widget (and text layout) per file.
  */
 class StGLOpenFile : public StGLMessageBox {
 
@@ -36,6 +39,10 @@ class StGLOpenFile : public StGLMessageBox {
      */
     ST_CPPEXPORT virtual ~StGLOpenFile();
 
+    ST_CPPEXPORT virtual bool stglInit() ST_ATTR_OVERRIDE;
+    ST_CPPEXPORT virtual void stglResize() ST_ATTR_OVERRIDE;
+    ST_CPPEXPORT virtual void stglDraw(unsigned int theView) ST_ATTR_OVERRIDE;
+
     /**
      * Define file filter.
      */
@@ -70,6 +77,31 @@ class StGLOpenFile : public StGLMessageBox {
                                   const StGLVec4& theColor,
                                   const bool      theisFolder);
 
+    /**
+     * Create new recycled menu items.
+     */
+    ST_LOCAL void addRowItems(const int theNbItems);
+
+    /**
+     * Layout recycled menu items with width of the widest row
+     * and extend the list to the whole number of rows.
+     */
+    ST_LOCAL void stglInitRows();
+
+    /**
+     * Bind recycled menu items to the rows within visible part of the list.
+     * Each row keeps the same item while it remains visible,
+     * so that only rows entering the view are updated.
+     * @param theToForce rebind all items (e.g. after opening new folder)
+     */
+    ST_LOCAL void bindRows(const bool theToForce);
+
+    /**
+     * Assign the row content (name, icon and click action) to the item.
+     */
+    ST_LOCAL void bindRow(StGLMenuItem* theItem,
+                          const int     theRow);
+
     /**
      * Handle hot-item click event - just remember item id.
      */
@@ -85,6 +117,11 @@ class StGLOpenFile : public StGLMessageBox {
      */
     ST_CPPEXPORT void doFolderUpClick(const size_t );
 
+    /**
+     * Handle click on recycled list item.
+     */
+    ST_CPPEXPORT void doListItemClick(const size_t theRow);
+
     /**
      * Override unclick to open new folder.
      */
@@ -103,6 +140,11 @@ class StGLOpenFile : public StGLMessageBox {
     StMIMEList                 myFilter;        //!< file filter
     StArrayList<StString>      myExtensions;    //!< extensions filter
     StString                   myItemToLoad;    //!< new item to open
+    int                        myNbRows;        //!< number of rows within the list (including folder-up item)
+    int                        myNbRowItems;    //!< number of recycled menu items
+    int                        myFirstRow;      //!< first visible row, -1 if items are not bound
+    int                        myRowsWidth;     //!< width of the widest row (including margins)
+    bool                       myHasUpItem;     //!< the first row is folder-up item
 
         protected: //! @name main file list settings
 
@@ -20,6 +20,7 @@ template<> inline void StArray<StGLNamedTexture>::sort() {}
 typedef StArray<StGLNamedTexture> StGLTextureArray;
 class StGLMenuProgram;
 class StGLMessageBox;
+class StGLTextBatch;
 class StGLTextProgram;
 class StGLTextBorderProgram;
 
@@ -122,6 +123,21 @@ class StGLRootWidget : public StGLWidget {
      */
     ST_LOCAL StGLTextBorderProgram& getTextBorderProgram() { return *myTextBorderProgram; }
 
+    /**
+     * Return active text batch collecting text of widgets being drawn, NULL if text should be drawn immediately.
+     */
+    ST_LOCAL StGLTextBatch* getTextBatch() const { return myTextBatch; }
+
+    /**
+     * Set active text batch.
+     * @return previously active batch to be restored
+     */
+    ST_LOCAL StGLTextBatch* setTextBatch(StGLTextBatch* theBatch) {
+        StGLTextBatch* aPrev = myTextBatch;
+        myTextBatch = theBatch;
+        return aPrev;
+    }
+
     /**
      * Return color of standard element.
      */
@@ -522,6 +538,7 @@ class StGLRootWidget : public StGLWidget {
     StArrayList<StGLWidget*>  myDestroyList;   //!< list of widgets to be destroyed
     StGLWidget*               myFocusWidget;   //!< widget currently in focus
     StGLMessageBox*           myModalDialog;   //!< active dialog
+    StGLTextBatch*            myTextBatch;     //!< active text batch
 
     bool                      myIsMenuPressed; //!< global flag to perform navigation in menu after first item clicked
 
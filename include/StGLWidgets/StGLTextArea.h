@@ -224,6 +224,11 @@ class StGLTextArea : public StGLWidget {
 
         private:
 
+    /**
+     * Upload formatted text into VBOs (when drawn without batch).
+     */
+    ST_LOCAL void uploadText(StGLContext& theCtx);
+
     ST_LOCAL void drawText(StGLContext& theCtx);
 
     ST_LOCAL void recomputeBorder(StGLContext& theCtx);
@@ -256,8 +261,10 @@ class StGLTextArea : public StGLWidget {
     StGLRect             myTextBndBox;    //!< text boundary box
 
     GLfloat              myTextWidth;     //!< text width limit
+    size_t               myTextRevision;  //!< unique identifier of formatting result
 
     bool                 myToRecompute;   //!< flag indicates that text VBOs should be recomputed
+    bool                 myToUpload;      //!< flag indicates that formatted text should be uploaded into VBOs
     bool                 myToShowBorder;  //!< to show text area border
     bool                 myToDrawShadow;  //!< to render text shadow
     bool                 myIsInitialized;
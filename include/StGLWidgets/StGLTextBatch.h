@@ -0,0 +1,147 @@
+/**
+ * StGLWidgets, small C++ toolkit for writing GUI using OpenGL.
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file license-boost.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+
+#ifndef __StGLTextBatch_h_
+#define __StGLTextBatch_h_
+
+#include <StGL/StGLMatrix.h>
+#include <StGL/StGLTextFormatter.h>
+#include <StGL/StGLVertexBuffer.h>
+
+#include <vector>
+
+class StGLTextProgram;
+
+/**
+ * Retained batch of text blocks sharing the same program.
+ * Glyph quads of all blocks are merged into vertex streams per font texture and text color,
+ * so that the whole batch is drawn with single program binding and one draw call per stream.
+ *
+ * Streams are rebuilt only when the list of blocks differs from the one used for previous build
+ * (text reformatted, moved or recolored), thus unchanged batch is re-used across frames
+ * and between left and right views - stereo parallax is applied by model matrix.
+ *
+ * Blocks are drawn in arbitrary order, so that batch should combine only non-overlapping text.
+ */
+class StGLTextBatch {
+
+        public:
+
+    /**
+     * Empty constructor.
+     */
+    ST_CPPEXPORT StGLTextBatch();
+
+    /**
+     * Destructor, release() should be called before.
+     */
+    ST_CPPEXPORT ~StGLTextBatch();
+
+    /**
+     * Release GL resources.
+     */
+    ST_CPPEXPORT void release(StGLContext& theCtx);
+
+    /**
+     * Clear list of blocks to start new batch.
+     */
+    ST_CPPEXPORT void reset();
+
+    /**
+     * @return true if batch has no blocks
+     */
+    ST_LOCAL bool isEmpty() const {
+        return myBlocks.empty();
+    }
+
+    /**
+     * Append formatted text block.
+     * Formatter should not be modified until the batch is drawn.
+     * @param theFormatter formatter with result
+     * @param theRevision  unique identifier of formatting result
+     * @param theOffset    block position
+     * @param theScale     scale factor for formatter units
+     * @param theColor     text color
+     */
+    ST_CPPEXPORT void addText(const StGLTextFormatter& theFormatter,
+                              const size_t             theRevision,
+                              const StGLVec2&          theOffset,
+                              const GLfloat            theScale,
+                              const StGLVec4&          theColor);
+
+    /**
+     * Draw the batch, rebuilding streams when necessary.
+     * @param theCtx      active GL context
+     * @param theProgram  text program with projection matrix already set
+     * @param theModelMat model-view matrix (including stereo parallax)
+     */
+    ST_CPPEXPORT void stglDraw(StGLContext&      theCtx,
+                               StGLTextProgram&  theProgram,
+                               const StGLMatrix& theModelMat);
+
+        private:
+
+    /**
+     * Text block description.
+     */
+    struct Block {
+        const StGLTextFormatter* Formatter; //!< formatter with result (valid only till the batch is drawn)
+        size_t                   Revision;  //!< formatting result identifier
+        StGLVec2                 Offset;    //!< position
+        GLfloat                  Scale;     //!< scale factor
+        StGLVec4                 Color;     //!< text color
+
+        /**
+         * Compare blocks ignoring formatter pointer.
+         */
+        bool isSame(const Block& theOther) const {
+            return Revision == theOther.Revision
+                && Scale    == theOther.Scale
+                && Offset   == theOther.Offset
+                && Color    == theOther.Color;
+        }
+    };
+
+    /**
+     * Vertex stream for single font texture and text color.
+     */
+    struct Stream {
+        GLuint                Texture; //!< font texture
+        StGLVec4              Color;   //!< text color
+        std::vector<StGLVec2> Verts;   //!< vertices (valid only during rebuild)
+        std::vector<StGLVec2> TCrds;   //!< texture coordinates (valid only during rebuild)
+        StGLVertexBuffer      VertBuf; //!< vertices buffer
+        StGLVertexBuffer      TCrdBuf; //!< texture coordinates buffer
+    };
+
+    /**
+     * @return true if blocks differ from the ones used for last build
+     */
+    ST_LOCAL bool isChanged() const;
+
+    /**
+     * Rebuild vertex streams.
+     */
+    ST_LOCAL void rebuild(StGLContext& theCtx);
+
+        private:
+
+    std::vector<Block>               myBlocks;      //!< blocks of current batch
+    std::vector<Block>               myBuiltBlocks; //!< blocks used for last build
+    std::vector< StHandle<Stream> >  myStreams;     //!< vertex streams
+    size_t                           myNbStreams;   //!< number of active streams (others are kept for re-use)
+
+        private: //! @name copying is forbidden
+
+    StGLTextBatch           (const StGLTextBatch& );
+    StGLTextBatch& operator=(const StGLTextBatch& );
+
+};
+
+#endif // __StGLTextBatch_h_
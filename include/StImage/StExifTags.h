@@ -54,6 +54,10 @@ namespace StExifTags {
         Image_DateTime    = 0x0132,
     };
 
+    enum Mpo {
+        Mpo_NumberOfImages = 0xB001,
+    };
+
     enum Fuji {
         Fuji_Parallax = 0xB211,
     };
@@ -58,6 +58,9 @@ class StImage {
         ImgColor_CMYK,    //!< Cyan, Magenta, Yellow and Black - generally used in printing process
         ImgColor_HSV,     //!< Hue, Saturation, Value (also known as HSB - Hue, Saturation, Brightness)
         ImgColor_HSL,     //!< Hue, Saturation, Lightness/Luminance (also known as HLS or HSI - Hue, Saturation, Intensity))
+        ImgColor_YUVA,    //!< same as YUV but has Alpha plane (4th plane of luma dimensions)
+        ImgColor_GBR,     //!< Green, Blue, Red stored in separate planes (in this order)
+        ImgColor_GBRA,    //!< same as GBR but has Alpha plane
     } ImgColorModel;
 
     typedef enum tagImgColorScale {
@@ -70,6 +73,14 @@ class StImage {
         ImgScale_Jpeg10,  //!< 10 bits in 16 bits 0..1023
         ImgScale_NvFull,  //!< full range (use all bits)
         ImgScale_NvMpeg,  //!< YUV  8 bits per component Y   16..235;   U and V   16..240
+        ImgScale_Mpeg12,  //!< YUV 12 bits in 16 bits    Y  256..3760;  U and V  256..3840
+        ImgScale_Jpeg12,  //!< 12 bits in 16 bits 0..4095
+        ImgScale_YuyvFull, //!< packed YUV 4:2:2 (Y0 U Y1 V), full range
+        ImgScale_YuyvMpeg, //!< packed YUV 4:2:2 (Y0 U Y1 V), Y 16..235; U and V 16..240
+        ImgScale_UyvyFull, //!< packed YUV 4:2:2 (U Y0 V Y1), full range
+        ImgScale_UyvyMpeg, //!< packed YUV 4:2:2 (U Y0 V Y1), Y 16..235; U and V 16..240
+        ImgScale_Nv10Full, //!< semi-planar YUV 10 bits in high bits of 16 bits (P010), full range
+        ImgScale_Nv10Mpeg, //!< semi-planar YUV 10 bits in high bits of 16 bits (P010), Y 64..940; U and V 64..960
     } ImgColorScale;
 
     ST_CPPEXPORT static StString formatImgColorModel(ImgColorModel theColorModel);
@@ -190,6 +201,7 @@ class StImage {
             case StImagePlane::ImgBGRA:
             case StImagePlane::ImgRGBAF:
             case StImagePlane::ImgBGRAF:
+            case StImagePlane::ImgRGBAHalf:
                 myColorModel = ImgColor_RGBA; return;
             case StImagePlane::ImgRGB:
             case StImagePlane::ImgBGR:
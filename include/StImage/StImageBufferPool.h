@@ -0,0 +1,119 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file license-boost.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+
+#ifndef __StImageBufferPool_h_
+#define __StImageBufferPool_h_
+
+#include <StThreads/StMutex.h>
+
+#include <vector>
+
+/**
+ * Thread-safe pool of large aligned memory buffers for decoded frames and texture staging data.
+ * Requested sizes are rounded up to size classes (4 classes per power of two),
+ * so that buffers released on resolution or format change can be reused by the next frames
+ * instead of returning them to the system heap.
+ *
+ * Released buffers are kept in the pool until the limit of cached memory is exceeded
+ * (the oldest ones are freed first) or until trim() is called on memory pressure.
+ * Large buffers are allocated with huge-pages alignment and advised to be backed by huge pages where supported.
+ */
+class StImageBufferPool {
+
+        public:
+
+    /**
+     * Pool statistics.
+     */
+    struct Statistics {
+        size_t NbUsed;    //!< number of buffers in use
+        size_t NbFree;    //!< number of cached buffers
+        size_t BytesUsed; //!< size of buffers in use
+        size_t BytesFree; //!< size of cached buffers
+        size_t BytesPeak; //!< peak size of all buffers allocated through the pool
+        size_t NbHits;    //!< number of allocations served from cached buffers
+        size_t NbMisses;  //!< number of allocations requested from the system
+
+        Statistics() : NbUsed(0), NbFree(0), BytesUsed(0), BytesFree(0), BytesPeak(0), NbHits(0), NbMisses(0) {}
+    };
+
+        public:
+
+    /**
+     * @return global pool instance
+     */
+    ST_CPPEXPORT static StImageBufferPool& GetDefault();
+
+    /**
+     * Main constructor.
+     * @param theMaxFreeBytes limit of cached memory
+     */
+    ST_CPPEXPORT StImageBufferPool(const size_t theMaxFreeBytes);
+
+    /**
+     * Destructor, releases cached buffers.
+     * Buffers in use should be released before pool destruction.
+     */
+    ST_CPPEXPORT ~StImageBufferPool();
+
+    /**
+     * Allocate the buffer aligned to ST_ALIGNMENT.
+     * @param theNbBytes requested size
+     * @return allocated buffer or NULL on failure
+     */
+    ST_CPPEXPORT void* allocate(const size_t theNbBytes);
+
+    /**
+     * Return the buffer previously allocated by allocate() back to the pool.
+     */
+    ST_CPPEXPORT void release(void* theBuffer);
+
+    /**
+     * Free cached buffers exceeding specified limit (the oldest ones first).
+     * @param theMaxFreeBytes limit of cached memory, 0 to free all cached buffers
+     */
+    ST_CPPEXPORT void trim(const size_t theMaxFreeBytes = 0);
+
+    /**
+     * @return limit of cached memory
+     */
+    ST_CPPEXPORT size_t getMaxFreeBytes() const;
+
+    /**
+     * Setup limit of cached memory.
+     */
+    ST_CPPEXPORT void setMaxFreeBytes(const size_t theMaxFreeBytes);
+
+    /**
+     * @return current statistics
+     */
+    ST_CPPEXPORT Statistics getStatistics() const;
+
+        private:
+
+    /**
+     * Cached buffer.
+     */
+    struct FreeBuffer {
+        void*  Data;  //!< pointer to the buffer header
+        size_t Bytes; //!< buffer size (size class)
+    };
+
+    StImageBufferPool(const StImageBufferPool& );
+    StImageBufferPool& operator=(const StImageBufferPool& );
+
+        private:
+
+    mutable StMutex         myMutex;        //!< lock for thread-safety
+    std::vector<FreeBuffer> myFreeList;     //!< cached buffers in order of release (the oldest first)
+    Statistics              myStats;        //!< pool statistics
+    size_t                  myMaxFreeBytes; //!< limit of cached memory
+
+};
+
+#endif // __StImageBufferPool_h_
@@ -41,9 +41,18 @@ class StImagePlane {
         ImgRGBAF,       //!< 4 floats (16-bytes) RGBA image plane
         ImgBGRAF,       //!< same as RGBAF but with different components order
         ImgUV,          //!< 2 bytes packed UV image plane
+        ImgRGBHalf,     //!< 3 half-floats (6-bytes) RGB image plane
+        ImgRGBAHalf,    //!< 4 half-floats (8-bytes) RGBA image plane
+        ImgRGB10A2,     //!< 4 bytes packed RGB image plane with 10 bits per color component and 2 bits alpha (from lower to higher bits)
+        ImgUV16,        //!< 4 bytes packed UV image plane (16 bits per component)
     } ImgFormat;
 
     ST_CPPEXPORT static StString formatImgFormat(ImgFormat theImgFormat);
+
+    /**
+     * @return number of bytes per pixel for specified format
+     */
+    ST_CPPEXPORT static size_t getSizePixelBytes(ImgFormat theImgFormat);
     inline StString formatImgFormat() const { return formatImgFormat(myImgFormat); }
 
         protected:
@@ -272,6 +281,20 @@ class StImagePlane {
                                      const int theSeparationDy = 0,
                                      const int theValue = 0);
 
+    /**
+     * Initialize RGBA image plane from 8-bit indexed image (palette expansion).
+     * @param theIndices         color indices
+     * @param theIndicesRowBytes size of indices row in bytes
+     * @param thePalette         256 colors in native-endian 0xAARRGGBB format (FFmpeg PAL8 layout)
+     * @param theSizeX           image width
+     * @param theSizeY           image height
+     */
+    ST_CPPEXPORT bool initFromPalette(const GLubyte*  theIndices,
+                                      const size_t    theIndicesRowBytes,
+                                      const uint32_t* thePalette,
+                                      const size_t    theSizeX,
+                                      const size_t    theSizeY);
+
     ST_CPPEXPORT bool fill(const StImagePlane& theCopy,
                            const bool          theIsCompact);
 
@@ -0,0 +1,160 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file license-boost.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+
+#ifndef __StImagePyramid_h_
+#define __StImagePyramid_h_
+
+#include <StImage/StImage.h>
+
+#include <vector>
+
+/**
+ * Tiled mip-pyramid over the image which doesn't fit into single texture.
+ * Level 0 is the original image (kept by reference),
+ * each next level is downsampled twice using 2x2 box filter
+ * until the level fits into specified size limits.
+ * Tiles are extracted on demand with 1 pixel border (where available)
+ * to allow seamless linear filtering between neighbors.
+ */
+class StImagePyramid {
+
+        public:
+
+    /**
+     * Default tile size - tile with 1 pixel border fits into 512x512 texture.
+     */
+    static const size_t DEFAULT_TILE_SIZE = 510;
+
+        public:
+
+    /**
+     * Return true if image plane format is supported by pyramid
+     * (8-bit RGB / RGBA formats).
+     */
+    ST_CPPEXPORT static bool isSupportedFormat(const StImagePlane::ImgFormat theFormat);
+
+    /**
+     * Return true if image can be used for pyramid construction.
+     */
+    ST_CPPEXPORT static bool isSupported(const StImage& theImage);
+
+        public:
+
+    /**
+     * Empty constructor.
+     */
+    ST_CPPEXPORT StImagePyramid();
+
+    /**
+     * Destructor.
+     */
+    ST_CPPEXPORT ~StImagePyramid();
+
+    /**
+     * Build pyramid from the image.
+     * @param theImage    original image, should remain unchanged while pyramid is in use
+     * @param theMaxSizeX levels are generated until their width  fits this limit
+     * @param theMaxSizeY levels are generated until their height fits this limit
+     * @param theTileSize tile size in pixels (without border)
+     * @return true on success
+     */
+    ST_CPPEXPORT bool init(const StHandle<StImage>& theImage,
+                           const size_t             theMaxSizeX,
+                           const size_t             theMaxSizeY,
+                           const size_t             theTileSize);
+
+    /**
+     * Release memory.
+     */
+    ST_CPPEXPORT void nullify();
+
+    /**
+     * @return true if pyramid is empty
+     */
+    ST_LOCAL bool isNull() const {
+        return myLevels.empty();
+    }
+
+    /**
+     * @return number of levels
+     */
+    ST_LOCAL size_t getNbLevels() const {
+        return myLevels.size();
+    }
+
+    /**
+     * @return tile size in pixels (without border)
+     */
+    ST_LOCAL size_t getTileSize() const {
+        return myTileSize;
+    }
+
+    /**
+     * @return image plane of specified level
+     */
+    ST_LOCAL const StImagePlane& getLevel(const size_t theLevel) const {
+        return *myLevels[theLevel];
+    }
+
+    /**
+     * @return color model of the image
+     */
+    ST_LOCAL StImage::ImgColorModel getColorModel() const {
+        return myColorModel;
+    }
+
+    /**
+     * @return number of tiles in specified level in horizontal direction
+     */
+    ST_LOCAL size_t getNbTilesX(const size_t theLevel) const {
+        return (getLevel(theLevel).getSizeX() + myTileSize - 1) / myTileSize;
+    }
+
+    /**
+     * @return number of tiles in specified level in vertical direction
+     */
+    ST_LOCAL size_t getNbTilesY(const size_t theLevel) const {
+        return (getLevel(theLevel).getSizeY() + myTileSize - 1) / myTileSize;
+    }
+
+    /**
+     * Copy the tile into the plane (reallocated when needed).
+     * The output plane is always top-down and includes 1 pixel border around the tile when available.
+     * @param theLevel   pyramid level
+     * @param theTileX   tile column
+     * @param theTileY   tile row
+     * @param theTile    output image plane
+     * @param theBorderL output width of left border (0 or 1)
+     * @param theBorderT output height of top border (0 or 1)
+     * @return true on success
+     */
+    ST_CPPEXPORT bool copyTile(const size_t  theLevel,
+                               const size_t  theTileX,
+                               const size_t  theTileY,
+                               StImagePlane& theTile,
+                               size_t&       theBorderL,
+                               size_t&       theBorderT) const;
+
+        private:
+
+    /**
+     * Fill the plane with source downsampled twice.
+     */
+    ST_LOCAL static void downsample(const StImagePlane& theSrc,
+                                    StImagePlane&       theDst);
+
+        private:
+
+    StHandle<StImage>                     myImage;      //!< original image (level 0)
+    std::vector< StHandle<StImagePlane> > myLevels;     //!< pyramid levels, level 0 wraps original image
+    StImage::ImgColorModel                myColorModel; //!< color model
+    size_t                                myTileSize;   //!< tile size
+
+};
+
+#endif // __StImagePyramid_h_
@@ -14,6 +14,8 @@
 
 #include "StExifDir.h"
 
+#include <vector>
+
 /**
  * JPEG format parser (Joint Photographic Experts Group).
  * This class doesn't decode the image but only parses format structure.
@@ -54,11 +56,21 @@ class StJpegParser : public StRawFile {
         OffsetsNb,
     };
 
+    /**
+     * Raw EXIF section (APP1 or APP2) within the data.
+     */
+    struct ExifSection {
+        unsigned char*     Data;   //!< pointer to the section content (TIFF header)
+        size_t             Length; //!< section content length
+        StExifDir::DirType Type;   //!< directory type
+    };
+
     struct Image {
         unsigned char*  Data;     //!< pointer to the data
         size_t          Length;   //!< data length
-        StArrayList< StHandle<StExifDir> >
-                        Exif;     //!< EXIF sections
+        size_t          HeadersLength; //!< length of headers up to the first Start Of Scan marker
+        std::vector<ExifSection>
+                        ExifSections;  //!< raw EXIF sections, parsed on demand by getExif()
         StHandle<Image> Thumb;    //!< optional thumbnail
         StHandle<Image> Next;     //!< link to the next image in file (if any)
         size_t          SizeX;    //!< image width  in pixels
@@ -69,6 +81,14 @@ class StJpegParser : public StRawFile {
         ST_CPPEXPORT Image();
         ST_CPPEXPORT ~Image();
 
+        /**
+         * Return EXIF directories, which are parsed on first access.
+         * Structural parsing of the file does not decode EXIF, so that images which metadata
+         * is never requested (thumbnails, extra MPO frames) do not waste time on it.
+         * Should not be called concurrently for the same image.
+         */
+        ST_CPPEXPORT const StExifDir::List& getExif() const;
+
         /**
          * Read image timestamp property.
          */
@@ -85,6 +105,17 @@ class StJpegParser : public StRawFile {
          * Reads the orientation info from EXIF.
          */
         ST_CPPEXPORT Orient getOrientation() const;
+
+        /**
+         * Reads the number of images declared in MP extensions (MPO).
+         * @return number of images or 0 if section is not found
+         */
+        ST_CPPEXPORT size_t getNbMpoImages() const;
+
+            private:
+
+        mutable StExifDir::List Exif;         //!< parsed EXIF directories
+        mutable bool            IsExifParsed; //!< flag indicating that EXIF sections have been parsed
     };
 
     static int getRotationAngle(const Orient theJpegOri) {
@@ -122,6 +153,20 @@ class StJpegParser : public StRawFile {
                                        const int        theOpenedFd = -1,
                                        const size_t     theReadMax  = 0) ST_ATTR_OVERRIDE;
 
+    /**
+     * Read only the headers of the first image (up to the Start Of Scan marker),
+     * which is enough to retrieve dimensions, EXIF and JPS sections.
+     * Image data will not be available and getNbImages() will return 1;
+     * use Image::getNbMpoImages() to retrieve the number of images in MPO.
+     * @param theFilePath the file path
+     * @param theOpenedFd when specified, already opened file descriptor will be used
+     * @param theReadMax  maximum number of bytes to read
+     * @return true if headers were parsed
+     */
+    ST_CPPEXPORT bool readHeaders(const StCString& theFilePath,
+                                  const int        theOpenedFd = -1,
+                                  const size_t     theReadMax  = 256 * 1024);
+
     /**
      * Determines images count.
      */
@@ -182,6 +227,14 @@ class StJpegParser : public StRawFile {
      */
     ST_CPPEXPORT bool parse();
 
+    /**
+     * Create a compact parser holding only the headers of specified image (up to Start Of Scan),
+     * so that its metadata can be retrieved later without keeping the whole file in memory.
+     * @param theImage image within this parser
+     * @return NULL if image headers are unavailable
+     */
+    ST_CPPEXPORT StHandle<StJpegParser> copyHeaders(const StHandle<StJpegParser::Image>& theImage) const;
+
     ST_CPPEXPORT void fillDictionary(StDictionary& theDict,
                                      const bool    theToShowUnknown) const;
 
@@ -211,6 +264,14 @@ class StJpegParser : public StRawFile {
                                                           unsigned char* theDataStart,
                                                           const bool     theToFindSOI);
 
+    /**
+     * Update pointers within image for relocated buffer.
+     */
+    ST_LOCAL void relocateImage(StJpegParser::Image& theImage,
+                                stUByte_t*           theNewData,
+                                const ptrdiff_t      theOffset,
+                                const size_t         theDiff) const;
+
     /**
      * Create new section at specified offset.
      * @param theMarker  section marker
@@ -229,6 +290,7 @@ class StJpegParser : public StRawFile {
     StString        myComment;    //!< string stored in COM segment (directly in JPEG, NOT inside EXIF)
     StString        myJpsComment; //!< string stored in JPS segment
     StFormat        myStFormat;   //!< stereo format
+    bool            myToStopAtSos;//!< parse only headers of the first image
 
 };
 
@@ -1,5 +1,5 @@
 /**
- * Copyright © 2011-2014 Kirill Gavrilov <kirill@sview.ru>
+ * Copyright © 2011-2017 Kirill Gavrilov <kirill@sview.ru>
  *
  * Distributed under the Boost Software License, Version 1.0.
  * See accompanying file license-boost.txt or copy at
@@ -93,6 +93,57 @@ class StAtomicOp {
         return (uint32_t )Decrement((volatile int32_t& )theValue);
     }
 
+    /**
+     * Replace the value with new one only if it is equal to expected one.
+     * @param theValue    (volatile int32_t& ) - input value;
+     * @param theOldValue expected value;
+     * @param theNewValue value to set;
+     * @return true if value has been replaced.
+     */
+    static inline bool CompareAndSwap(volatile int32_t& theValue,
+                                      const int32_t     theOldValue,
+                                      const int32_t     theNewValue) {
+    #ifdef __GCC_HAVE_SYNC_COMPARE_AND_SWAP_4
+        // g++ compiler
+        return __sync_bool_compare_and_swap(&theValue, theOldValue, theNewValue);
+    #elif defined(_WIN32)
+        return InterlockedCompareExchange((volatile LONG* )&theValue, theNewValue, theOldValue) == theOldValue;
+    #elif defined(__APPLE__)
+        return OSAtomicCompareAndSwap32Barrier(theOldValue, theNewValue, &theValue);
+    #elif defined(__GNUC__)
+        #error "Set -march=i486 or -march=armv7-a for gcc compiler"
+        return false;
+    #else
+        #error "Atomic operation doesn't implemented for current platform!"
+        return false;
+    #endif
+    }
+
+    /**
+     * Replace the value with new one only if it is equal to expected one.
+     */
+    static inline bool CompareAndSwap(volatile uint32_t& theValue,
+                                      const uint32_t     theOldValue,
+                                      const uint32_t     theNewValue) {
+        return CompareAndSwap((volatile int32_t& )theValue, (int32_t )theOldValue, (int32_t )theNewValue);
+    }
+
+    /**
+     * Full memory barrier - memory operations are not reordered across this call
+     * neither by compiler nor by CPU.
+     */
+    static inline void Barrier() {
+    #if defined(__GNUC__)
+        __sync_synchronize();
+    #elif defined(_WIN32)
+        MemoryBarrier();
+    #elif defined(__APPLE__)
+        OSMemoryBarrier();
+    #else
+        #error "Atomic operation doesn't implemented for current platform!"
+    #endif
+    }
+
     // int64_t, actually available on win32 too, but since WinNT 5.2 (Windows XP x64)
 #if (defined(_WIN64) || defined(__WIN64__))\
  || (defined(_LP64)  || defined(__LP64__))
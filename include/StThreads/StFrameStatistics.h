@@ -0,0 +1,160 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file license-boost.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+
+#ifndef __StFrameStatistics_h_
+#define __StFrameStatistics_h_
+
+#include <StStrings/StString.h>
+#include <StThreads/StMutexSlim.h>
+#include <StThreads/StTimer.h>
+
+/**
+ * Thread-safe collector of playback quality statistics:
+ * frame time histograms, vsync misses, dropped frames, A/V sync drift, decoder queue depth and texture upload time.
+ * Values are written by render, timer and decoding threads and read at low rate by GUI or web server,
+ * thus each update takes only a short lock.
+ */
+class StFrameStatistics {
+
+        public:
+
+    enum {
+        NB_BINS = 8, //!< number of histogram bins
+    };
+
+    /**
+     * @return upper limit of specified histogram bin in milliseconds, the last bin is unlimited
+     */
+    ST_CPPEXPORT static double getBinLimitMs(const int theBin);
+
+    /**
+     * Histogram of time intervals.
+     */
+    struct Histogram {
+        size_t Bins[NB_BINS]; //!< number of samples within each bin
+        size_t Count;         //!< number of samples
+        double SumMs;         //!< total time in milliseconds
+        double MaxMs;         //!< maximum time in milliseconds
+
+        Histogram() { reset(); }
+
+        /**
+         * Reset histogram.
+         */
+        ST_CPPEXPORT void reset();
+
+        /**
+         * Add the sample.
+         */
+        ST_CPPEXPORT void add(const double theMs);
+
+        /**
+         * @return average time in milliseconds
+         */
+        double getAverageMs() const {
+            return Count != 0 ? SumMs / double(Count) : 0.0;
+        }
+    };
+
+    /**
+     * Statistics values.
+     */
+    struct Snapshot {
+        Histogram Frame;         //!< interval between displayed frames
+        Histogram Render;        //!< CPU time spent on drawing the frame
+        Histogram Swap;          //!< remaining part of frame interval - buffers swap and waiting for vsync
+        Histogram Upload;        //!< time spent on uploading video frame into textures
+        Histogram Decode[2];     //!< time spent on decoding video frame by master (left) and slave (right) streams
+        size_t    NbVsyncMisses; //!< number of frames displayed later than expected by target FPS
+        size_t    NbDropped;     //!< number of video frames dropped by A/V synchronization
+        double    DiffVAMs;      //!< last Audio to Video PTS diff in milliseconds
+        double    DiffVAMaxMs;   //!< maximum absolute Audio to Video PTS diff in milliseconds
+        size_t    DecoderQueue;  //!< number of packets within decoder queue
+        double    TargetFps;     //!< last target FPS
+
+        Snapshot() : NbVsyncMisses(0), NbDropped(0), DiffVAMs(0.0), DiffVAMaxMs(0.0), DecoderQueue(0), TargetFps(0.0) {}
+    };
+
+        public:
+
+    /**
+     * Empty constructor.
+     */
+    ST_CPPEXPORT StFrameStatistics();
+
+    /**
+     * Reset all statistics (e.g. on opening new file).
+     */
+    ST_CPPEXPORT void reset();
+
+    /**
+     * Register the start of new frame (to be called once per displayed frame).
+     * The interval since previous call is split into render time accumulated by addRenderTime()
+     * and the swap time (the rest). Intervals longer than one second are considered as pause and skipped.
+     * @param theTargetFps target (monitor) FPS to detect vsync misses, 0 if unknown
+     */
+    ST_CPPEXPORT void nextFrame(const double theTargetFps);
+
+    /**
+     * Accumulate render time of the current frame.
+     */
+    ST_CPPEXPORT void addRenderTime(const double theMs);
+
+    /**
+     * Register texture upload time.
+     */
+    ST_CPPEXPORT void addUploadTime(const double theMs);
+
+    /**
+     * Register video frame decoding time.
+     * @param theStream stream index, 0 for master and 1 for slave stream
+     * @param theMs     decoding time in milliseconds
+     */
+    ST_CPPEXPORT void addDecodeTime(const int    theStream,
+                                    const double theMs);
+
+    /**
+     * Increment dropped frames counter.
+     */
+    ST_CPPEXPORT void addDropped(const size_t theNbFrames);
+
+    /**
+     * Setup current Audio to Video PTS diff.
+     */
+    ST_CPPEXPORT void setSyncDiff(const double theDiffMs);
+
+    /**
+     * Setup current decoder queue depth.
+     */
+    ST_CPPEXPORT void setDecoderQueue(const size_t theNbPackets);
+
+    /**
+     * @return copy of current statistics
+     */
+    ST_CPPEXPORT Snapshot getSnapshot() const;
+
+    /**
+     * Format statistics as JSON object.
+     */
+    ST_CPPEXPORT static StString formatJson(const Snapshot& theStats);
+
+        private:
+
+    StFrameStatistics(const StFrameStatistics& );
+    StFrameStatistics& operator=(const StFrameStatistics& );
+
+        private:
+
+    mutable StMutexSlim myMutex;      //!< lock for thread-safety
+    Snapshot            myStats;      //!< collected statistics
+    StTimer             myFrameTimer; //!< timer measuring interval between frames
+    double              myRenderMs;   //!< render time accumulated for the current frame
+
+};
+
+#endif // __StFrameStatistics_h_
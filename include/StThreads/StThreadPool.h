@@ -0,0 +1,126 @@
+/**
+ * Copyright © 2017 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * Distributed under the Boost Software License, Version 1.0.
+ * See accompanying file license-boost.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt
+ */
+
+#ifndef __StThreadPool_h_
+#define __StThreadPool_h_
+
+#include <StThreads/StCondition.h>
+#include <StThreads/StMutex.h>
+#include <StThreads/StThread.h>
+#include <StTemplates/StHandle.h>
+
+#include <vector>
+
+/**
+ * Simple pool of worker threads for data-parallel jobs.
+ * The job is split into chunks which are processed by workers
+ * and by the calling thread itself; perform() returns when all chunks are done.
+ * Worker threads are started lazily on first call.
+ */
+class StThreadPool {
+
+        public:
+
+    /**
+     * Interface for the job.
+     */
+    class Job {
+
+            public:
+
+        /**
+         * Destructor.
+         */
+        virtual ~Job() {}
+
+        /**
+         * Process the chunk of the job.
+         * @param theChunk   chunk index
+         * @param theNbChunks overall number of chunks
+         */
+        virtual void perform(const size_t theChunk,
+                             const size_t theNbChunks) = 0;
+
+    };
+
+        public:
+
+    /**
+     * Main constructor.
+     * @param theNbThreads overall number of threads including the calling one,
+     *                     0 means number of logical processors
+     */
+    ST_CPPEXPORT StThreadPool(const int theNbThreads = 0);
+
+    /**
+     * Destructor, stops worker threads.
+     */
+    ST_CPPEXPORT ~StThreadPool();
+
+    /**
+     * @return overall number of threads including the calling one
+     */
+    ST_LOCAL size_t getNbThreads() const {
+        return myNbThreads;
+    }
+
+    /**
+     * Execute the job and wait for its completion.
+     * @param theJob      the job
+     * @param theNbChunks number of chunks to split the job
+     */
+    ST_CPPEXPORT void perform(Job&         theJob,
+                              const size_t theNbChunks);
+
+        private:
+
+    /**
+     * Worker thread state.
+     */
+    struct Worker {
+        StThreadPool*      Pool;      //!< owner
+        StHandle<StThread> Thread;    //!< thread
+        StCondition        WakeEvent; //!< signals new job
+        StCondition        DoneEvent; //!< signals job completion
+
+        Worker() : Pool(NULL), WakeEvent(false), DoneEvent(true) {}
+    };
+
+    /**
+     * Thread function.
+     */
+    static SV_THREAD_FUNCTION threadFunction(void* theWorker);
+
+    /**
+     * Process chunks of active job until they are exhausted.
+     */
+    ST_LOCAL void performChunks();
+
+    /**
+     * Start worker threads.
+     */
+    ST_LOCAL void startWorkers();
+
+        private:
+
+    StMutex                myMutex;       //!< lock to serialize jobs
+    std::vector<Worker*>   myWorkers;     //!< worker threads
+    Job*                   myJob;         //!< active job
+    size_t                 myNbChunks;    //!< number of chunks in active job
+    volatile int32_t       myChunkIter;   //!< chunk counter
+    size_t                 myNbThreads;   //!< overall number of threads
+    volatile bool          myToQuit;      //!< flag to stop workers
+
+        private: //! @name no copies
+
+    StThreadPool(const StThreadPool& );
+    StThreadPool& operator=(const StThreadPool& );
+
+};
+
+#endif // __StThreadPool_h_